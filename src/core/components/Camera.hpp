@@ -0,0 +1,81 @@
+// ============================================================================
+// Camera Component - Vista 2D sobre el mundo
+// ============================================================================
+// Define qué zona del mundo se ve y en qué parte de la ventana
+// Usado por: CameraSystem (matrices y zona visible), RenderSystem (culling)
+// ============================================================================
+
+#pragma once
+
+#include <glm/glm.hpp>
+
+namespace MultiNinjaEspacial::Core::Components {
+
+/**
+ * @brief Cámara ortográfica 2D
+ *
+ * Los campos de configuración los escribe el juego; los calculados los
+ * rellena CameraSystem::Update cada frame (no escribirlos a mano). Puede
+ * haber varias cámaras (pantalla partida, minimapa): cada una dibuja en su
+ * viewport, en orden creciente de order.
+ *
+ * Ejemplo de uso:
+ * ```cpp
+ * auto camera = registry.create();
+ * registry.emplace<Camera>(camera, glm::vec2{400.0f, 300.0f});
+ *
+ * // Seguir al jugador
+ * registry.get<Camera>(camera).position = playerTransform.position;
+ *
+ * // Pantalla partida: mitad izquierda y mitad derecha
+ * registry.emplace<Camera>(left, glm::vec2{0.0f}, 1.0f, glm::vec4{0.0f, 0.0f, 0.5f, 1.0f});
+ * registry.emplace<Camera>(right, glm::vec2{0.0f}, 1.0f, glm::vec4{0.5f, 0.0f, 0.5f, 1.0f});
+ * ```
+ */
+struct Camera {
+    // Centro de la vista en coordenadas del mundo
+    glm::vec2 position{0.0f, 0.0f};
+
+    // Píxeles de pantalla por unidad del mundo (2 = todo el doble de grande)
+    float zoom{1.0f};
+
+    // Zona de la ventana en fracciones de su tamaño: (x, y, ancho, alto),
+    // con y desde arriba como el resto de coordenadas
+    glm::vec4 viewport{0.0f, 0.0f, 1.0f, 1.0f};
+
+    // Orden de dibujo entre cámaras (menor = antes, queda debajo)
+    int order{0};
+
+    // Las cámaras inactivas no dibujan ni cuentan para el culling
+    bool active{true};
+
+    // Ajustar la vista a la rejilla de píxeles: sin esto, los sprites con
+    // posición entera tiemblan cuando la cámara se mueve en fracciones
+    bool pixelSnap{true};
+
+    // ━━━ Calculado por CameraSystem ━━━
+
+    // Mundo → clip (ortográfica, y hacia abajo)
+    glm::mat4 viewProjection{1.0f};
+
+    // Rectángulo visible en coordenadas del mundo
+    glm::vec2 visibleMin{0.0f, 0.0f};
+    glm::vec2 visibleMax{0.0f, 0.0f};
+
+    /**
+     * @brief Constructor por defecto: vista centrada en el origen, zoom 1
+     */
+    Camera() = default;
+
+    /**
+     * @brief Constructor con posición, zoom y viewport
+     * @param pos Centro de la vista en el mundo
+     * @param z Zoom
+     * @param view Zona de la ventana (fracciones)
+     */
+    explicit Camera(const glm::vec2& pos, float z = 1.0f,
+                    const glm::vec4& view = glm::vec4{0.0f, 0.0f, 1.0f, 1.0f})
+        : position(pos), zoom(z), viewport(view) {}
+};
+
+} // namespace MultiNinjaEspacial::Core::Components
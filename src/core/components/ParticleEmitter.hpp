@@ -0,0 +1,72 @@
+// ============================================================================
+// ParticleEmitter Component - Emisor de partículas continuo
+// ============================================================================
+// Une una entidad a una definición de emisor del ParticleSystem
+// Usado por: ParticleSystem (emite en la posición del Transform)
+// ============================================================================
+
+#pragma once
+
+#include <glm/glm.hpp>
+#include <cstdint>
+
+namespace MultiNinjaEspacial::Core::Components {
+
+/**
+ * @brief Emisor continuo de partículas (fuego, veneno, aturdimiento...)
+ *
+ * Las partículas no son entidades: viven en los pools del ParticleSystem.
+ * Este componente solo dice qué definición emitir y dónde. Los efectos de
+ * un solo disparo (golpes, explosiones) usan ParticleSystem::Burst y no
+ * necesitan entidad.
+ *
+ * Ejemplo de uso:
+ * ```cpp
+ * uint32_t fire = particleSystem.FindDefinition("fire");
+ * registry.emplace<ParticleEmitter>(enemy, fire);
+ *
+ * // Al apagarse el efecto
+ * registry.get<ParticleEmitter>(enemy).emitting = false;
+ * ```
+ */
+struct ParticleEmitter {
+    // Valor reservado para "sin definición"
+    static constexpr uint32_t INVALID_DEFINITION = 0xFFFFFFFFu;
+
+    // Índice de la definición (ParticleSystem::FindDefinition)
+    uint32_t definition{INVALID_DEFINITION};
+
+    // Desplazamiento respecto a Transform::position (px)
+    glm::vec2 offset{0.0f, 0.0f};
+
+    // Tint multiplicado sobre los colores de la definición
+    glm::vec4 tint{1.0f};
+
+    // false = pausado (las partículas ya emitidas terminan su vida)
+    bool emitting{true};
+
+    // Fracción de partícula pendiente entre updates (lo gestiona el sistema)
+    float accumulator{0.0f};
+
+    /**
+     * @brief Constructor por defecto: emisor sin definición
+     */
+    ParticleEmitter() = default;
+
+    /**
+     * @brief Constructor con definición
+     * @param def Índice de la definición
+     */
+    explicit ParticleEmitter(uint32_t def)
+        : definition(def) {}
+
+    /**
+     * @brief Constructor con definición y desplazamiento
+     * @param def Índice de la definición
+     * @param off Desplazamiento respecto al Transform
+     */
+    ParticleEmitter(uint32_t def, const glm::vec2& off)
+        : definition(def), offset(off) {}
+};
+
+} // namespace MultiNinjaEspacial::Core::Components
@@ -0,0 +1,52 @@
+// ============================================================================
+// PreviousTransform Component - Transform del paso de simulación anterior
+// ============================================================================
+// Copia del Transform al empezar cada paso fijo
+// Usado por: InterpolationSystem (lo rellena), RenderSystem (interpola)
+// ============================================================================
+
+#pragma once
+
+#include "Transform.hpp"
+#include <glm/glm.hpp>
+
+namespace MultiNinjaEspacial::Core::Components {
+
+/**
+ * @brief Estado de la entidad en el paso de simulación anterior
+ *
+ * La simulación avanza a pasos fijos (GameLoop) y el render va a su propio
+ * ritmo: dibujar solo el Transform actual hace que los objetos avancen a
+ * saltos cuando la simulación va a menos Hz que la pantalla. RenderSystem
+ * dibuja las entidades con este componente entre PreviousTransform y
+ * Transform, según el tiempo que sobra en el acumulador.
+ *
+ * InterpolationSystem lo añade a las entidades con Velocity y lo actualiza;
+ * para otras entidades que se muevan (animadas por script) basta con
+ * añadirlo a mano. Tras un salto de posición (teletransporte, respawn) usar
+ * InterpolationSystem::Teleport para no dibujar el recorrido intermedio.
+ *
+ * Ejemplo de uso:
+ * ```cpp
+ * registry.emplace<PreviousTransform>(entity, registry.get<Transform>(entity));
+ * ```
+ */
+struct PreviousTransform {
+    glm::vec2 position{0.0f, 0.0f};
+    float rotation{0.0f};
+    glm::vec2 scale{1.0f, 1.0f};
+
+    /**
+     * @brief Constructor por defecto
+     */
+    PreviousTransform() = default;
+
+    /**
+     * @brief Constructor a partir del Transform actual
+     * @param transform Estado que se guarda
+     */
+    explicit PreviousTransform(const Transform& transform)
+        : position(transform.position), rotation(transform.rotation), scale(transform.scale) {}
+};
+
+} // namespace MultiNinjaEspacial::Core::Components
@@ -7,8 +7,9 @@
 
 #pragma once
 
+#include "TextureHandle.hpp"
 #include <glm/glm.hpp>
-#include <string>
+#include <type_traits>
 
 namespace MultiNinjaEspacial::Core::Components {
 
@@ -16,25 +17,28 @@ namespace MultiNinjaEspacial::Core::Components {
  * @brief Componente que marca entidades renderizables
  *
  * Contiene toda la información necesaria para dibujar un sprite:
- * - ID de textura
+ * - Handle de textura
+ * - Tamaño del sprite
  * - Color tint
  * - Layer (para ordenar dibujo)
  * - Visibilidad
  *
  * Ejemplo de uso:
  * ```cpp
+ * TextureHandle playerTex = renderer.LoadTexture("player_sprite", "assets/sprites/player.png");
+ *
  * auto entity = registry.create();
  * registry.emplace<Renderable>(entity,
- *     "player_sprite",           // texture ID
+ *     playerTex,                 // handle de textura
  *     glm::vec4{1.0f},           // color blanco (sin tint)
  *     10                          // layer 10 (más alto = dibuja encima)
  * );
  * ```
  */
 struct Renderable {
-    // ID de la textura a renderizar
-    // Se busca en el TextureManager usando este string
-    std::string textureId;
+    // Textura a renderizar (índice en la tabla del renderer)
+    // Se obtiene una sola vez con IRenderer::LoadTexture / FindTexture
+    TextureHandle texture;
 
     // Color tint (RGBA, valores 0.0-1.0)
     // {1,1,1,1} = sin cambios
@@ -42,6 +46,10 @@ struct Renderable {
     // {1,1,1,0.5} = 50% transparente
     glm::vec4 color{1.0f, 1.0f, 1.0f, 1.0f};
 
+    // Tamaño del sprite en píxeles (antes de aplicar Transform::scale)
+    // También se usa para el culling en RenderSystem
+    glm::vec2 size{64.0f, 64.0f};
+
     // Layer de renderizado (mayor número = se dibuja encima)
     // Ejemplo de layers:
     //   0-9:   Fondo
@@ -61,19 +69,19 @@ struct Renderable {
 
     /**
      * @brief Constructor con textura
-     * @param texId ID de textura
+     * @param tex Handle de textura
      */
-    explicit Renderable(std::string texId)
-        : textureId(std::move(texId)) {}
+    explicit Renderable(TextureHandle tex)
+        : texture(tex) {}
 
     /**
      * @brief Constructor completo
-     * @param texId ID de textura
+     * @param tex Handle de textura
      * @param col Color tint
      * @param lyr Layer de renderizado
      */
-    Renderable(std::string texId, const glm::vec4& col, int lyr)
-        : textureId(std::move(texId)), color(col), layer(lyr) {}
+    Renderable(TextureHandle tex, const glm::vec4& col, int lyr)
+        : texture(tex), color(col), layer(lyr) {}
 
     /**
      * @brief Establece opacidad (0.0 = transparente, 1.0 = opaco)
@@ -106,4 +114,8 @@ struct Renderable {
     }
 };
 
+// Sin strings ni punteros: el pool de EnTT puede copiarlo con memcpy
+static_assert(std::is_trivially_copyable_v<Renderable>,
+              "Renderable debe ser trivialmente copiable");
+
 } // namespace MultiNinjaEspacial::Core::Components
@@ -0,0 +1,42 @@
+// ============================================================================
+// Static Component - Tag de geometría que no se mueve
+// ============================================================================
+// Marca entidades dibujables que no cambian de un frame a otro
+// Usado por: RenderSystem (las hornea en batches estáticos por layer)
+// ============================================================================
+
+#pragma once
+
+#include <type_traits>
+
+namespace MultiNinjaEspacial::Core::Components {
+
+/**
+ * @brief Tag de entidad estática (fondos, decorados, muebles colocados)
+ *
+ * Las entidades con Transform + Renderable + Static no se recorren cada
+ * frame: RenderSystem las hornea en un batch estático por layer y solo lo
+ * rehace cuando alguna cambia. Para que el cambio se detecte hay que
+ * modificarlas con patch/replace (Registry::PatchComponent; emiten
+ * on_update) o avisar con
+ * RenderSystem::MarkStaticDirty; escribir en el componente a través de
+ * get() no se detecta.
+ *
+ * No combinar con Velocity: MovementSystem las movería sin avisar.
+ *
+ * Ejemplo de uso:
+ * ```cpp
+ * auto rock = registry.create();
+ * registry.emplace<Transform>(rock, glm::vec2{300.0f, 420.0f});
+ * registry.emplace<Renderable>(rock, rockTexture, glm::vec4{1.0f}, 2);
+ * registry.emplace<Static>(rock);
+ *
+ * // Moverla más tarde (rehace solo el batch de su layer)
+ * registry.patch<Transform>(rock, [](auto& t) { t.position.x += 32.0f; });
+ * ```
+ */
+struct Static {};
+
+static_assert(std::is_empty_v<Static>, "Static es un tag sin datos");
+
+} // namespace MultiNinjaEspacial::Core::Components
@@ -0,0 +1,62 @@
+// ============================================================================
+// TextureHandle - Handle denso de textura
+// ============================================================================
+// Índice de 32 bits en la tabla de texturas del renderer
+// Usado por: Renderable, RenderSystem e IRenderer (en lugar de IDs string)
+// ============================================================================
+
+#pragma once
+
+#include <cstdint>
+
+namespace MultiNinjaEspacial::Core::Components {
+
+/**
+ * @brief Handle de textura (índice en la tabla del renderer)
+ *
+ * El ID string de una textura solo se resuelve una vez, al cargarla.
+ * A partir de ahí todo el path de dibujo trabaja con este índice:
+ * sin hashing de strings por frame y sin asignaciones en Renderable.
+ *
+ * Ejemplo de uso:
+ * ```cpp
+ * TextureHandle player = renderer.LoadTexture("player", "assets/sprites/player.png");
+ * registry.emplace<Renderable>(entity, player, glm::vec4{1.0f}, 10);
+ *
+ * // Resolver un ID ya cargado (fuera del path de render)
+ * TextureHandle same = renderer.FindTexture("player");
+ * ```
+ *
+ * NOTA: Los índices de texturas descargadas se reutilizan. No guardes
+ * handles de texturas que hayas descargado.
+ */
+struct TextureHandle {
+    // Valor reservado para "sin textura"
+    static constexpr uint32_t INVALID_INDEX = 0xFFFFFFFFu;
+
+    // Índice en la tabla de texturas
+    uint32_t index{INVALID_INDEX};
+
+    /**
+     * @brief Constructor por defecto: handle inválido
+     */
+    constexpr TextureHandle() = default;
+
+    /**
+     * @brief Constructor con índice
+     * @param idx Índice en la tabla de texturas
+     */
+    constexpr explicit TextureHandle(uint32_t idx)
+        : index(idx) {}
+
+    /**
+     * @brief Verifica si el handle apunta a una textura
+     */
+    [[nodiscard]] constexpr bool IsValid() const {
+        return index != INVALID_INDEX;
+    }
+
+    constexpr bool operator==(const TextureHandle& other) const = default;
+};
+
+} // namespace MultiNinjaEspacial::Core::Components
@@ -0,0 +1,151 @@
+// ============================================================================
+// Command Buffer - Implementación
+// ============================================================================
+
+#include "CommandBuffer.hpp"
+#include <spdlog/spdlog.h>
+#include <algorithm>
+#include <cassert>
+
+namespace MultiNinjaEspacial::Core::ECS {
+
+// ============================================================================
+// CommandBuffer
+// ============================================================================
+
+CommandBuffer::~CommandBuffer() {
+    Clear();
+}
+
+CommandBuffer::PendingEntity CommandBuffer::Create() {
+    return PendingEntity{m_PendingCount++};
+}
+
+void CommandBuffer::Destroy(entt::entity entity) {
+    Command command{};
+    command.type = CommandType::Destroy;
+    command.entity = entity;
+    command.pending = NO_PENDING;
+    m_Commands.push_back(command);
+}
+
+void* CommandBuffer::Allocate(size_t size, size_t alignment) {
+    // Bloque actual, o el siguiente (reutilizado o nuevo) si no cabe
+    while (m_CurrentBlock < m_Blocks.size()) {
+        const Block& block = m_Blocks[m_CurrentBlock];
+        const size_t offset = (m_BlockOffset + alignment - 1) & ~(alignment - 1);
+        if (offset + size <= block.size) {
+            m_BlockOffset = offset + size;
+            return block.data.get() + offset;
+        }
+        m_CurrentBlock++;
+        m_BlockOffset = 0;
+    }
+
+    // new[] de std::byte alinea a __STDCPP_DEFAULT_NEW_ALIGNMENT__ (16), de
+    // sobra para los componentes
+    const size_t blockSize = std::max(BLOCK_SIZE, size);
+    m_Blocks.push_back(Block{std::make_unique<std::byte[]>(blockSize), blockSize});
+    m_CurrentBlock = m_Blocks.size() - 1;
+    m_BlockOffset = size;
+    return m_Blocks.back().data.get();
+}
+
+/**
+ * @brief Aplica los comandos
+ *
+ * Orden estable por clave: primero los componentes por tipo y al final las
+ * destrucciones. Un Emplace seguido de un Remove del mismo tipo (o al
+ * revés) conserva su orden.
+ */
+const std::vector<entt::entity>& CommandBuffer::Playback(entt::registry& registry) {
+    m_Created.resize(m_PendingCount);
+    registry.create(m_Created.begin(), m_Created.end());
+
+    std::stable_sort(m_Commands.begin(), m_Commands.end(), [](const Command& a, const Command& b) {
+        const bool aDestroy = a.type == CommandType::Destroy;
+        const bool bDestroy = b.type == CommandType::Destroy;
+        if (aDestroy != bDestroy) {
+            return bDestroy;
+        }
+        return !aDestroy && a.component < b.component;
+    });
+
+    size_t skipped = 0;
+    for (const Command& command : m_Commands) {
+        const entt::entity target = command.pending != NO_PENDING ? m_Created[command.pending] : command.entity;
+        if (!registry.valid(target)) {
+            skipped++;
+            continue;
+        }
+
+        if (command.type == CommandType::Destroy) {
+            registry.destroy(target);
+        } else {
+            command.apply(registry, target, command.payload);
+        }
+    }
+
+    if (skipped > 0) {
+        spdlog::debug("CommandBuffer: {} comandos sobre entidades ya destruidas", skipped);
+    }
+
+    Clear();
+    return m_Created;
+}
+
+void CommandBuffer::Clear() {
+    // Los componentes movidos (o nunca aplicados) siguen vivos en el arena
+    for (const Command& command : m_Commands) {
+        if (command.destroy) {
+            command.destroy(command.payload);
+        }
+    }
+
+    m_Commands.clear();
+    m_PendingCount = 0;
+    m_CurrentBlock = 0;
+    m_BlockOffset = 0;
+}
+
+// ============================================================================
+// CommandBuffers
+// ============================================================================
+
+CommandBuffers::CommandBuffers(Jobs::JobSystem& jobs)
+    : m_Jobs(jobs), m_MainThread(std::this_thread::get_id()) {
+    const uint32_t threads = jobs.GetWorkerCount() + 1;
+    m_Buffers.reserve(threads);
+    for (uint32_t i = 0; i < threads; ++i) {
+        m_Buffers.push_back(std::make_unique<ThreadBuffer>());
+    }
+}
+
+CommandBuffer& CommandBuffers::Local() {
+    assert(IsRecordingThread() && "CommandBuffers::Local - Hilo ajeno al JobSystem");
+    return m_Buffers[m_Jobs.GetCurrentThreadIndex()]->buffer;
+}
+
+bool CommandBuffers::IsRecordingThread() const {
+    // El JobSystem da índice 0 a todo hilo que no sea worker suyo: el 0
+    // solo es válido para el hilo principal
+    return m_Jobs.GetCurrentThreadIndex() != 0 || std::this_thread::get_id() == m_MainThread;
+}
+
+void CommandBuffers::Playback(entt::registry& registry) {
+    for (auto& thread : m_Buffers) {
+        if (!thread->buffer.IsEmpty()) {
+            thread->buffer.Playback(registry);
+        }
+    }
+}
+
+size_t CommandBuffers::GetCommandCount() const {
+    size_t count = 0;
+    for (const auto& thread : m_Buffers) {
+        count += thread->buffer.GetCommandCount();
+    }
+    return count;
+}
+
+} // namespace MultiNinjaEspacial::Core::ECS
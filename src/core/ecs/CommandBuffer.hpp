@@ -0,0 +1,275 @@
+// ============================================================================
+// Command Buffer - Cambios estructurales diferidos
+// ============================================================================
+// Graba creaciones, destrucciones y componentes añadidos o quitados para
+// aplicarlos de golpe en un punto de sincronización
+// ============================================================================
+
+#pragma once
+
+#include "../jobs/JobSystem.hpp"
+#include <entt/entt.hpp>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <new>
+#include <thread>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace MultiNinjaEspacial::Core::ECS {
+
+/**
+ * @brief Lista de cambios estructurales para aplicar más tarde
+ *
+ * Crear o destruir entidades y añadir o quitar componentes invalida las
+ * views que se están recorriendo y no se puede hacer desde otro hilo. El
+ * buffer los graba y Playback los aplica todos de una vez:
+ * 1. Crea las entidades pendientes (en bloque)
+ * 2. Añade y quita componentes, agrupados por tipo (cada pool se toca en
+ *    una sola tanda; dentro de un tipo se respeta el orden de grabación)
+ * 3. Destruye entidades (al final: lo que se grabó para ellas no falla)
+ *
+ * Los componentes se construyen al grabar en un arena lineal de bloques
+ * (sin una reserva por comando; los bloques se reutilizan entre frames) y
+ * se mueven al registry en Playback. Lo que apunta a entidades que ya no
+ * existen se descarta.
+ *
+ * Un buffer no es thread-safe: uno por hilo (ver CommandBuffers).
+ *
+ * Ejemplo de uso:
+ * ```cpp
+ * CommandBuffer commands;
+ *
+ * for (auto [entity, health] : registry.view<Health>().each()) {
+ *     if (health.IsDead()) {
+ *         commands.Destroy(entity);
+ *
+ *         auto explosion = commands.Create();
+ *         commands.Emplace<Transform>(explosion, position);
+ *     }
+ * }
+ * commands.Playback(registry);   // Fuera del bucle
+ * ```
+ */
+class CommandBuffer {
+public:
+    // Tamaño de cada bloque del arena (los componentes más grandes van en
+    // un bloque propio)
+    static constexpr size_t BLOCK_SIZE = 64 * 1024;
+
+    /**
+     * @brief Entidad grabada con Create (existe a partir de Playback)
+     */
+    struct PendingEntity {
+        uint32_t index;
+    };
+
+    CommandBuffer() = default;
+    ~CommandBuffer();
+
+    CommandBuffer(const CommandBuffer&) = delete;
+    CommandBuffer& operator=(const CommandBuffer&) = delete;
+
+    /**
+     * @brief Graba la creación de una entidad
+     * @return Entidad pendiente, para añadirle componentes
+     */
+    PendingEntity Create();
+
+    /**
+     * @brief Graba la destrucción de una entidad
+     */
+    void Destroy(entt::entity entity);
+
+    /**
+     * @brief Graba un componente para una entidad existente
+     * @tparam T Tipo de componente
+     * @param args Argumentos del constructor (se construye ya, al grabar)
+     *
+     * Si la entidad ya lo tiene al aplicarse, se reemplaza.
+     */
+    template<typename T, typename... Args>
+    void Emplace(entt::entity entity, Args&&... args) {
+        RecordEmplace<T>(entity, NO_PENDING, std::forward<Args>(args)...);
+    }
+
+    /**
+     * @brief Graba un componente para una entidad pendiente
+     */
+    template<typename T, typename... Args>
+    void Emplace(PendingEntity entity, Args&&... args) {
+        RecordEmplace<T>(entt::null, entity.index, std::forward<Args>(args)...);
+    }
+
+    /**
+     * @brief Graba que se quite un componente (si lo tiene al aplicarse)
+     */
+    template<typename T>
+    void Remove(entt::entity entity) {
+        Command command{};
+        command.type = CommandType::Remove;
+        command.entity = entity;
+        command.pending = NO_PENDING;
+        command.component = entt::type_hash<T>::value();
+        command.apply = [](entt::registry& registry, entt::entity target, void*) {
+            registry.remove<T>(target);
+        };
+        m_Commands.push_back(command);
+    }
+
+    /**
+     * @brief Aplica todos los comandos y vacía el buffer
+     * @param registry Registro de EnTT
+     * @return Entidades creadas, en el orden de Create (válido hasta el
+     *         siguiente Playback)
+     *
+     * Llamar desde un punto de sincronización: con nadie recorriendo views
+     * del registry.
+     */
+    const std::vector<entt::entity>& Playback(entt::registry& registry);
+
+    /**
+     * @brief Descarta los comandos grabados sin aplicarlos
+     */
+    void Clear();
+
+    [[nodiscard]] bool IsEmpty() const { return m_Commands.empty() && m_PendingCount == 0; }
+    [[nodiscard]] size_t GetCommandCount() const { return m_Commands.size() + m_PendingCount; }
+
+private:
+    static constexpr uint32_t NO_PENDING = UINT32_MAX;
+
+    enum class CommandType : uint8_t {
+        Emplace,
+        Remove,
+        Destroy
+    };
+
+    /**
+     * @brief Comando grabado (el componente, si lo hay, está en el arena)
+     */
+    struct Command {
+        CommandType type;
+        entt::entity entity;        // Entidad existente...
+        uint32_t pending;           // ...o índice de Create (NO_PENDING si no)
+        entt::id_type component;    // Clave de ordenación (Emplace/Remove)
+        void* payload;
+        void (*apply)(entt::registry& registry, entt::entity target, void* payload);
+        void (*destroy)(void* payload);
+    };
+
+    /**
+     * @brief Bloque del arena
+     */
+    struct Block {
+        std::unique_ptr<std::byte[]> data;
+        size_t size;
+    };
+
+    template<typename T, typename... Args>
+    void RecordEmplace(entt::entity entity, uint32_t pending, Args&&... args) {
+        static_assert(alignof(T) <= __STDCPP_DEFAULT_NEW_ALIGNMENT__, "Alineación mayor que la del arena");
+
+        void* memory = Allocate(sizeof(T), alignof(T));
+        if constexpr (std::is_constructible_v<T, Args...>) {
+            ::new (memory) T(std::forward<Args>(args)...);
+        } else {
+            ::new (memory) T{std::forward<Args>(args)...};
+        }
+
+        Command command{};
+        command.type = CommandType::Emplace;
+        command.entity = entity;
+        command.pending = pending;
+        command.component = entt::type_hash<T>::value();
+        command.payload = memory;
+        command.apply = [](entt::registry& registry, entt::entity target, void* payload) {
+            registry.emplace_or_replace<T>(target, std::move(*static_cast<T*>(payload)));
+        };
+        if constexpr (!std::is_trivially_destructible_v<T>) {
+            command.destroy = [](void* payload) { static_cast<T*>(payload)->~T(); };
+        }
+        m_Commands.push_back(command);
+    }
+
+    /**
+     * @brief Reserva memoria en el arena
+     */
+    void* Allocate(size_t size, size_t alignment);
+
+    std::vector<Command> m_Commands;
+    uint32_t m_PendingCount{0};
+    std::vector<entt::entity> m_Created;
+
+    // Arena: bloques que se rellenan en orden y se reutilizan tras Clear
+    std::vector<Block> m_Blocks;
+    size_t m_CurrentBlock{0};
+    size_t m_BlockOffset{0};
+};
+
+/**
+ * @brief Un CommandBuffer por hilo de un JobSystem
+ *
+ * Local() devuelve el buffer del hilo que llama (el principal o un worker
+ * de ese JobSystem), así que los sistemas y los jobs graban sin locks.
+ * Playback aplica los buffers uno detrás de otro, en orden de hilo.
+ *
+ * El hilo principal es el que construye el objeto. Cualquier otro hilo
+ * (o un worker de otro JobSystem) compartiría su buffer sin sincronizar:
+ * Local() lo comprueba con assert en Debug.
+ *
+ * Ejemplo de uso:
+ * ```cpp
+ * CommandBuffers commands(jobs);
+ *
+ * ParallelEach(jobs, view, [&](entt::entity entity, Health& health) {
+ *     if (health.IsDead()) {
+ *         commands.Local().Destroy(entity);
+ *     }
+ * });
+ * commands.Playback(registry);
+ * ```
+ */
+class CommandBuffers {
+public:
+    explicit CommandBuffers(Jobs::JobSystem& jobs);
+
+    /**
+     * @brief Buffer del hilo actual
+     *
+     * Solo desde el hilo principal o un worker del JobSystem (assert en
+     * Debug).
+     */
+    [[nodiscard]] CommandBuffer& Local();
+
+    /**
+     * @brief Indica si el hilo actual tiene buffer propio (puede usar Local)
+     */
+    [[nodiscard]] bool IsRecordingThread() const;
+
+    /**
+     * @brief Aplica y vacía todos los buffers
+     */
+    void Playback(entt::registry& registry);
+
+    /**
+     * @brief Comandos grabados en todos los buffers
+     */
+    [[nodiscard]] size_t GetCommandCount() const;
+
+private:
+    /**
+     * @brief Buffer en su propia línea de caché (cada hilo escribe el suyo)
+     */
+    struct alignas(64) ThreadBuffer {
+        CommandBuffer buffer;
+    };
+
+    Jobs::JobSystem& m_Jobs;
+    std::thread::id m_MainThread;
+    std::vector<std::unique_ptr<ThreadBuffer>> m_Buffers;   // [0] = hilo principal
+};
+
+} // namespace MultiNinjaEspacial::Core::ECS
@@ -0,0 +1,23 @@
+// ============================================================================
+// Prefab - Implementación
+// ============================================================================
+
+#include "Prefab.hpp"
+
+namespace MultiNinjaEspacial::Core::ECS {
+
+Prefab::Prefab(std::string name) : m_Name(std::move(name)) {
+}
+
+void Prefab::Apply(entt::registry& registry, const entt::entity* first, const entt::entity* last) const {
+    if (first == last) {
+        return;
+    }
+
+    // Un componente cada vez: cada pool se reserva y se rellena de golpe
+    for (const auto& component : m_Components) {
+        component->Insert(registry, first, last);
+    }
+}
+
+} // namespace MultiNinjaEspacial::Core::ECS
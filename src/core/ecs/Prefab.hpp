@@ -0,0 +1,157 @@
+// ============================================================================
+// Prefab - Plantilla de entidad para crear copias en bloque
+// ============================================================================
+// Guarda un conjunto de componentes con sus valores por defecto;
+// Registry::Instantiate crea N entidades con todos ellos de una vez
+// ============================================================================
+
+#pragma once
+
+#include <entt/entt.hpp>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace MultiNinjaEspacial::Core::ECS {
+
+/**
+ * @brief Plantilla de entidad (arquetipo): componentes + valores iniciales
+ *
+ * Se define una vez y se instancia las veces que haga falta con
+ * Registry::Instantiate. Al instanciar N copias, cada componente se
+ * inserta en bloque: una reserva en su pool para las N entidades y N
+ * copias del valor de la plantilla, en vez de N AddComponent.
+ *
+ * Ejemplo de uso:
+ * ```cpp
+ * Prefab enemy("enemy");
+ * enemy.With<Transform>(glm::vec2{0, 0})
+ *      .With<Velocity>(glm::vec2{20, 15}, 45.0f)
+ *      .With<Renderable>(enemyTexture, glm::vec4{1, 0.2f, 0.2f, 1}, 10);
+ *
+ * // Oleada de 50, cada uno en su sitio
+ * registry.Instantiate(enemy, 50, [&](entt::entity entity, uint32_t i) {
+ *     registry.GetComponent<Transform>(entity).position = {i * 40.0f, 100.0f};
+ * });
+ * ```
+ */
+class Prefab {
+public:
+    /**
+     * @brief Constructor
+     * @param name Nombre para debugging (log al instanciar)
+     */
+    explicit Prefab(std::string name = "");
+
+    Prefab(Prefab&&) noexcept = default;
+    Prefab& operator=(Prefab&&) noexcept = default;
+
+    /**
+     * @brief Añade un componente a la plantilla (o reemplaza su valor)
+     * @tparam T Tipo de componente
+     * @param args Argumentos del constructor del valor por defecto
+     * @return La propia plantilla (encadenable)
+     */
+    template<typename T, typename... Args>
+    Prefab& With(Args&&... args) {
+        auto component = std::make_unique<Component<T>>(std::forward<Args>(args)...);
+        for (auto& existing : m_Components) {
+            if (existing->type == component->type) {
+                existing = std::move(component);
+                return *this;
+            }
+        }
+        m_Components.push_back(std::move(component));
+        return *this;
+    }
+
+    /**
+     * @brief Indica si la plantilla tiene un componente
+     */
+    template<typename T>
+    [[nodiscard]] bool Has() const {
+        return Find<T>() != nullptr;
+    }
+
+    /**
+     * @brief Valor por defecto de un componente (para retocarlo)
+     * @return nullptr si la plantilla no lo tiene
+     */
+    template<typename T>
+    [[nodiscard]] T* Get() {
+        auto* component = Find<T>();
+        return component ? &component->value : nullptr;
+    }
+
+    /**
+     * @brief Añade los componentes de la plantilla a entidades ya creadas
+     * @param registry Registro de EnTT
+     * @param first Inicio de las entidades (contiguas)
+     * @param last Fin de las entidades
+     *
+     * Normalmente se usa a través de Registry::Instantiate.
+     */
+    void Apply(entt::registry& registry, const entt::entity* first, const entt::entity* last) const;
+
+    [[nodiscard]] const std::string& GetName() const { return m_Name; }
+    [[nodiscard]] size_t GetComponentCount() const { return m_Components.size(); }
+
+private:
+    /**
+     * @brief Componente de la plantilla (tipo borrado)
+     */
+    struct ComponentBase {
+        explicit ComponentBase(entt::id_type id) : type(id) {}
+        virtual ~ComponentBase() = default;
+
+        /**
+         * @brief Reserva en el pool e inserta una copia por entidad
+         */
+        virtual void Insert(entt::registry& registry, const entt::entity* first, const entt::entity* last) const = 0;
+
+        entt::id_type type;
+    };
+
+    template<typename T>
+    struct Component final : ComponentBase {
+        template<typename... Args>
+        explicit Component(Args&&... args)
+            : ComponentBase(entt::type_hash<T>::value()), value(MakeValue(std::forward<Args>(args)...)) {}
+
+        void Insert(entt::registry& registry, const entt::entity* first, const entt::entity* last) const override {
+            auto& storage = registry.storage<T>();
+            storage.reserve(storage.size() + static_cast<size_t>(last - first));
+            registry.insert<T>(first, last, value);
+        }
+
+        template<typename... Args>
+        static T MakeValue(Args&&... args) {
+            if constexpr (std::is_constructible_v<T, Args...>) {
+                return T(std::forward<Args>(args)...);
+            } else {
+                return T{std::forward<Args>(args)...};
+            }
+        }
+
+        T value;
+    };
+
+    template<typename T>
+    [[nodiscard]] Component<T>* Find() const {
+        const entt::id_type type = entt::type_hash<T>::value();
+        for (const auto& component : m_Components) {
+            if (component->type == type) {
+                return static_cast<Component<T>*>(component.get());
+            }
+        }
+        return nullptr;
+    }
+
+    std::string m_Name;
+    std::vector<std::unique_ptr<ComponentBase>> m_Components;
+};
+
+} // namespace MultiNinjaEspacial::Core::ECS
@@ -22,13 +22,24 @@ entt::entity Registry::CreateEntity(const std::string& name) {
         m_EntityNames[entity] = name;
         spdlog::debug("Entidad creada: {} (ID: {})", name, static_cast<uint32_t>(entity));
     } else {
-        spdlog::trace("Entidad creada: ID {}", static_cast<uint32_t>(entity));
+        SPDLOG_TRACE("Entidad creada: ID {}", static_cast<uint32_t>(entity));
     }
 
     m_EntityCounter++;
     return entity;
 }
 
+std::span<const entt::entity> Registry::Instantiate(const Prefab& prefab, uint32_t count) {
+    m_Instances.resize(count);
+    m_Registry.create(m_Instances.begin(), m_Instances.end());
+    prefab.Apply(m_Registry, m_Instances.data(), m_Instances.data() + m_Instances.size());
+
+    m_EntityCounter += count;
+    spdlog::debug("Prefab '{}' instanciado: {} entidades ({} componentes)",
+                  prefab.GetName(), count, prefab.GetComponentCount());
+    return m_Instances;
+}
+
 void Registry::DestroyEntity(entt::entity entity) {
     if (!IsValid(entity)) {
         spdlog::warn("Intentando destruir entidad inválida");
@@ -41,7 +52,7 @@ void Registry::DestroyEntity(entt::entity entity) {
         spdlog::debug("Entidad destruida: {} (ID: {})", it->second, static_cast<uint32_t>(entity));
         m_EntityNames.erase(it);
     } else {
-        spdlog::trace("Entidad destruida: ID {}", static_cast<uint32_t>(entity));
+        SPDLOG_TRACE("Entidad destruida: ID {}", static_cast<uint32_t>(entity));
     }
 
     m_Registry.destroy(entity);
@@ -7,8 +7,14 @@
 
 #pragma once
 
+#include "Prefab.hpp"
 #include <entt/entt.hpp>
+#include <algorithm>
+#include <cassert>
+#include <iterator>
 #include <memory>
+#include <span>
+#include <type_traits>
 #include <spdlog/spdlog.h>
 
 namespace MultiNinjaEspacial::Core::ECS {
@@ -19,8 +25,15 @@ namespace MultiNinjaEspacial::Core::ECS {
  * Extiende EnTT con:
  * - Logging automático de creación/destrucción de entidades
  * - Factories para entidades comunes (Player, Enemy, etc.)
+ * - Instanciación en bloque de plantillas (Prefab)
  * - Helpers para debugging
  *
+ * Coste en Release: las comprobaciones de los accesos a componentes son
+ * assert (desaparecen con NDEBUG) y el log por componente usa SPDLOG_TRACE,
+ * que solo se compila en Debug (SPDLOG_ACTIVE_LEVEL, ver CMakeLists.txt).
+ * Un AddComponent queda en un emplace de EnTT. Para muchas entidades a la
+ * vez, AddComponents inserta en bloque.
+ *
  * Ejemplo de uso:
  * ```cpp
  * Registry registry;
@@ -61,6 +74,34 @@ public:
      */
     entt::entity CreateEntity(const std::string& name = "");
 
+    /**
+     * @brief Crea N copias de una plantilla
+     * @param prefab Plantilla con los componentes y sus valores
+     * @param count Número de entidades
+     * @return Entidades creadas, contiguas y en orden (válido hasta el
+     *         siguiente Instantiate)
+     *
+     * Crea las N entidades de una vez y, por cada componente de la
+     * plantilla, reserva su pool para las N y copia el valor en bloque.
+     */
+    std::span<const entt::entity> Instantiate(const Prefab& prefab, uint32_t count);
+
+    /**
+     * @brief Crea N copias de una plantilla y las personaliza
+     * @param override Invocable (entity, índice) llamado para cada copia
+     *                 después de crearlas todas (p. ej. para la posición)
+     *
+     * override no debe llamar a Instantiate (reutiliza el buffer devuelto).
+     */
+    template<typename Func>
+    std::span<const entt::entity> Instantiate(const Prefab& prefab, uint32_t count, Func&& override) {
+        const auto instances = Instantiate(prefab, count);
+        for (uint32_t i = 0; i < count; ++i) {
+            override(instances[i], i);
+        }
+        return instances;
+    }
+
     /**
      * @brief Destruye una entidad y todos sus componentes
      * @param entity Entidad a destruir
@@ -81,36 +122,97 @@ public:
      * @param entity Entidad objetivo
      * @param args Argumentos para construir el componente
      * @return Referencia al componente añadido
+     *
+     * La entidad tiene que ser válida (assert en Debug).
      */
     template<typename T, typename... Args>
     T& AddComponent(entt::entity entity, Args&&... args) {
-        if (!IsValid(entity)) {
-            spdlog::error("Registry::AddComponent - Entidad inválida");
-            throw std::runtime_error("Cannot add component to invalid entity");
-        }
+        assert(IsValid(entity) && "Registry::AddComponent - Entidad inválida");
 
-        spdlog::trace("Registry::AddComponent<{}> a entidad {}",
+        SPDLOG_TRACE("Registry::AddComponent<{}> a entidad {}",
                      typeid(T).name(), static_cast<uint32_t>(entity));
 
         return m_Registry.emplace<T>(entity, std::forward<Args>(args)...);
     }
 
+    /**
+     * @brief Añade el mismo componente a un rango de entidades
+     * @tparam T Tipo de componente
+     * @param first Inicio del rango de entidades
+     * @param last Fin del rango de entidades
+     * @param value Valor que se copia en cada una
+     *
+     * Una sola inserción en el pool (reserva una vez) en vez de un
+     * AddComponent por entidad.
+     *
+     * Ejemplo de uso:
+     * ```cpp
+     * std::vector<entt::entity> bullets(1000);
+     * registry.GetNative().create(bullets.begin(), bullets.end());
+     * registry.AddComponents<Velocity>(bullets.begin(), bullets.end(), Velocity{glm::vec2{0, -400}});
+     * ```
+     */
+    template<typename T, typename It>
+    void AddComponents(It first, It last, const T& value = {}) {
+        assert(std::all_of(first, last, [this](entt::entity entity) { return IsValid(entity); }) &&
+               "Registry::AddComponents - Entidad inválida");
+
+        SPDLOG_TRACE("Registry::AddComponents<{}> a {} entidades",
+                     typeid(T).name(), std::distance(first, last));
+
+        m_Registry.insert<T>(first, last, value);
+    }
+
+    /**
+     * @brief Añade a un rango de entidades un componente distinto a cada una
+     * @tparam T Tipo de componente
+     * @param first Inicio del rango de entidades
+     * @param last Fin del rango de entidades
+     * @param values Inicio de los valores (uno por entidad, en el mismo orden)
+     */
+    template<typename T, typename EntityIt, typename ValueIt>
+        requires std::is_same_v<typename std::iterator_traits<ValueIt>::value_type, T>
+    void AddComponents(EntityIt first, EntityIt last, ValueIt values) {
+        assert(std::all_of(first, last, [this](entt::entity entity) { return IsValid(entity); }) &&
+               "Registry::AddComponents - Entidad inválida");
+
+        SPDLOG_TRACE("Registry::AddComponents<{}> a {} entidades",
+                     typeid(T).name(), std::distance(first, last));
+
+        m_Registry.insert<T>(first, last, values);
+    }
+
     /**
      * @brief Obtiene un componente de una entidad
      * @tparam T Tipo de componente
      * @param entity Entidad objetivo
      * @return Referencia al componente
+     *
+     * La entidad tiene que tener el componente (assert en Debug); si puede
+     * no tenerlo, usar HasComponent antes.
      */
     template<typename T>
     T& GetComponent(entt::entity entity) {
-        if (!m_Registry.all_of<T>(entity)) {
-            spdlog::error("Registry::GetComponent - Entidad {} no tiene componente {}",
-                         static_cast<uint32_t>(entity), typeid(T).name());
-            throw std::runtime_error("Entity does not have component");
-        }
+        assert(m_Registry.all_of<T>(entity) && "Registry::GetComponent - La entidad no tiene el componente");
         return m_Registry.get<T>(entity);
     }
 
+    /**
+     * @brief Modifica un componente avisando a los observadores (on_update)
+     * @tparam T Tipo de componente
+     * @param entity Entidad objetivo
+     * @param func Función que recibe T& y lo modifica
+     * @return Referencia al componente
+     *
+     * Necesario para entidades Static: un cambio vía GetComponent no rehace
+     * su batch estático.
+     */
+    template<typename T, typename Func>
+    T& PatchComponent(entt::entity entity, Func&& func) {
+        assert(m_Registry.all_of<T>(entity) && "Registry::PatchComponent - La entidad no tiene el componente");
+        return m_Registry.patch<T>(entity, std::forward<Func>(func));
+    }
+
     /**
      * @brief Verifica si una entidad tiene un componente
      * @tparam T Tipo de componente
@@ -129,9 +231,9 @@ public:
      */
     template<typename T>
     void RemoveComponent(entt::entity entity) {
-        if (m_Registry.all_of<T>(entity)) {
-            m_Registry.remove<T>(entity);
-            spdlog::trace("Registry::RemoveComponent<{}> de entidad {}",
+        // remove de EnTT no hace nada si no lo tiene
+        if (m_Registry.remove<T>(entity) > 0) {
+            SPDLOG_TRACE("Registry::RemoveComponent<{}> de entidad {}",
                          typeid(T).name(), static_cast<uint32_t>(entity));
         }
     }
@@ -161,6 +263,9 @@ private:
 
     // Mapa de nombres de entidades (solo para debugging)
     std::unordered_map<entt::entity, std::string> m_EntityNames;
+
+    // Entidades del último Instantiate (se reutiliza entre llamadas)
+    std::vector<entt::entity> m_Instances;
 };
 
 } // namespace MultiNinjaEspacial::Core::ECS
@@ -0,0 +1,259 @@
+// ============================================================================
+// System Scheduler - Implementación
+// ============================================================================
+
+#include "SystemScheduler.hpp"
+#include <spdlog/spdlog.h>
+#include <algorithm>
+#include <chrono>
+#include <thread>
+
+namespace MultiNinjaEspacial::Core::ECS {
+
+namespace {
+
+using Clock = std::chrono::steady_clock;
+
+bool Intersects(const std::vector<entt::id_type>& a, const std::vector<entt::id_type>& b) {
+    return std::any_of(a.begin(), a.end(), [&](entt::id_type id) {
+        return std::find(b.begin(), b.end(), id) != b.end();
+    });
+}
+
+} // namespace
+
+// ============================================================================
+// SystemConfig
+// ============================================================================
+
+SystemScheduler::SystemConfig& SystemScheduler::SystemConfig::Structural() {
+    m_Scheduler->m_Systems[m_Index].structural = true;
+    m_Scheduler->m_GraphDirty = true;
+    return *this;
+}
+
+SystemScheduler::SystemConfig& SystemScheduler::SystemConfig::MainThread() {
+    m_Scheduler->m_Systems[m_Index].mainThread = true;
+    return *this;
+}
+
+// ============================================================================
+// SystemScheduler
+// ============================================================================
+
+SystemScheduler::SystemScheduler(Jobs::JobSystem& jobs) : m_Jobs(jobs) {
+}
+
+SystemScheduler::SystemConfig SystemScheduler::AddSystem(std::string name, UpdateFunction update) {
+    System system;
+    system.name = std::move(name);
+    system.update = std::move(update);
+    m_Systems.push_back(std::move(system));
+    m_GraphDirty = true;
+
+    return SystemConfig(this, static_cast<uint32_t>(m_Systems.size() - 1));
+}
+
+bool SystemScheduler::SetEnabled(std::string_view name, bool enabled) {
+    auto it = std::find_if(m_Systems.begin(), m_Systems.end(),
+                           [&](const System& system) { return system.name == name; });
+    if (it == m_Systems.end()) {
+        spdlog::warn("SystemScheduler: sistema '{}' no registrado", name);
+        return false;
+    }
+
+    if (it->enabled != enabled) {
+        it->enabled = enabled;
+        m_GraphDirty = true;
+    }
+    return true;
+}
+
+void SystemScheduler::AddAccess(uint32_t index, entt::id_type component, StorageFunction assure, bool write) {
+    auto& access = write ? m_Systems[index].writes : m_Systems[index].reads;
+    if (std::find(access.begin(), access.end(), component) == access.end()) {
+        access.push_back(component);
+    }
+
+    const bool known = std::any_of(m_Storages.begin(), m_Storages.end(),
+                                   [&](const auto& storage) { return storage.first == component; });
+    if (!known) {
+        m_Storages.emplace_back(component, assure);
+    }
+    m_GraphDirty = true;
+}
+
+bool SystemScheduler::Conflicts(const System& a, const System& b) {
+    if (a.structural || b.structural) {
+        return true;
+    }
+
+    // Escritura frente a lectura o escritura; lectura con lectura no choca
+    return Intersects(a.writes, b.writes) || Intersects(a.writes, b.reads) || Intersects(a.reads, b.writes);
+}
+
+/**
+ * @brief Reconstruye el DAG
+ *
+ * Arista i → j (i registrado antes que j) para cada par de sistemas activos
+ * que chocan. Sin reducción transitiva: con decenas de sistemas sobran
+ * aristas, no tiempo. El orden de registro es siempre un orden topológico
+ * válido (lo usa el modo en serie).
+ */
+void SystemScheduler::BuildGraph() {
+    for (auto& system : m_Systems) {
+        system.successors.clear();
+        system.predecessors = 0;
+    }
+
+    for (uint32_t j = 0; j < m_Systems.size(); ++j) {
+        if (!m_Systems[j].enabled) {
+            continue;
+        }
+        for (uint32_t i = 0; i < j; ++i) {
+            if (m_Systems[i].enabled && Conflicts(m_Systems[i], m_Systems[j])) {
+                m_Systems[i].successors.push_back(j);
+                m_Systems[j].predecessors++;
+            }
+        }
+    }
+
+    m_Pending.assign(m_Systems.size(), 0);
+    m_Timings.assign(m_Systems.size(), Timing{});
+    m_GraphDirty = false;
+}
+
+/**
+ * @brief Ejecuta un frame de sistemas
+ *
+ * Los sistemas sin dependencias salen como jobs y cada uno, al terminar,
+ * lanza a los sucesores que dependían solo de él. El hilo principal
+ * ejecuta los MainThread y, mientras tanto, jobs como un worker más. No
+ * vuelve hasta que han terminado todos: cuando Run retorna, ningún worker
+ * toca el registry.
+ */
+void SystemScheduler::Run(entt::registry& registry, float deltaTime) {
+    if (m_GraphDirty) {
+        BuildGraph();
+    }
+
+    // Pools creados aquí, en un solo hilo: si la primera view de un tipo la
+    // hicieran dos sistemas a la vez, los dos insertarían en el mapa de
+    // pools del registry
+    for (const auto& [component, assure] : m_Storages) {
+        assure(registry);
+    }
+
+    m_FrameRegistry = &registry;
+    m_FrameDeltaTime = deltaTime;
+    for (uint32_t i = 0; i < m_Systems.size(); ++i) {
+        m_Timings[i] = Timing{m_Systems[i].name};
+    }
+
+    // Sin workers: en serie, en orden de registro
+    if (m_Jobs.GetWorkerCount() == 0) {
+        for (uint32_t i = 0; i < m_Systems.size(); ++i) {
+            if (m_Systems[i].enabled) {
+                Execute(i);
+            }
+        }
+        return;
+    }
+
+    uint32_t remaining = 0;
+    for (uint32_t i = 0; i < m_Systems.size(); ++i) {
+        m_Pending[i] = m_Systems[i].predecessors;
+        remaining += m_Systems[i].enabled ? 1 : 0;
+    }
+    m_Remaining.store(remaining);
+
+    for (uint32_t i = 0; i < m_Systems.size(); ++i) {
+        if (m_Systems[i].enabled && m_Systems[i].predecessors == 0) {
+            Release(i);
+        }
+    }
+
+    while (m_Remaining.load(std::memory_order_acquire) > 0) {
+        std::unique_lock lock(m_Mutex);
+        if (!m_ReadyMain.empty()) {
+            const uint32_t index = m_ReadyMain.front();
+            m_ReadyMain.pop_front();
+            lock.unlock();
+            Execute(index);
+            continue;
+        }
+        lock.unlock();
+
+        if (!m_Jobs.TryRunJob()) {
+            std::this_thread::yield();
+        }
+    }
+
+    // Los jobs ya han ejecutado su sistema; esperar a que terminen de salir
+    m_Jobs.Wait(m_Counter);
+}
+
+void SystemScheduler::Release(uint32_t index) {
+    if (m_Systems[index].mainThread) {
+        std::lock_guard lock(m_Mutex);
+        m_ReadyMain.push_back(index);
+        return;
+    }
+
+    m_Jobs.Submit([](void* context, uint32_t begin, uint32_t) {
+        static_cast<SystemScheduler*>(context)->Execute(begin);
+    }, this, index, index + 1, m_Counter);
+}
+
+void SystemScheduler::Execute(uint32_t index) {
+    System& system = m_Systems[index];
+
+    const Clock::time_point start = Clock::now();
+    system.update(*m_FrameRegistry, m_FrameDeltaTime);
+
+    Timing& timing = m_Timings[index];
+    timing.milliseconds = std::chrono::duration<float, std::milli>(Clock::now() - start).count();
+    timing.thread = m_Jobs.GetCurrentThreadIndex();
+    timing.ran = true;
+
+    if (m_Jobs.GetWorkerCount() == 0) {
+        return;
+    }
+
+    for (uint32_t successor : system.successors) {
+        bool ready = false;
+        {
+            std::lock_guard lock(m_Mutex);
+            ready = --m_Pending[successor] == 0;
+        }
+        if (ready) {
+            Release(successor);
+        }
+    }
+
+    // Después de lanzar a los sucesores: Run no puede ver 0 antes de tiempo
+    m_Remaining.fetch_sub(1, std::memory_order_release);
+}
+
+std::vector<std::string_view> SystemScheduler::GetDependencies(std::string_view name) {
+    if (m_GraphDirty) {
+        BuildGraph();
+    }
+
+    std::vector<std::string_view> dependencies;
+    auto it = std::find_if(m_Systems.begin(), m_Systems.end(),
+                           [&](const System& system) { return system.name == name; });
+    if (it == m_Systems.end()) {
+        return dependencies;
+    }
+
+    const auto index = static_cast<uint32_t>(it - m_Systems.begin());
+    for (const System& system : m_Systems) {
+        if (std::find(system.successors.begin(), system.successors.end(), index) != system.successors.end()) {
+            dependencies.push_back(system.name);
+        }
+    }
+    return dependencies;
+}
+
+} // namespace MultiNinjaEspacial::Core::ECS
@@ -0,0 +1,252 @@
+// ============================================================================
+// System Scheduler - Ejecución paralela de sistemas
+// ============================================================================
+// Cada sistema declara qué componentes lee y escribe; los que no chocan se
+// ejecutan a la vez como jobs del JobSystem
+// ============================================================================
+
+#pragma once
+
+#include "../jobs/JobSystem.hpp"
+#include <entt/entt.hpp>
+#include <atomic>
+#include <cstdint>
+#include <deque>
+#include <functional>
+#include <mutex>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+namespace MultiNinjaEspacial::Core::ECS {
+
+/**
+ * @brief Planificador de sistemas con dependencias por componentes
+ *
+ * Cada sistema se registra con los componentes que lee y los que escribe.
+ * Dos sistemas chocan si uno escribe algo que el otro lee o escribe; entre
+ * dos sistemas que chocan manda el orden de registro. Con eso se construye
+ * un DAG (se rehace solo cuando cambian los sistemas) y Run:
+ * 1. Lanza los sistemas sin dependencias pendientes como jobs (el hilo
+ *    principal también trabaja)
+ * 2. Al terminar uno, lanza los que dependían solo de él
+ * 3. Vuelve cuando han terminado todos: punto de sincronización, después
+ *    ya se puede dibujar o tocar el registry libremente
+ *
+ * Reglas para los sistemas:
+ * - Solo pueden tocar los componentes declarados. Varias views de lectura
+ *   sobre el mismo pool a la vez son seguras en EnTT; escribir un pool
+ *   mientras otro hilo lo recorre no.
+ * - Run crea antes de lanzar nada (en el hilo que llama) los pools de
+ *   todos los componentes declarados: la primera view o emplace de un tipo
+ *   registra su pool en el registry, y eso no puede pasar en dos hilos a
+ *   la vez.
+ * - Crear o destruir entidades cambia todos los pools: declarar
+ *   Structural() (el sistema se ejecuta solo, sin nadie en paralelo).
+ * - Lo que use SDL, OpenGL o estado del hilo principal: MainThread().
+ *
+ * Los sistemas comparten los hilos del JobSystem con sus propios jobs: un
+ * sistema puede usar ParallelEach y, mientras espera, su hilo ejecuta
+ * trozos suyos o de otros sistemas.
+ *
+ * Cada Run mide cuánto tarda cada sistema y en qué hilo corrió
+ * (GetTimings), para el log de rendimiento de GameLoop.
+ *
+ * Ejemplo de uso:
+ * ```cpp
+ * Jobs::JobSystem jobs;
+ * SystemScheduler scheduler(jobs);
+ *
+ * scheduler.AddSystem("Movement", &MovementSystem::Update)
+ *     .Reads<Velocity>()
+ *     .Writes<Transform>();
+ * scheduler.AddSystem("AI", [](entt::registry& r, float dt) { ... })
+ *     .Reads<Transform>()
+ *     .Writes<Velocity>();
+ *
+ * // Cada paso fijo
+ * scheduler.Run(registry, dt);
+ * ```
+ */
+class SystemScheduler {
+public:
+    using UpdateFunction = std::function<void(entt::registry&, float)>;
+
+    /**
+     * @brief Tiempo de un sistema en el último Run
+     */
+    struct Timing {
+        std::string_view name;
+        float milliseconds{0.0f};
+        uint32_t thread{0};         // 0 = hilo principal, 1..N = worker
+        bool ran{false};            // false si estaba desactivado
+    };
+
+    /**
+     * @brief Configuración de un sistema recién añadido (encadenable)
+     */
+    class SystemConfig {
+    public:
+        /**
+         * @brief Componentes que el sistema solo lee
+         */
+        template<typename... Components>
+        SystemConfig& Reads() {
+            (m_Scheduler->AddAccess(m_Index, entt::type_hash<Components>::value(), &AssureStorage<Components>, false), ...);
+            return *this;
+        }
+
+        /**
+         * @brief Componentes que el sistema modifica
+         */
+        template<typename... Components>
+        SystemConfig& Writes() {
+            (m_Scheduler->AddAccess(m_Index, entt::type_hash<Components>::value(), &AssureStorage<Components>, true), ...);
+            return *this;
+        }
+
+        /**
+         * @brief El sistema crea o destruye entidades: se ejecuta solo
+         */
+        SystemConfig& Structural();
+
+        /**
+         * @brief El sistema solo puede ejecutarse en el hilo principal
+         */
+        SystemConfig& MainThread();
+
+    private:
+        friend class SystemScheduler;
+        SystemConfig(SystemScheduler* scheduler, uint32_t index) : m_Scheduler(scheduler), m_Index(index) {}
+
+        SystemScheduler* m_Scheduler;
+        uint32_t m_Index;
+    };
+
+    /**
+     * @brief Constructor
+     * @param jobs Sistema de jobs donde se ejecutan los sistemas (sin
+     *             workers, todo en serie en el hilo principal)
+     */
+    explicit SystemScheduler(Jobs::JobSystem& jobs);
+
+    SystemScheduler(const SystemScheduler&) = delete;
+    SystemScheduler& operator=(const SystemScheduler&) = delete;
+
+    /**
+     * @brief Registra un sistema
+     * @param name Nombre (métricas y SetEnabled)
+     * @param update Función a ejecutar en cada Run
+     * @return Configuración para declarar sus accesos
+     */
+    SystemConfig AddSystem(std::string name, UpdateFunction update);
+
+    /**
+     * @brief Activa o desactiva un sistema
+     * @return false si no existe
+     */
+    bool SetEnabled(std::string_view name, bool enabled);
+
+    /**
+     * @brief Ejecuta todos los sistemas activos y espera a que terminen
+     * @param registry Registro de EnTT
+     * @param deltaTime Paso de simulación en segundos
+     *
+     * Llamar siempre desde el mismo hilo (el principal).
+     */
+    void Run(entt::registry& registry, float deltaTime);
+
+    /**
+     * @brief Sistemas de los que depende otro (directamente)
+     * @param name Nombre del sistema
+     * @return Nombres, en orden de registro (vacío si no existe)
+     */
+    [[nodiscard]] std::vector<std::string_view> GetDependencies(std::string_view name);
+
+    /**
+     * @brief Tiempos del último Run, en orden de registro
+     */
+    [[nodiscard]] const std::vector<Timing>& GetTimings() const { return m_Timings; }
+
+    [[nodiscard]] uint32_t GetWorkerCount() const { return m_Jobs.GetWorkerCount(); }
+    [[nodiscard]] size_t GetSystemCount() const { return m_Systems.size(); }
+
+private:
+    /**
+     * @brief Sistema registrado
+     */
+    struct System {
+        std::string name;
+        UpdateFunction update;
+        std::vector<entt::id_type> reads;
+        std::vector<entt::id_type> writes;
+        bool structural{false};
+        bool mainThread{false};
+        bool enabled{true};
+
+        // DAG (solo sistemas activos)
+        std::vector<uint32_t> successors;
+        uint32_t predecessors{0};
+    };
+
+    using StorageFunction = void (*)(entt::registry&);
+
+    /**
+     * @brief Crea el pool de un componente si aún no existe
+     */
+    template<typename Component>
+    static void AssureStorage(entt::registry& registry) {
+        static_cast<void>(registry.storage<Component>());
+    }
+
+    /**
+     * @brief Añade un componente a las lecturas o escrituras de un sistema
+     * @param assure Crea su pool (se llama en Run, antes de repartir)
+     */
+    void AddAccess(uint32_t index, entt::id_type component, StorageFunction assure, bool write);
+
+    /**
+     * @brief Indica si dos sistemas no pueden ejecutarse a la vez
+     */
+    [[nodiscard]] static bool Conflicts(const System& a, const System& b);
+
+    /**
+     * @brief Reconstruye el DAG de los sistemas activos
+     */
+    void BuildGraph();
+
+    /**
+     * @brief Lanza un sistema sin dependencias pendientes
+     *
+     * Como job, o a la cola del hilo principal si es MainThread.
+     */
+    void Release(uint32_t index);
+
+    /**
+     * @brief Ejecuta un sistema, mide su tiempo y libera a sus sucesores
+     */
+    void Execute(uint32_t index);
+
+    Jobs::JobSystem& m_Jobs;
+
+    std::vector<System> m_Systems;
+    std::vector<Timing> m_Timings;
+    bool m_GraphDirty{true};
+
+    // Pools de todos los componentes declarados (sin repetir)
+    std::vector<std::pair<entt::id_type, StorageFunction>> m_Storages;
+
+    // Frame en curso
+    entt::registry* m_FrameRegistry{nullptr};
+    float m_FrameDeltaTime{0.0f};
+
+    // Estado del Run
+    std::vector<uint32_t> m_Pending;        // Dependencias sin terminar por sistema (m_Mutex)
+    std::deque<uint32_t> m_ReadyMain;       // Listos para el hilo principal (m_Mutex)
+    std::mutex m_Mutex;
+    std::atomic<uint32_t> m_Remaining{0};   // Sistemas sin terminar
+    Jobs::JobCounter m_Counter;             // Jobs de sistemas en vuelo
+};
+
+} // namespace MultiNinjaEspacial::Core::ECS
@@ -0,0 +1,168 @@
+// ============================================================================
+// Job System - Implementación
+// ============================================================================
+
+#include "JobSystem.hpp"
+#include <spdlog/spdlog.h>
+
+namespace MultiNinjaEspacial::Core::Jobs {
+
+namespace {
+
+// Worker actual: sistema al que pertenece e índice de su cola. Los hilos
+// externos (o workers de otro JobSystem) usan la cola 0
+thread_local const JobSystem* t_Owner = nullptr;
+thread_local uint32_t t_Index = 0;
+
+} // namespace
+
+JobSystem::JobSystem(uint32_t workerCount) {
+    m_Queues.reserve(workerCount + 1);
+    for (uint32_t i = 0; i <= workerCount; ++i) {
+        m_Queues.push_back(std::make_unique<Queue>());
+    }
+
+    m_Workers.reserve(workerCount);
+    for (uint32_t i = 0; i < workerCount; ++i) {
+        m_Workers.emplace_back(&JobSystem::WorkerLoop, this, i + 1);
+    }
+    spdlog::info("JobSystem: {} workers + hilo principal", workerCount);
+}
+
+JobSystem::~JobSystem() {
+    {
+        std::lock_guard lock(m_SleepMutex);
+        m_Stop = true;
+    }
+    m_Wake.notify_all();
+
+    for (auto& worker : m_Workers) {
+        worker.join();
+    }
+}
+
+uint32_t JobSystem::DefaultWorkerCount() {
+    const uint32_t cores = std::thread::hardware_concurrency();
+    return cores > 1 ? cores - 1 : 0;
+}
+
+uint32_t JobSystem::GetCurrentThreadIndex() const {
+    return t_Owner == this ? t_Index : 0;
+}
+
+void JobSystem::Submit(JobFunction function, void* context, uint32_t begin, uint32_t end, JobCounter& counter) {
+    Push(Job{function, context, begin, end, &counter});
+    WakeWorkers();
+}
+
+void JobSystem::Push(const Job& job) {
+    job.counter->m_Pending.fetch_add(1, std::memory_order_relaxed);
+
+    // Antes de encolar: m_Queued nunca baja de 0 aunque lo roben al momento
+    m_Queued.fetch_add(1);
+
+    Queue& queue = *m_Queues[GetCurrentThreadIndex()];
+    std::lock_guard lock(queue.mutex);
+    queue.jobs.push_back(job);
+}
+
+/**
+ * @brief Despierta a los workers dormidos
+ *
+ * m_Queued se incrementa antes de leer m_Sleeping y el worker incrementa
+ * m_Sleeping antes de comprobar m_Queued (ambos seq_cst): al menos uno de
+ * los dos ve al otro, así que nunca se duerme con trabajo en cola.
+ */
+void JobSystem::WakeWorkers() {
+    if (m_Sleeping.load() == 0) {
+        return;
+    }
+
+    {
+        std::lock_guard lock(m_SleepMutex);
+    }
+    m_Wake.notify_all();
+}
+
+bool JobSystem::Pop(uint32_t self, Job& job) {
+    if (m_Queued.load(std::memory_order_relaxed) == 0) {
+        return false;
+    }
+
+    // Propia: LIFO (lo último publicado está aún en caché)
+    {
+        Queue& queue = *m_Queues[self];
+        std::lock_guard lock(queue.mutex);
+        if (!queue.jobs.empty()) {
+            job = queue.jobs.back();
+            queue.jobs.pop_back();
+            m_Queued.fetch_sub(1);
+            return true;
+        }
+    }
+
+    // Robo: FIFO, empezando por la cola siguiente para repartir los robos
+    const auto count = static_cast<uint32_t>(m_Queues.size());
+    for (uint32_t offset = 1; offset < count; ++offset) {
+        Queue& victim = *m_Queues[(self + offset) % count];
+        std::unique_lock lock(victim.mutex, std::try_to_lock);
+        if (lock.owns_lock() && !victim.jobs.empty()) {
+            job = victim.jobs.front();
+            victim.jobs.pop_front();
+            m_Queued.fetch_sub(1);
+            return true;
+        }
+    }
+    return false;
+}
+
+void JobSystem::Execute(const Job& job) {
+    job.function(job.context, job.begin, job.end);
+    job.counter->m_Pending.fetch_sub(1, std::memory_order_release);
+}
+
+bool JobSystem::TryRunJob() {
+    Job job;
+    if (!Pop(GetCurrentThreadIndex(), job)) {
+        return false;
+    }
+    Execute(job);
+    return true;
+}
+
+void JobSystem::Wait(const JobCounter& counter) {
+    while (!counter.IsDone()) {
+        if (!TryRunJob()) {
+            // Lo que falta lo está ejecutando otro hilo
+            std::this_thread::yield();
+        }
+    }
+}
+
+void JobSystem::WorkerLoop(uint32_t index) {
+    t_Owner = this;
+    t_Index = index;
+
+    uint32_t idle = 0;
+    while (!m_Stop.load(std::memory_order_relaxed)) {
+        Job job;
+        if (Pop(index, job)) {
+            Execute(job);
+            idle = 0;
+            continue;
+        }
+
+        if (++idle < IDLE_SPINS) {
+            std::this_thread::yield();
+            continue;
+        }
+
+        std::unique_lock lock(m_SleepMutex);
+        m_Sleeping.fetch_add(1);
+        m_Wake.wait(lock, [this] { return m_Stop.load() || m_Queued.load() > 0; });
+        m_Sleeping.fetch_sub(1);
+        idle = 0;
+    }
+}
+
+} // namespace MultiNinjaEspacial::Core::Jobs
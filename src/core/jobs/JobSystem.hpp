@@ -0,0 +1,227 @@
+// ============================================================================
+// Job System - Trabajo en paralelo con work stealing
+// ============================================================================
+// Pool de hilos con una cola por hilo: cada hilo saca de la suya y, si se
+// queda sin trabajo, roba de las demás
+// ============================================================================
+
+#pragma once
+
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <type_traits>
+#include <vector>
+
+namespace MultiNinjaEspacial::Core::Jobs {
+
+/**
+ * @brief Contador de trabajos pendientes (para esperar a un grupo de jobs)
+ *
+ * Cada Submit lo incrementa y cada job terminado lo decrementa. Tiene que
+ * vivir hasta que JobSystem::Wait vuelva.
+ */
+class JobCounter {
+public:
+    [[nodiscard]] bool IsDone() const { return m_Pending.load(std::memory_order_acquire) == 0; }
+    [[nodiscard]] uint32_t GetPending() const { return m_Pending.load(std::memory_order_acquire); }
+
+private:
+    friend class JobSystem;
+    std::atomic<uint32_t> m_Pending{0};
+};
+
+/**
+ * @brief Sistema de jobs con work stealing
+ *
+ * - Una cola por hilo (los workers y una más para los hilos externos, el
+ *   principal). Quien publica un job lo deja en su cola; el dueño saca del
+ *   final (lo último publicado, aún en caché) y los demás roban del
+ *   principio (los trozos más grandes de trabajo pendiente).
+ * - Un job es una función, un contexto y un rango [begin, end): sin
+ *   std::function ni memoria por job, así que sirve para trocear bucles
+ *   (ParallelFor, ParallelEach).
+ * - Wait no bloquea el hilo: ejecuta jobs (propios o robados) hasta que el
+ *   contador llega a 0. El hilo principal participa así en su propio
+ *   trabajo.
+ * - Los workers sin trabajo ceden la CPU un rato y después duermen hasta
+ *   que se publique algo.
+ *
+ * Los jobs no deben bloquearse esperando a otros hilos (salvo con Wait).
+ *
+ * Ejemplo de uso:
+ * ```cpp
+ * JobSystem jobs;   // núcleos - 1 workers
+ *
+ * // Bucle troceado: [0, 100000) en trozos de 1024
+ * jobs.ParallelFor(100000, 1024, [&](uint32_t begin, uint32_t end) {
+ *     for (uint32_t i = begin; i < end; ++i) {
+ *         positions[i] += velocities[i] * dt;
+ *     }
+ * });
+ *
+ * // Tareas sueltas
+ * JobCounter counter;
+ * jobs.Submit(loadLevel, counter);
+ * jobs.Submit(buildNavMesh, counter);
+ * jobs.Wait(counter);
+ * ```
+ */
+class JobSystem {
+public:
+    using JobFunction = void (*)(void* context, uint32_t begin, uint32_t end);
+
+    // Intentos de buscar trabajo (con yield) antes de que un worker duerma
+    static constexpr uint32_t IDLE_SPINS = 64;
+
+    /**
+     * @brief Constructor
+     * @param workerCount Hilos del pool (0 = todo en el hilo que llama)
+     */
+    explicit JobSystem(uint32_t workerCount = DefaultWorkerCount());
+
+    /**
+     * @brief Destructor: espera a que los workers terminen su job y los para
+     *
+     * Los jobs aún en cola se descartan: esperar antes a sus contadores.
+     */
+    ~JobSystem();
+
+    JobSystem(const JobSystem&) = delete;
+    JobSystem& operator=(const JobSystem&) = delete;
+
+    /**
+     * @brief Publica un job
+     * @param function Función a ejecutar
+     * @param context Datos de la función (tienen que vivir hasta Wait)
+     * @param begin Inicio del rango
+     * @param end Fin del rango (exclusivo)
+     * @param counter Contador que se decrementa al terminar
+     */
+    void Submit(JobFunction function, void* context, uint32_t begin, uint32_t end, JobCounter& counter);
+
+    /**
+     * @brief Publica una tarea: task() en otro hilo
+     * @param task Invocable sin argumentos (tiene que vivir hasta Wait)
+     */
+    template<typename Task>
+    void Submit(Task& task, JobCounter& counter) {
+        Submit([](void* context, uint32_t, uint32_t) { (*static_cast<Task*>(context))(); },
+               const_cast<std::remove_const_t<Task>*>(&task), 0, 0, counter);
+    }
+
+    /**
+     * @brief Ejecuta jobs hasta que el contador llegue a 0
+     */
+    void Wait(const JobCounter& counter);
+
+    /**
+     * @brief Ejecuta un job pendiente si hay alguno (propio o robado)
+     * @return false si no había trabajo
+     */
+    bool TryRunJob();
+
+    /**
+     * @brief Bucle troceado en paralelo; vuelve cuando ha terminado
+     * @param count Número de elementos
+     * @param chunkSize Elementos por job
+     * @param body Invocable (begin, end); se llama a la vez desde varios hilos
+     *
+     * Con un solo trozo (o sin workers) se ejecuta directamente en el hilo
+     * que llama, sin pasar por las colas.
+     */
+    template<typename Body>
+    void ParallelFor(uint32_t count, uint32_t chunkSize, Body&& body) {
+        if (count == 0) {
+            return;
+        }
+        chunkSize = chunkSize > 0 ? chunkSize : 1;
+        if (count <= chunkSize || m_Workers.empty()) {
+            body(0u, count);
+            return;
+        }
+
+        using BodyType = std::remove_reference_t<Body>;
+        auto* context = const_cast<std::remove_const_t<BodyType>*>(&body);
+        const JobFunction function = [](void* data, uint32_t begin, uint32_t end) {
+            (*static_cast<BodyType*>(data))(begin, end);
+        };
+
+        JobCounter counter;
+        for (uint32_t begin = 0; begin < count; begin += chunkSize) {
+            const uint32_t end = count - begin > chunkSize ? begin + chunkSize : count;
+            Push(Job{function, context, begin, end, &counter});
+        }
+        WakeWorkers();
+        Wait(counter);
+    }
+
+    [[nodiscard]] uint32_t GetWorkerCount() const { return static_cast<uint32_t>(m_Workers.size()); }
+
+    /**
+     * @brief Hilo actual: 0 = externo (principal), 1..N = worker de este sistema
+     */
+    [[nodiscard]] uint32_t GetCurrentThreadIndex() const;
+
+    /**
+     * @brief Núcleos disponibles - 1 (el hilo principal también trabaja)
+     */
+    [[nodiscard]] static uint32_t DefaultWorkerCount();
+
+private:
+    /**
+     * @brief Trabajo en cola
+     */
+    struct Job {
+        JobFunction function;
+        void* context;
+        uint32_t begin;
+        uint32_t end;
+        JobCounter* counter;
+    };
+
+    /**
+     * @brief Cola de un hilo (en su propia línea de caché)
+     */
+    struct alignas(64) Queue {
+        std::mutex mutex;
+        std::deque<Job> jobs;
+    };
+
+    /**
+     * @brief Encola un job en la cola del hilo actual (sin despertar a nadie)
+     */
+    void Push(const Job& job);
+
+    /**
+     * @brief Despierta a los workers dormidos si hay trabajo
+     */
+    void WakeWorkers();
+
+    /**
+     * @brief Saca un job: de la cola propia (final) o robado (principio)
+     */
+    bool Pop(uint32_t self, Job& job);
+
+    /**
+     * @brief Ejecuta un job y decrementa su contador
+     */
+    static void Execute(const Job& job);
+
+    void WorkerLoop(uint32_t index);
+
+    std::vector<std::unique_ptr<Queue>> m_Queues;   // [0] = hilos externos
+    std::vector<std::thread> m_Workers;
+
+    std::atomic<uint32_t> m_Queued{0};      // Jobs en cola (todas las colas)
+    std::atomic<uint32_t> m_Sleeping{0};    // Workers dormidos
+    std::atomic<bool> m_Stop{false};
+    std::mutex m_SleepMutex;
+    std::condition_variable m_Wake;
+};
+
+} // namespace MultiNinjaEspacial::Core::Jobs
@@ -0,0 +1,76 @@
+// ============================================================================
+// ParallelEach - Recorrido en paralelo de views y groups de EnTT
+// ============================================================================
+
+#pragma once
+
+#include "JobSystem.hpp"
+#include <entt/entt.hpp>
+#include <cstdint>
+#include <tuple>
+#include <type_traits>
+
+namespace MultiNinjaEspacial::Core::Jobs {
+
+// Entidades por job: con Transform + Velocity (~32 bytes por entidad) un
+// trozo ocupa ~32 KB, lo que cabe en la L1 de datos de un núcleo
+constexpr uint32_t DEFAULT_CHUNK_SIZE = 1024;
+
+namespace Detail {
+
+/**
+ * @brief Storage que recorre la view (views: puntero, groups: referencia)
+ */
+template<typename View>
+const auto& LeadingStorage(const View& view) {
+    if constexpr (std::is_pointer_v<decltype(view.handle())>) {
+        return *view.handle();
+    } else {
+        return view.handle();
+    }
+}
+
+} // namespace Detail
+
+/**
+ * @brief Ejecuta func(entity, componentes...) en paralelo sobre una view
+ * @param jobs Sistema de jobs
+ * @param view View o group de EnTT
+ * @param func Invocable (entity, Componente&...); se llama a la vez desde
+ *             varios hilos, nunca dos veces con la misma entidad
+ * @param chunkSize Entidades por job
+ *
+ * Trocea el array de entidades del storage que recorre la view (el mismo
+ * orden en que están los componentes en memoria) y cada job comprueba
+ * contains() para saltarse las que no cumplen la view. Vuelve cuando se
+ * han procesado todas.
+ *
+ * func solo puede modificar los componentes de su entidad: nada de crear o
+ * destruir entidades ni añadir o quitar componentes durante el recorrido.
+ *
+ * Ejemplo de uso:
+ * ```cpp
+ * auto view = registry.view<Transform, Velocity>();
+ * ParallelEach(jobs, view, [dt](entt::entity, Transform& t, Velocity& v) {
+ *     t.position += v.linear * dt;
+ * });
+ * ```
+ */
+template<typename View, typename Func>
+void ParallelEach(JobSystem& jobs, const View& view, Func&& func, uint32_t chunkSize = DEFAULT_CHUNK_SIZE) {
+    const auto& storage = Detail::LeadingStorage(view);
+    const auto* entities = storage.data();
+    const auto count = static_cast<uint32_t>(storage.size());
+
+    jobs.ParallelFor(count, chunkSize, [&](uint32_t begin, uint32_t end) {
+        for (uint32_t i = begin; i < end; ++i) {
+            const entt::entity entity = entities[i];
+            if (!view.contains(entity)) {
+                continue;
+            }
+            std::apply([&](auto&... components) { func(entity, components...); }, view.get(entity));
+        }
+    });
+}
+
+} // namespace MultiNinjaEspacial::Core::Jobs
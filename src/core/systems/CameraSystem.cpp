@@ -0,0 +1,110 @@
+// ============================================================================
+// Camera System - Sistema de Cámaras
+// ============================================================================
+// Calcula la vista de cada cámara: viewport, zona visible y matriz
+// Opera sobre: Camera
+// ============================================================================
+
+#include "CameraSystem.hpp"
+#include "../components/Camera.hpp"
+#include <glm/gtc/matrix_transform.hpp>
+#include <algorithm>
+#include <cmath>
+#include <spdlog/spdlog.h>
+
+namespace MultiNinjaEspacial::Core::Systems {
+
+/**
+ * @brief Recalcula las vistas de las cámaras
+ * @param registry Registro de EnTT
+ * @param screenSize Tamaño de la ventana en píxeles
+ *
+ * Con pixelSnap se ajusta la esquina superior izquierda de la zona visible
+ * (no el centro): con viewports de tamaño impar el centro cae entre dos
+ * píxeles y ajustarlo dejaría los sprites a medio píxel.
+ */
+void CameraSystem::Update(entt::registry& registry, const glm::vec2& screenSize) {
+    m_Views.clear();
+
+    auto view = registry.view<Components::Camera>();
+    for (auto entity : view) {
+        auto& camera = view.get<Components::Camera>(entity);
+
+        // Viewport en píxeles enteros (los bordes de cámaras vecinas coinciden)
+        const int x0 = static_cast<int>(std::lround(camera.viewport.x * screenSize.x));
+        const int y0 = static_cast<int>(std::lround(camera.viewport.y * screenSize.y));
+        const int x1 = static_cast<int>(std::lround((camera.viewport.x + camera.viewport.z) * screenSize.x));
+        const int y1 = static_cast<int>(std::lround((camera.viewport.y + camera.viewport.w) * screenSize.y));
+        const glm::ivec4 viewport{x0, y0, x1 - x0, y1 - y0};
+
+        const float zoom = camera.zoom > 0.0f ? camera.zoom : 1.0f;
+        const glm::vec2 halfExtent = 0.5f * glm::vec2{static_cast<float>(viewport.z),
+                                                      static_cast<float>(viewport.w)} / zoom;
+
+        glm::vec2 visibleMin = camera.position - halfExtent;
+        if (camera.pixelSnap) {
+            visibleMin = SnapToPixel(visibleMin, zoom);
+        }
+        const glm::vec2 visibleMax = visibleMin + 2.0f * halfExtent;
+
+        // Mismo convenio que la proyección de pantalla: y = 0 arriba
+        camera.visibleMin = visibleMin;
+        camera.visibleMax = visibleMax;
+        camera.viewProjection = glm::ortho(visibleMin.x, visibleMax.x, visibleMax.y, visibleMin.y, -1.0f, 1.0f);
+
+        if (!camera.active || viewport.z <= 0 || viewport.w <= 0) {
+            continue;
+        }
+
+        m_Views.push_back(View{entity, camera.viewProjection, visibleMin, visibleMax, viewport,
+                               zoom, camera.order});
+    }
+
+    // Orden de dibujo estable: a igual order, el orden de la view
+    std::stable_sort(m_Views.begin(), m_Views.end(),
+                     [](const View& a, const View& b) { return a.order < b.order; });
+
+    if (m_Views.size() > MAX_CAMERAS) {
+        spdlog::warn("CameraSystem: {} cámaras activas, solo se usan las {} primeras",
+                     m_Views.size(), MAX_CAMERAS);
+        m_Views.resize(MAX_CAMERAS);
+    }
+}
+
+bool CameraSystem::IsVisible(const glm::vec2& min, const glm::vec2& max) const {
+    return std::any_of(m_Views.begin(), m_Views.end(), [&](const View& view) {
+        return max.x >= view.visibleMin.x && min.x <= view.visibleMax.x &&
+               max.y >= view.visibleMin.y && min.y <= view.visibleMax.y;
+    });
+}
+
+bool CameraSystem::GetVisibleUnion(glm::vec2& min, glm::vec2& max) const {
+    if (m_Views.empty()) {
+        return false;
+    }
+
+    min = m_Views.front().visibleMin;
+    max = m_Views.front().visibleMax;
+    for (const View& view : m_Views) {
+        min = glm::min(min, view.visibleMin);
+        max = glm::max(max, view.visibleMax);
+    }
+    return true;
+}
+
+glm::vec2 CameraSystem::ScreenToWorld(const View& view, const glm::vec2& screen) {
+    const glm::vec2 local = screen - glm::vec2{static_cast<float>(view.viewport.x),
+                                               static_cast<float>(view.viewport.y)};
+    return view.visibleMin + local / view.zoom;
+}
+
+glm::vec2 CameraSystem::WorldToScreen(const View& view, const glm::vec2& world) {
+    return glm::vec2{static_cast<float>(view.viewport.x), static_cast<float>(view.viewport.y)} +
+           (world - view.visibleMin) * view.zoom;
+}
+
+glm::vec2 CameraSystem::SnapToPixel(const glm::vec2& world, float zoom) {
+    return glm::round(world * zoom) / zoom;
+}
+
+} // namespace MultiNinjaEspacial::Core::Systems
@@ -0,0 +1,108 @@
+// ============================================================================
+// Camera System - Header
+// ============================================================================
+
+#pragma once
+
+#include <entt/entt.hpp>
+#include <glm/glm.hpp>
+#include <cstdint>
+#include <vector>
+
+namespace MultiNinjaEspacial::Core::Systems {
+
+/**
+ * @brief Sistema que calcula las vistas de las entidades con Camera
+ *
+ * Cada frame (antes de dibujar):
+ * 1. Convierte el viewport de cada cámara a píxeles de la ventana
+ * 2. Calcula el rectángulo visible del mundo (ajustado a píxeles si
+ *    pixelSnap) y la matriz view-projection
+ * 3. Guarda las cámaras activas ordenadas por order
+ *
+ * RenderSystem usa las vistas para descartar lo que no ve ninguna cámara
+ * antes de construir los sprites, y para dibujar cada cámara con su
+ * viewport. Cualquier otro sistema puede preguntar si una zona del mundo es
+ * visible (IsVisible) o convertir coordenadas de pantalla (ratón) al mundo.
+ *
+ * Ejemplo de uso:
+ * ```cpp
+ * CameraSystem cameras;
+ *
+ * // En GameLoop::Render(), antes de RenderSystem
+ * cameras.Update(registry, {windowWidth, windowHeight});
+ * renderSystem.Render(registry, renderer, cameras);
+ *
+ * // Clic del ratón → mundo
+ * glm::vec2 world = CameraSystem::ScreenToWorld(cameras.GetViews()[0], mouse);
+ * ```
+ */
+class CameraSystem {
+public:
+    // Cámaras simultáneas (RenderSystem usa una máscara de 32 bits por sprite)
+    static constexpr uint32_t MAX_CAMERAS = 32;
+
+    /**
+     * @brief Vista resuelta de una cámara activa
+     */
+    struct View {
+        entt::entity entity{entt::null};
+        glm::mat4 viewProjection{1.0f};
+        glm::vec2 visibleMin{0.0f, 0.0f};   // Rectángulo visible (mundo)
+        glm::vec2 visibleMax{0.0f, 0.0f};
+        glm::ivec4 viewport{0, 0, 0, 0};    // x, y, ancho, alto (píxeles, y desde arriba)
+        float zoom{1.0f};
+        int order{0};
+    };
+
+    /**
+     * @brief Recalcula todas las cámaras
+     * @param registry Registro de EnTT
+     * @param screenSize Tamaño de la ventana en píxeles
+     */
+    void Update(entt::registry& registry, const glm::vec2& screenSize);
+
+    /**
+     * @brief Cámaras activas del último Update, en orden de dibujo
+     */
+    [[nodiscard]] const std::vector<View>& GetViews() const { return m_Views; }
+
+    /**
+     * @brief Indica si un rectángulo del mundo lo ve alguna cámara
+     * @param min Esquina mínima (mundo)
+     * @param max Esquina máxima (mundo)
+     */
+    [[nodiscard]] bool IsVisible(const glm::vec2& min, const glm::vec2& max) const;
+
+    /**
+     * @brief Rectángulo que cubre todo lo visible por alguna cámara
+     * @return false si no hay cámaras activas
+     */
+    [[nodiscard]] bool GetVisibleUnion(glm::vec2& min, glm::vec2& max) const;
+
+    /**
+     * @brief Convierte un punto de la ventana a coordenadas del mundo
+     * @param view Vista de la cámara
+     * @param screen Píxel de la ventana (y desde arriba)
+     */
+    [[nodiscard]] static glm::vec2 ScreenToWorld(const View& view, const glm::vec2& screen);
+
+    /**
+     * @brief Convierte un punto del mundo a píxeles de la ventana
+     * @param view Vista de la cámara
+     * @param world Punto del mundo
+     */
+    [[nodiscard]] static glm::vec2 WorldToScreen(const View& view, const glm::vec2& world);
+
+    /**
+     * @brief Ajusta un punto del mundo al píxel de pantalla más cercano
+     * @param world Punto del mundo
+     * @param zoom Píxeles por unidad del mundo
+     */
+    [[nodiscard]] static glm::vec2 SnapToPixel(const glm::vec2& world, float zoom);
+
+private:
+    std::vector<View> m_Views;
+};
+
+} // namespace MultiNinjaEspacial::Core::Systems
@@ -0,0 +1,67 @@
+// ============================================================================
+// Interpolation System - Sistema de Interpolación
+// ============================================================================
+// Guarda el Transform de cada paso fijo para dibujar entre dos pasos
+// Opera sobre: Transform + PreviousTransform (+ Velocity, para añadirlo)
+// ============================================================================
+
+#include "InterpolationSystem.hpp"
+#include "../components/Transform.hpp"
+#include "../components/PreviousTransform.hpp"
+#include "../components/Velocity.hpp"
+#include <cmath>
+#include <vector>
+
+namespace MultiNinjaEspacial::Core::Systems {
+
+/**
+ * @brief Guarda el estado actual como estado anterior
+ *
+ * Las entidades nuevas se recogen antes de añadirles el componente: añadir
+ * componentes mientras se recorre una view que los excluye la invalida.
+ * El primer snapshot copia el Transform actual, así que una entidad recién
+ * creada no se dibuja viniendo desde el origen.
+ */
+void InterpolationSystem::Snapshot(entt::registry& registry) {
+    auto untracked = registry.view<Components::Transform, Components::Velocity>(
+        entt::exclude<Components::PreviousTransform>);
+
+    std::vector<entt::entity> pending;
+    for (auto entity : untracked) {
+        pending.push_back(entity);
+    }
+    for (auto entity : pending) {
+        registry.emplace<Components::PreviousTransform>(entity, registry.get<Components::Transform>(entity));
+    }
+
+    auto view = registry.view<Components::Transform, Components::PreviousTransform>();
+    for (auto entity : view) {
+        view.get<Components::PreviousTransform>(entity) =
+            Components::PreviousTransform{view.get<Components::Transform>(entity)};
+    }
+}
+
+void InterpolationSystem::Teleport(entt::registry& registry, entt::entity entity) {
+    if (auto* previous = registry.try_get<Components::PreviousTransform>(entity)) {
+        *previous = Components::PreviousTransform{registry.get<Components::Transform>(entity)};
+    }
+}
+
+Components::Transform InterpolationSystem::Interpolate(const Components::PreviousTransform& previous,
+                                                       const Components::Transform& current,
+                                                       float alpha) {
+    // Diferencia de ángulo llevada a [-180, 180)
+    float deltaRotation = std::fmod(current.rotation - previous.rotation + 180.0f, 360.0f);
+    if (deltaRotation < 0.0f) {
+        deltaRotation += 360.0f;
+    }
+    deltaRotation -= 180.0f;
+
+    return Components::Transform{
+        glm::mix(previous.position, current.position, alpha),
+        previous.rotation + deltaRotation * alpha,
+        glm::mix(previous.scale, current.scale, alpha)
+    };
+}
+
+} // namespace MultiNinjaEspacial::Core::Systems
@@ -0,0 +1,69 @@
+// ============================================================================
+// Interpolation System - Header
+// ============================================================================
+
+#pragma once
+
+#include <entt/entt.hpp>
+
+namespace MultiNinjaEspacial::Core::Components {
+struct Transform;
+struct PreviousTransform;
+}
+
+namespace MultiNinjaEspacial::Core::Systems {
+
+/**
+ * @brief Sistema que guarda el estado anterior de las entidades que se mueven
+ *
+ * GameLoop llama a Snapshot al empezar cada paso fijo, antes de los
+ * sistemas de simulación: PreviousTransform queda con el estado del paso
+ * anterior y Transform con el del actual. En el render, RenderSystem
+ * dibuja entre ambos con alpha = acumulador / paso fijo.
+ *
+ * Como MovementSystem, es un sistema sin estado (métodos estáticos).
+ *
+ * Ejemplo de uso:
+ * ```cpp
+ * // En GameLoop::Run(), por cada paso fijo
+ * InterpolationSystem::Snapshot(registry);
+ * MovementSystem::Update(registry, fixedTimestep);
+ *
+ * // Antes de dibujar
+ * renderSystem.SetInterpolationAlpha(accumulator / fixedTimestep);
+ * ```
+ */
+class InterpolationSystem {
+public:
+    /**
+     * @brief Copia Transform → PreviousTransform
+     * @param registry Registro de EnTT
+     *
+     * Las entidades con Transform + Velocity que aún no tienen
+     * PreviousTransform lo reciben aquí.
+     */
+    static void Snapshot(entt::registry& registry);
+
+    /**
+     * @brief Descarta el estado anterior de una entidad
+     * @param registry Registro de EnTT
+     * @param entity Entidad que acaba de cambiar de posición de golpe
+     *
+     * El siguiente frame se dibuja directamente en su Transform actual.
+     */
+    static void Teleport(entt::registry& registry, entt::entity entity);
+
+    /**
+     * @brief Estado entre el paso anterior y el actual
+     * @param previous Estado del paso anterior
+     * @param current Estado del paso actual
+     * @param alpha 0 = previous, 1 = current
+     *
+     * La rotación se interpola por el camino corto (de 350° a 10° pasa por 0°).
+     */
+    [[nodiscard]] static Components::Transform Interpolate(const Components::PreviousTransform& previous,
+                                                           const Components::Transform& current,
+                                                           float alpha);
+};
+
+} // namespace MultiNinjaEspacial::Core::Systems
@@ -8,9 +8,33 @@
 #include "MovementSystem.hpp"
 #include "../components/Transform.hpp"
 #include "../components/Velocity.hpp"
+#include "../jobs/ParallelEach.hpp"
 
 namespace MultiNinjaEspacial::Core::Systems {
 
+namespace {
+
+/**
+ * @brief Integra una entidad: p' = p + v * dt, r' = r + ω * dt
+ */
+void Integrate(Components::Transform& transform, const Components::Velocity& velocity, float deltaTime) {
+    // Ejemplo: si velocity.linear = {100, 0} y dt = 0.016
+    //          entonces se mueve 1.6 píxeles a la derecha
+    transform.position += velocity.linear * deltaTime;
+    transform.rotation += velocity.angular * deltaTime;
+
+    // Normalizar rotación al rango [0, 360)
+    // Evita overflow después de muchas rotaciones
+    while (transform.rotation >= 360.0f) {
+        transform.rotation -= 360.0f;
+    }
+    while (transform.rotation < 0.0f) {
+        transform.rotation += 360.0f;
+    }
+}
+
+} // namespace
+
 /**
  * @brief Actualiza todas las entidades con Transform y Velocity
  * @param registry Registro de EnTT con todas las entidades
@@ -39,23 +63,32 @@ void MovementSystem::Update(entt::registry& registry, float deltaTime) {
         auto& transform = view.get<Components::Transform>(entity);
         auto& velocity = view.get<Components::Velocity>(entity);
 
-        // Actualizar posición: p' = p + v * dt
-        // Ejemplo: si velocity.linear = {100, 0} y dt = 0.016
-        //          entonces se mueve 1.6 píxeles a la derecha
-        transform.position += velocity.linear * deltaTime;
+        Integrate(transform, velocity, deltaTime);
+    }
+}
 
-        // Actualizar rotación: r' = r + ω * dt
-        transform.rotation += velocity.angular * deltaTime;
+/**
+ * @brief Actualiza todas las entidades con Transform y Velocity en paralelo
+ * @param registry Registro de EnTT con todas las entidades
+ * @param deltaTime Tiempo transcurrido desde el último frame (en segundos)
+ * @param jobs Sistema de jobs que reparte los trozos de la view
+ *
+ * Cada entidad solo toca sus propios componentes, así que los trozos
+ * (Jobs::DEFAULT_CHUNK_SIZE entidades) son independientes.
+ *
+ * Ejemplo de uso:
+ * ```cpp
+ * Jobs::JobSystem jobs;
+ * MovementSystem::Update(registry, deltaTime, jobs);
+ * ```
+ */
+void MovementSystem::Update(entt::registry& registry, float deltaTime, Jobs::JobSystem& jobs) {
+    auto view = registry.view<Components::Transform, Components::Velocity>();
 
-        // Normalizar rotación al rango [0, 360)
-        // Evita overflow después de muchas rotaciones
-        while (transform.rotation >= 360.0f) {
-            transform.rotation -= 360.0f;
-        }
-        while (transform.rotation < 0.0f) {
-            transform.rotation += 360.0f;
-        }
-    }
+    Jobs::ParallelEach(jobs, view, [deltaTime](entt::entity, Components::Transform& transform,
+                                               const Components::Velocity& velocity) {
+        Integrate(transform, velocity, deltaTime);
+    });
 }
 
 /**
@@ -76,16 +109,7 @@ void MovementSystem::UpdateEntity(entt::registry& registry, entt::entity entity,
     auto& transform = registry.get<Components::Transform>(entity);
     auto& velocity = registry.get<Components::Velocity>(entity);
 
-    transform.position += velocity.linear * deltaTime;
-    transform.rotation += velocity.angular * deltaTime;
-
-    // Normalizar rotación
-    while (transform.rotation >= 360.0f) {
-        transform.rotation -= 360.0f;
-    }
-    while (transform.rotation < 0.0f) {
-        transform.rotation += 360.0f;
-    }
+    Integrate(transform, velocity, deltaTime);
 }
 
 /**
@@ -6,6 +6,10 @@
 
 #include <entt/entt.hpp>
 
+namespace MultiNinjaEspacial::Core::Jobs {
+class JobSystem;
+}
+
 namespace MultiNinjaEspacial::Core::Systems {
 
 /**
@@ -23,6 +27,17 @@ public:
      */
     static void Update(entt::registry& registry, float deltaTime);
 
+    /**
+     * @brief Igual que Update, repartiendo las entidades entre los hilos
+     * @param registry Registro de EnTT
+     * @param deltaTime Tiempo transcurrido en segundos
+     * @param jobs Sistema de jobs
+     *
+     * Compensa a partir de unas decenas de miles de entidades; con pocas
+     * (un solo trozo) se ejecuta directamente en el hilo que llama.
+     */
+    static void Update(entt::registry& registry, float deltaTime, Jobs::JobSystem& jobs);
+
     /**
      * @brief Actualiza una entidad específica
      * @param registry Registro de EnTT
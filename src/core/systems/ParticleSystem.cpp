@@ -0,0 +1,427 @@
+// ============================================================================
+// Particle System - Sistema de Partículas
+// ============================================================================
+// Emite, simula y dibuja partículas en pools structure-of-arrays
+// Opera sobre: Transform + ParticleEmitter (emisores continuos)
+// ============================================================================
+
+#include "ParticleSystem.hpp"
+#include "../components/ParticleEmitter.hpp"
+#include "../components/Transform.hpp"
+#include <spdlog/spdlog.h>
+#include <algorithm>
+#include <cmath>
+#include <fstream>
+#include <sstream>
+
+#if defined(__SSE2__) || defined(_M_X64)
+    #include <emmintrin.h>
+    #define MNE_PARTICLES_SSE 1
+#endif
+
+namespace MultiNinjaEspacial::Core::Systems {
+
+namespace {
+
+constexpr float DEG_TO_RAD = 3.14159265358979f / 180.0f;
+
+/**
+ * @brief Capacidad del pool redondeada a múltiplo de 4 (ancho SSE)
+ *
+ * Así el último grupo de 4 nunca lee fuera de los arrays.
+ */
+uint32_t PaddedCapacity(uint32_t maxParticles) {
+    return (maxParticles + 3u) & ~3u;
+}
+
+} // namespace
+
+ParticleSystem::ParticleSystem()
+    : m_RandomState(0x9E3779B9u) {
+}
+
+// ----------------------------------------------------------------------------
+// Definiciones
+// ----------------------------------------------------------------------------
+
+bool ParticleSystem::LoadDefinitions(const std::string& path) {
+    std::ifstream file(path);
+    if (!file.is_open()) {
+        spdlog::error("No se pudo abrir el fichero de partículas: {}", path);
+        return false;
+    }
+
+    return LoadDefinitions(file, path);
+}
+
+bool ParticleSystem::LoadDefinitions(std::istream& stream, const std::string& source) {
+    // Todo se valida antes de tocar los pools: o se añade el fichero
+    // entero o nada
+    std::vector<ParticleEmitterDef> parsed;
+    ParticleEmitterDef def;
+    bool inEmitter = false;
+
+    std::string line;
+    while (std::getline(stream, line)) {
+        std::istringstream fields(line);
+        std::string key;
+        if (!(fields >> key) || key[0] == '#') {
+            continue;
+        }
+
+        if (key == "emitter") {
+            if (inEmitter) {
+                spdlog::error("Emisor '{}' sin 'end' en {}", def.name, source);
+                return false;
+            }
+            def = ParticleEmitterDef{};
+            fields >> def.name;
+            inEmitter = true;
+        } else if (!inEmitter) {
+            spdlog::error("Propiedad fuera de un emisor en {}: '{}'", source, line);
+            return false;
+        } else if (key == "end") {
+            if (def.maxParticles == 0 || def.lifetimeMin <= 0.0f || def.lifetimeMax < def.lifetimeMin) {
+                spdlog::error("Emisor '{}' inválido en {} (max > 0, 0 < lifetime min <= max)",
+                              def.name, source);
+                return false;
+            }
+            parsed.push_back(def);
+            inEmitter = false;
+        } else if (key == "texture") {
+            fields >> def.texture;
+        } else if (key == "max") {
+            fields >> def.maxParticles;
+        } else if (key == "rate") {
+            fields >> def.rate;
+        } else if (key == "burst") {
+            fields >> def.burst;
+        } else if (key == "lifetime") {
+            fields >> def.lifetimeMin >> def.lifetimeMax;
+        } else if (key == "speed") {
+            fields >> def.speedMin >> def.speedMax;
+        } else if (key == "direction") {
+            fields >> def.direction;
+        } else if (key == "spread") {
+            fields >> def.spread;
+        } else if (key == "radius") {
+            fields >> def.radius;
+        } else if (key == "gravity") {
+            fields >> def.gravity.x >> def.gravity.y;
+        } else if (key == "size") {
+            fields >> def.sizeMin >> def.sizeMax;
+        } else if (key == "size_end") {
+            fields >> def.sizeEnd;
+        } else if (key == "angular") {
+            fields >> def.angularMin >> def.angularMax;
+        } else if (key == "color_start") {
+            fields >> def.colorStart.r >> def.colorStart.g >> def.colorStart.b >> def.colorStart.a;
+        } else if (key == "color_end") {
+            fields >> def.colorEnd.r >> def.colorEnd.g >> def.colorEnd.b >> def.colorEnd.a;
+        } else {
+            spdlog::error("Propiedad de partículas desconocida en {}: '{}'", source, key);
+            return false;
+        }
+
+        if (fields.fail()) {
+            spdlog::error("Línea inválida en {}: '{}'", source, line);
+            return false;
+        }
+    }
+
+    if (inEmitter) {
+        spdlog::error("Emisor '{}' sin 'end' en {}", def.name, source);
+        return false;
+    }
+
+    for (const ParticleEmitterDef& definition : parsed) {
+        AddDefinition(definition);
+    }
+
+    spdlog::info("ParticleSystem: {} emisores cargados de {}", parsed.size(), source);
+    return true;
+}
+
+uint32_t ParticleSystem::AddDefinition(const ParticleEmitterDef& definition) {
+    uint32_t index = FindDefinition(definition.name);
+    if (index == INVALID_DEFINITION) {
+        index = static_cast<uint32_t>(m_Pools.size());
+        m_Pools.emplace_back();
+    }
+
+    Pool& pool = m_Pools[index];
+    pool.def = definition;
+    pool.count = 0;
+
+    const uint32_t capacity = PaddedCapacity(definition.maxParticles);
+    for (auto& field : pool.fields) {
+        field.assign(capacity, 0.0f);
+    }
+
+    return index;
+}
+
+uint32_t ParticleSystem::FindDefinition(const std::string& name) const {
+    for (size_t i = 0; i < m_Pools.size(); ++i) {
+        if (m_Pools[i].def.name == name) {
+            return static_cast<uint32_t>(i);
+        }
+    }
+    return INVALID_DEFINITION;
+}
+
+void ParticleSystem::ResolveTextures(Infrastructure::Rendering::IRenderer& renderer) {
+    for (Pool& pool : m_Pools) {
+        if (pool.def.texture.empty()) {
+            continue;
+        }
+
+        pool.def.textureHandle = renderer.FindTexture(pool.def.texture);
+        if (!pool.def.textureHandle.IsValid()) {
+            spdlog::warn("ParticleSystem: textura '{}' no cargada (emisor '{}')",
+                         pool.def.texture, pool.def.name);
+        }
+    }
+}
+
+// ----------------------------------------------------------------------------
+// Emisión
+// ----------------------------------------------------------------------------
+
+uint32_t ParticleSystem::Burst(uint32_t definition, const glm::vec2& position,
+                               uint32_t count, const glm::vec4& tint) {
+    if (definition >= m_Pools.size()) {
+        return 0;
+    }
+
+    Pool& pool = m_Pools[definition];
+    return Spawn(pool, position, count != 0 ? count : pool.def.burst, tint);
+}
+
+uint32_t ParticleSystem::Spawn(Pool& pool, const glm::vec2& position, uint32_t count,
+                               const glm::vec4& tint) {
+    const ParticleEmitterDef& def = pool.def;
+
+    // Pool lleno: se descarta lo que no cabe (nunca se reasigna memoria)
+    const uint32_t available = def.maxParticles - pool.count;
+    const uint32_t spawned = std::min(count, available);
+    m_Stats.dropped += count - spawned;
+
+    const glm::vec4 colorStart = def.colorStart * tint;
+    const glm::vec4 colorDelta = def.colorEnd * tint - colorStart;
+
+    auto& f = pool.fields;
+    for (uint32_t n = 0; n < spawned; ++n) {
+        const uint32_t i = pool.count++;
+
+        // Punto uniforme en el disco de emisión
+        glm::vec2 origin = position;
+        if (def.radius > 0.0f) {
+            const float angle = Random(0.0f, 360.0f) * DEG_TO_RAD;
+            const float distance = def.radius * std::sqrt(Random(0.0f, 1.0f));
+            origin += glm::vec2{std::cos(angle), std::sin(angle)} * distance;
+        }
+
+        const float angle = (def.direction + Random(-def.spread, def.spread)) * DEG_TO_RAD;
+        const float speed = Random(def.speedMin, def.speedMax);
+        const float size = Random(def.sizeMin, def.sizeMax);
+
+        f[POS_X][i] = origin.x;
+        f[POS_Y][i] = origin.y;
+        f[VEL_X][i] = std::cos(angle) * speed;
+        f[VEL_Y][i] = std::sin(angle) * speed;
+        f[AGE][i] = 0.0f;
+        f[INV_LIFETIME][i] = 1.0f / Random(def.lifetimeMin, def.lifetimeMax);
+        f[ROTATION][i] = 0.0f;
+        f[ANGULAR][i] = Random(def.angularMin, def.angularMax);
+        f[SIZE_START][i] = size;
+        f[SIZE_DELTA][i] = size * (def.sizeEnd - 1.0f);
+        f[R_START][i] = colorStart.r;
+        f[G_START][i] = colorStart.g;
+        f[B_START][i] = colorStart.b;
+        f[A_START][i] = colorStart.a;
+        f[R_DELTA][i] = colorDelta.r;
+        f[G_DELTA][i] = colorDelta.g;
+        f[B_DELTA][i] = colorDelta.b;
+        f[A_DELTA][i] = colorDelta.a;
+
+        // Visible tal cual hasta el primer update
+        f[SIZE][i] = size;
+        f[R][i] = colorStart.r;
+        f[G][i] = colorStart.g;
+        f[B][i] = colorStart.b;
+        f[A][i] = colorStart.a;
+    }
+
+    return spawned;
+}
+
+float ParticleSystem::Random(float min, float max) {
+    // xorshift32: suficiente para efectos visuales y sin estado global
+    m_RandomState ^= m_RandomState << 13;
+    m_RandomState ^= m_RandomState >> 17;
+    m_RandomState ^= m_RandomState << 5;
+
+    const float unit = static_cast<float>(m_RandomState >> 8) * (1.0f / 16777216.0f);
+    return min + (max - min) * unit;
+}
+
+// ----------------------------------------------------------------------------
+// Simulación
+// ----------------------------------------------------------------------------
+
+void ParticleSystem::Update(entt::registry& registry, float deltaTime) {
+    // Emisores continuos: acumulan fracciones de partícula entre updates
+    auto view = registry.view<Components::Transform, Components::ParticleEmitter>();
+    for (auto entity : view) {
+        auto& transform = view.get<Components::Transform>(entity);
+        auto& emitter = view.get<Components::ParticleEmitter>(entity);
+
+        if (!emitter.emitting || emitter.definition >= m_Pools.size()) {
+            continue;
+        }
+
+        Pool& pool = m_Pools[emitter.definition];
+        emitter.accumulator += pool.def.rate * deltaTime;
+
+        const auto count = static_cast<uint32_t>(emitter.accumulator);
+        if (count > 0) {
+            emitter.accumulator -= static_cast<float>(count);
+            Spawn(pool, transform.position + emitter.offset, count, emitter.tint);
+        }
+    }
+
+    Simulate(deltaTime);
+}
+
+void ParticleSystem::Simulate(float deltaTime) {
+    m_Stats.alive = 0;
+    for (Pool& pool : m_Pools) {
+        if (pool.count > 0) {
+            SimulatePool(pool, deltaTime);
+            m_Stats.alive += pool.count;
+        }
+    }
+}
+
+/**
+ * @brief Integra un pool completo
+ *
+ * Por partícula:
+ *   v += g * dt;  p += v * dt;  rotación += ω * dt;  edad += dt
+ *   t = min(edad / vida, 1)
+ *   tamaño = tamaño0 + Δtamaño * t;  color = color0 + Δcolor * t
+ *
+ * Después, las partículas con t >= 1 se eliminan copiando encima la última.
+ */
+void ParticleSystem::SimulatePool(Pool& pool, float deltaTime) {
+    auto& f = pool.fields;
+    const uint32_t count = pool.count;
+    const glm::vec2 gravityStep = pool.def.gravity * deltaTime;
+
+    uint32_t i = 0;
+
+#ifdef MNE_PARTICLES_SSE
+    const __m128 dt = _mm_set1_ps(deltaTime);
+    const __m128 gx = _mm_set1_ps(gravityStep.x);
+    const __m128 gy = _mm_set1_ps(gravityStep.y);
+    const __m128 one = _mm_set1_ps(1.0f);
+
+    // Los arrays tienen capacidad múltiplo de 4: el último grupo puede
+    // incluir huecos libres, que se calculan y se ignoran
+    for (; i < count; i += 4) {
+        __m128 vx = _mm_add_ps(_mm_loadu_ps(&f[VEL_X][i]), gx);
+        __m128 vy = _mm_add_ps(_mm_loadu_ps(&f[VEL_Y][i]), gy);
+        _mm_storeu_ps(&f[VEL_X][i], vx);
+        _mm_storeu_ps(&f[VEL_Y][i], vy);
+        _mm_storeu_ps(&f[POS_X][i], _mm_add_ps(_mm_loadu_ps(&f[POS_X][i]), _mm_mul_ps(vx, dt)));
+        _mm_storeu_ps(&f[POS_Y][i], _mm_add_ps(_mm_loadu_ps(&f[POS_Y][i]), _mm_mul_ps(vy, dt)));
+        _mm_storeu_ps(&f[ROTATION][i],
+                      _mm_add_ps(_mm_loadu_ps(&f[ROTATION][i]), _mm_mul_ps(_mm_loadu_ps(&f[ANGULAR][i]), dt)));
+
+        const __m128 age = _mm_add_ps(_mm_loadu_ps(&f[AGE][i]), dt);
+        _mm_storeu_ps(&f[AGE][i], age);
+        const __m128 t = _mm_min_ps(_mm_mul_ps(age, _mm_loadu_ps(&f[INV_LIFETIME][i])), one);
+
+        _mm_storeu_ps(&f[SIZE][i],
+                      _mm_add_ps(_mm_loadu_ps(&f[SIZE_START][i]), _mm_mul_ps(_mm_loadu_ps(&f[SIZE_DELTA][i]), t)));
+        for (uint32_t c = 0; c < 4; ++c) {
+            _mm_storeu_ps(&f[R + c][i],
+                          _mm_add_ps(_mm_loadu_ps(&f[R_START + c][i]),
+                                     _mm_mul_ps(_mm_loadu_ps(&f[R_DELTA + c][i]), t)));
+        }
+    }
+#endif
+
+    // Escalar: plataformas sin SSE2
+    for (; i < count; ++i) {
+        f[VEL_X][i] += gravityStep.x;
+        f[VEL_Y][i] += gravityStep.y;
+        f[POS_X][i] += f[VEL_X][i] * deltaTime;
+        f[POS_Y][i] += f[VEL_Y][i] * deltaTime;
+        f[ROTATION][i] += f[ANGULAR][i] * deltaTime;
+        f[AGE][i] += deltaTime;
+
+        const float t = std::min(f[AGE][i] * f[INV_LIFETIME][i], 1.0f);
+        f[SIZE][i] = f[SIZE_START][i] + f[SIZE_DELTA][i] * t;
+        for (uint32_t c = 0; c < 4; ++c) {
+            f[R + c][i] = f[R_START + c][i] + f[R_DELTA + c][i] * t;
+        }
+    }
+
+    // Eliminar muertas (swap con la última, el orden no importa)
+    uint32_t alive = count;
+    for (uint32_t p = 0; p < alive;) {
+        if (f[AGE][p] * f[INV_LIFETIME][p] < 1.0f) {
+            ++p;
+            continue;
+        }
+
+        --alive;
+        for (auto& field : f) {
+            field[p] = field[alive];
+        }
+    }
+    pool.count = alive;
+}
+
+// ----------------------------------------------------------------------------
+// Render
+// ----------------------------------------------------------------------------
+
+void ParticleSystem::Render(Infrastructure::Rendering::IRenderer& renderer) {
+    m_Stats.drawCalls = 0;
+
+    for (const Pool& pool : m_Pools) {
+        const uint32_t count = pool.count;
+        if (count == 0) {
+            continue;
+        }
+
+        const auto& f = pool.fields;
+        m_Staging.resize(count);
+        for (uint32_t i = 0; i < count; ++i) {
+            auto& sprite = m_Staging[i];
+            const float size = f[SIZE][i];
+
+            // Las partículas se guardan por su centro; el sprite por su esquina
+            sprite.position = {f[POS_X][i] - 0.5f * size, f[POS_Y][i] - 0.5f * size};
+            sprite.size = {size, size};
+            sprite.rotation = f[ROTATION][i];
+            sprite.color = {f[R][i], f[G][i], f[B][i], f[A][i]};
+        }
+
+        // Un único envío por pool: el batcher lo convierte en un draw instanciado
+        renderer.DrawSprites(pool.def.textureHandle, m_Staging.data(), count);
+        m_Stats.drawCalls++;
+    }
+}
+
+void ParticleSystem::Clear() {
+    for (Pool& pool : m_Pools) {
+        pool.count = 0;
+    }
+    m_Stats.alive = 0;
+}
+
+} // namespace MultiNinjaEspacial::Core::Systems
@@ -0,0 +1,240 @@
+// ============================================================================
+// Particle System - Header
+// ============================================================================
+
+#pragma once
+
+#include "../../infrastructure/rendering/IRenderer.hpp"
+#include "../components/TextureHandle.hpp"
+#include <entt/entt.hpp>
+#include <glm/glm.hpp>
+#include <array>
+#include <cstdint>
+#include <istream>
+#include <string>
+#include <vector>
+
+namespace MultiNinjaEspacial::Core::Systems {
+
+/**
+ * @brief Definición de un emisor (datos, no código)
+ *
+ * Se carga de un fichero de definiciones (ver ParticleSystem::LoadDefinitions).
+ * Ángulos en grados con 0 = +X y -90 = arriba (Y crece hacia abajo).
+ */
+struct ParticleEmitterDef {
+    std::string name;
+    std::string texture;                    // ID de textura ("" = quad blanco)
+    Components::TextureHandle textureHandle;
+
+    uint32_t maxParticles{1024};            // Tamaño del pool
+    float rate{0.0f};                       // Partículas/s (emisores continuos)
+    uint32_t burst{0};                      // Partículas por Burst() por defecto
+
+    float lifetimeMin{1.0f};                // Segundos
+    float lifetimeMax{1.0f};
+    float speedMin{0.0f};                   // px/s
+    float speedMax{0.0f};
+    float direction{-90.0f};                // Dirección central
+    float spread{180.0f};                   // Desviación máxima a cada lado
+    float radius{0.0f};                     // Radio del disco de emisión (px)
+    glm::vec2 gravity{0.0f, 0.0f};          // px/s²
+
+    float sizeMin{4.0f};                    // Tamaño inicial (px)
+    float sizeMax{4.0f};
+    float sizeEnd{1.0f};                    // Factor de tamaño al morir
+    float angularMin{0.0f};                 // deg/s
+    float angularMax{0.0f};
+
+    glm::vec4 colorStart{1.0f};
+    glm::vec4 colorEnd{1.0f, 1.0f, 1.0f, 0.0f};
+};
+
+/**
+ * @brief Sistema de partículas con pools structure-of-arrays
+ *
+ * Cada definición tiene su pool: un array de floats por atributo
+ * (posición, velocidad, edad, color...). El update recorre los arrays de
+ * 4 en 4 con SSE (escalar si no hay SSE2) y las partículas muertas se
+ * eliminan intercambiándolas con la última, así que los pools son siempre
+ * densos. Render() envía cada pool con una sola llamada a
+ * IRenderer::DrawSprites (un batch instanciado por textura).
+ *
+ * Las partículas no son entidades de EnTT: 100k entidades con varios
+ * componentes costarían mucho más en memoria y en iteración.
+ *
+ * Ejemplo de uso:
+ * ```cpp
+ * ParticleSystem particles;
+ * particles.LoadDefinitions("assets/data/particles.emitters");
+ * particles.ResolveTextures(renderer);
+ *
+ * // Efecto de golpe (un solo disparo)
+ * particles.Burst(particles.FindDefinition("hit"), hitPosition);
+ *
+ * // En GameLoop
+ * particles.Update(registry, deltaTime);   // Update()
+ * particles.Render(renderer);              // Render(), tras RenderSystem
+ * ```
+ */
+class ParticleSystem {
+public:
+    /**
+     * @brief Métricas del último Update/Render
+     */
+    struct Stats {
+        uint32_t alive{0};       // Partículas vivas
+        uint32_t dropped{0};     // Descartadas por pool lleno (acumulado)
+        uint32_t drawCalls{0};   // Llamadas a DrawSprites del último Render
+    };
+
+    // Valor reservado para "definición no encontrada"
+    static constexpr uint32_t INVALID_DEFINITION = 0xFFFFFFFFu;
+
+    ParticleSystem();
+
+    /**
+     * @brief Carga definiciones de emisores desde fichero
+     * @param path Ruta del fichero de definiciones
+     * @return true si todas las definiciones son válidas (si no, no se
+     *         añade ninguna)
+     *
+     * Formato (una propiedad por línea, '#' = comentario):
+     * ```
+     * emitter hit
+     *   max 4096
+     *   burst 20
+     *   lifetime 0.5 0.5
+     *   speed 100 250
+     *   spread 180
+     *   gravity 0 490
+     *   size 2.5 7.5
+     *   color_start 1 1 1 1
+     *   color_end 1 1 1 0
+     * end
+     * ```
+     */
+    bool LoadDefinitions(const std::string& path);
+
+    /**
+     * @brief Carga definiciones desde un stream
+     * @param stream Contenido en el formato de LoadDefinitions
+     * @param source Nombre para los mensajes de error
+     * @return true si todas las definiciones son válidas (si no, no se
+     *         añade ninguna)
+     */
+    bool LoadDefinitions(std::istream& stream, const std::string& source);
+
+    /**
+     * @brief Añade una definición (sustituye a la del mismo nombre)
+     * @return Índice de la definición
+     */
+    uint32_t AddDefinition(const ParticleEmitterDef& definition);
+
+    /**
+     * @brief Busca una definición por nombre (fuera del path de update)
+     * @return Índice o INVALID_DEFINITION
+     */
+    [[nodiscard]] uint32_t FindDefinition(const std::string& name) const;
+
+    [[nodiscard]] const ParticleEmitterDef& GetDefinition(uint32_t definition) const {
+        return m_Pools[definition].def;
+    }
+
+    [[nodiscard]] size_t GetDefinitionCount() const { return m_Pools.size(); }
+
+    /**
+     * @brief Resuelve los IDs de textura de las definiciones a handles
+     * @param renderer Renderer donde ya están cargadas las texturas
+     */
+    void ResolveTextures(Infrastructure::Rendering::IRenderer& renderer);
+
+    /**
+     * @brief Emite un grupo de partículas de una vez (golpes, explosiones)
+     * @param definition Índice de la definición
+     * @param position Centro de emisión
+     * @param count Número de partículas (0 = el 'burst' de la definición)
+     * @param tint Multiplicador de color
+     * @return Partículas emitidas (menos si el pool se llena)
+     */
+    uint32_t Burst(uint32_t definition, const glm::vec2& position,
+                   uint32_t count = 0, const glm::vec4& tint = glm::vec4{1.0f});
+
+    /**
+     * @brief Emite desde los ParticleEmitter y simula todos los pools
+     * @param registry Registro de EnTT (Transform + ParticleEmitter)
+     * @param deltaTime Tiempo transcurrido en segundos
+     */
+    void Update(entt::registry& registry, float deltaTime);
+
+    /**
+     * @brief Simula todos los pools (sin emisores continuos)
+     * @param deltaTime Tiempo transcurrido en segundos
+     */
+    void Simulate(float deltaTime);
+
+    /**
+     * @brief Envía las partículas vivas (una llamada por pool no vacío)
+     * @param renderer Renderer destino
+     */
+    void Render(Infrastructure::Rendering::IRenderer& renderer);
+
+    /**
+     * @brief Elimina todas las partículas vivas
+     */
+    void Clear();
+
+    /**
+     * @brief Partículas vivas de una definición
+     */
+    [[nodiscard]] uint32_t GetAliveCount(uint32_t definition) const {
+        return m_Pools[definition].count;
+    }
+
+    [[nodiscard]] const Stats& GetStats() const { return m_Stats; }
+
+private:
+    /**
+     * @brief Atributos por partícula (un array por atributo)
+     */
+    enum Field : uint32_t {
+        POS_X, POS_Y,
+        VEL_X, VEL_Y,
+        AGE, INV_LIFETIME,
+        ROTATION, ANGULAR,
+        SIZE_START, SIZE_DELTA,
+        R_START, G_START, B_START, A_START,
+        R_DELTA, G_DELTA, B_DELTA, A_DELTA,
+        SIZE, R, G, B, A,             // Salida del update (lo que se dibuja)
+        FIELD_COUNT
+    };
+
+    struct Pool {
+        ParticleEmitterDef def;
+        std::array<std::vector<float>, FIELD_COUNT> fields;
+        uint32_t count{0};
+    };
+
+    /**
+     * @brief Añade partículas a un pool
+     * @return Partículas añadidas
+     */
+    uint32_t Spawn(Pool& pool, const glm::vec2& position, uint32_t count, const glm::vec4& tint);
+
+    /**
+     * @brief Integra un pool y elimina las partículas muertas
+     */
+    void SimulatePool(Pool& pool, float deltaTime);
+
+    /**
+     * @brief Número aleatorio en [min, max) (xorshift32)
+     */
+    float Random(float min, float max);
+
+    std::vector<Pool> m_Pools;
+    std::vector<Infrastructure::Rendering::IRenderer::SpriteDraw> m_Staging;
+    uint32_t m_RandomState;
+    Stats m_Stats;
+};
+
+} // namespace MultiNinjaEspacial::Core::Systems
@@ -1,12 +1,450 @@
 // ============================================================================
-// Render System - Sistema de Renderizado (STUB)
+// Render System - Sistema de Renderizado
 // ============================================================================
-// TODO: Implementar en Fase 1.1
+// Ordena y envía al renderer las entidades visibles
+// Opera sobre: Transform + Renderable (+ Static, horneadas por layer;
+// + PreviousTransform, interpoladas), con una o varias cámaras (CameraSystem)
 // ============================================================================
 
+#include "RenderSystem.hpp"
+#include "../components/Transform.hpp"
+#include "../components/Renderable.hpp"
+#include "../components/Static.hpp"
+#include "../components/PreviousTransform.hpp"
+#include "InterpolationSystem.hpp"
+#include "../utils/RadixSort.hpp"
+#include <algorithm>
+#include <climits>
+#include <spdlog/spdlog.h>
+
 namespace MultiNinjaEspacial::Core::Systems {
 
-// STUB: Implementación vacía para Fase 1.1
-// El rendering se hace directamente en GameLoop por ahora
+namespace {
+
+constexpr uint64_t INDEX_MASK = (uint64_t{1} << RenderSystem::INDEX_BITS) - 1;
+constexpr uint64_t TEXTURE_MASK = (uint64_t{1} << RenderSystem::TEXTURE_BITS) - 1;
+
+// Los bytes del índice ya vienen ordenados: el radix sort empieza después
+constexpr unsigned INDEX_BYTES = RenderSystem::INDEX_BITS / 8;
+
+constexpr uint32_t LAYER_SHIFT = RenderSystem::TEXTURE_BITS + RenderSystem::INDEX_BITS;
+
+int ClampLayer(int layer) {
+    return std::clamp(layer, -32768, 32767);
+}
+
+int KeyLayer(uint64_t key) {
+    return static_cast<int>(key >> LAYER_SHIFT) - 32768;
+}
+
+} // namespace
+
+RenderSystem::~RenderSystem() {
+    Disconnect();
+}
+
+uint64_t RenderSystem::MakeSortKey(int layer, uint32_t textureKey, uint32_t index) {
+    // Layer con signo → 16 bits sin signo (sesgo de 32768) para que
+    // el orden numérico de la clave coincida con el orden de capas
+    const int clamped = ClampLayer(layer);
+    const auto biasedLayer = static_cast<uint64_t>(clamped + 32768);
+
+    return (biasedLayer << (TEXTURE_BITS + INDEX_BITS)) |
+           ((static_cast<uint64_t>(textureKey) & TEXTURE_MASK) << INDEX_BITS) |
+           (static_cast<uint64_t>(index) & INDEX_MASK);
+}
+
+/**
+ * @brief Dibuja las entidades visibles ordenadas por layer y textura
+ * @param registry Registro de EnTT
+ * @param renderer Renderer destino
+ * @param bounds Zona visible en coordenadas del mundo
+ *
+ * Proceso:
+ * 1. Rehacer los batches estáticos de los layers que cambiaron
+ * 2. Culling: visible == false o bounding circle fuera de bounds → descartar
+ * 3. Clave de 64 bits por sprite (el índice en los bits bajos identifica el item)
+ * 4. Radix sort de las claves (solo bytes de layer y textura)
+ * 5. DrawSprite en orden, con cada layer estático antes de los dinámicos
+ *    de su mismo layer
+ */
+void RenderSystem::Render(entt::registry& registry,
+                          Infrastructure::Rendering::IRenderer& renderer,
+                          const ViewBounds& bounds) {
+    CollectVisible(registry, renderer, &bounds, 1);
+    SubmitView(renderer, bounds, 1u);
+    m_Stats.views = 1;
+}
+
+/**
+ * @brief Dibuja las entidades visibles con cada cámara
+ *
+ * El culling se hace una vez contra todas las cámaras (cada sprite guarda
+ * qué vistas lo ven); después cada vista recorre las mismas claves
+ * ordenadas y envía solo sus sprites.
+ */
+void RenderSystem::Render(entt::registry& registry,
+                          Infrastructure::Rendering::IRenderer& renderer,
+                          const CameraSystem& cameras) {
+    const auto& views = cameras.GetViews();
+
+    m_ViewBounds.clear();
+    for (const auto& view : views) {
+        m_ViewBounds.push_back(ViewBounds{view.visibleMin, view.visibleMax});
+    }
+
+    CollectVisible(registry, renderer, m_ViewBounds.data(), static_cast<uint32_t>(m_ViewBounds.size()));
+
+    for (uint32_t i = 0; i < views.size(); ++i) {
+        renderer.SetView(views[i].viewProjection, views[i].viewport);
+        SubmitView(renderer, m_ViewBounds[i], 1u << i);
+    }
+    if (!views.empty()) {
+        renderer.ResetView();
+    }
+    m_Stats.views = static_cast<uint32_t>(views.size());
+}
+
+void RenderSystem::CollectVisible(entt::registry& registry,
+                                  Infrastructure::Rendering::IRenderer& renderer,
+                                  const ViewBounds* views, uint32_t viewCount) {
+    m_Stats = Stats{};
+    m_Items.clear();
+    m_Keys.clear();
+
+    if (m_Registry != &registry) {
+        Connect(registry);
+    }
+    RebuildStaticLayers(registry, renderer);
+
+    if (viewCount == 0) {
+        return;
+    }
+
+    // Rectángulo que cubre todas las vistas: lo que cae fuera se descarta
+    // con cuatro comparaciones, sin mirar cada cámara
+    ViewBounds all = views[0];
+    for (uint32_t i = 1; i < viewCount; ++i) {
+        all.min = glm::min(all.min, views[i].min);
+        all.max = glm::max(all.max, views[i].max);
+    }
+
+    // Culling y clave de un sprite; false si se llenó el frame
+    auto collect = [&](const Components::Renderable& renderable, const glm::vec2& position,
+                       float rotation, const glm::vec2& scale) {
+        const glm::vec2 size = renderable.size * scale;
+
+        // Bounding circle: cubre el sprite con cualquier rotación
+        const glm::vec2 center = position + 0.5f * size;
+        const float radius = 0.5f * glm::length(size);
+        if (center.x + radius < all.min.x || center.x - radius > all.max.x ||
+            center.y + radius < all.min.y || center.y - radius > all.max.y) {
+            m_Stats.culled++;
+            return true;
+        }
+
+        uint32_t viewMask = 1u;
+        if (viewCount > 1) {
+            viewMask = 0;
+            for (uint32_t i = 0; i < viewCount; ++i) {
+                const ViewBounds& bounds = views[i];
+                if (center.x + radius >= bounds.min.x && center.x - radius <= bounds.max.x &&
+                    center.y + radius >= bounds.min.y && center.y - radius <= bounds.max.y) {
+                    viewMask |= 1u << i;
+                }
+            }
+            if (viewMask == 0) {
+                m_Stats.culled++;   // Entre dos cámaras, sin que la vea ninguna
+                return true;
+            }
+        }
+
+        if (m_Items.size() >= MAX_SPRITES_PER_FRAME) {
+            spdlog::warn("RenderSystem: límite de {} sprites por frame alcanzado", MAX_SPRITES_PER_FRAME);
+            return false;
+        }
+
+        const auto index = static_cast<uint32_t>(m_Items.size());
+        m_Keys.push_back(MakeSortKey(renderable.layer, renderable.texture.index, index));
+        m_Items.push_back(DrawItem{
+            position,
+            size,
+            rotation,
+            renderable.color,
+            renderable.texture,
+            viewMask
+        });
+        return true;
+    };
+
+    // Entidades con snapshot del paso anterior: se dibujan entre los dos
+    // estados de la simulación (InterpolationSystem)
+    auto interpolated = registry.view<Components::Transform, Components::Renderable,
+                                      Components::PreviousTransform>(entt::exclude<Components::Static>);
+    for (auto entity : interpolated) {
+        m_Stats.visited++;
+
+        const auto& renderable = interpolated.get<Components::Renderable>(entity);
+        if (!renderable.visible) {
+            m_Stats.hidden++;
+            continue;
+        }
+
+        const Components::Transform transform = InterpolationSystem::Interpolate(
+            interpolated.get<Components::PreviousTransform>(entity),
+            interpolated.get<Components::Transform>(entity), m_InterpolationAlpha);
+        if (!collect(renderable, transform.position, transform.rotation, transform.scale)) {
+            break;
+        }
+    }
+
+    auto view = registry.view<Components::Transform, Components::Renderable>(
+        entt::exclude<Components::Static, Components::PreviousTransform>);
+    for (auto entity : view) {
+        m_Stats.visited++;
+
+        const auto& renderable = view.get<Components::Renderable>(entity);
+        if (!renderable.visible) {
+            m_Stats.hidden++;
+            continue;
+        }
+
+        const auto& transform = view.get<Components::Transform>(entity);
+        if (!collect(renderable, transform.position, transform.rotation, transform.scale)) {
+            break;
+        }
+    }
+
+    Utils::RadixSort64(m_Keys, m_ScratchKeys, INDEX_BYTES);
+}
+
+void RenderSystem::SubmitView(Infrastructure::Rendering::IRenderer& renderer,
+                              const ViewBounds& bounds, uint32_t viewBit) {
+    size_t nextStatic = 0;
+    for (uint64_t key : m_Keys) {
+        const DrawItem& item = m_Items[key & INDEX_MASK];
+        if ((item.viewMask & viewBit) == 0) {
+            continue;
+        }
+
+        if (nextStatic < m_StaticLayers.size() && m_StaticLayers[nextStatic].layer <= KeyLayer(key)) {
+            DrawStaticLayers(KeyLayer(key), nextStatic, renderer, bounds);
+        }
+
+        renderer.DrawSprite(item.texture, item.position, item.size, item.rotation, item.color);
+        m_Stats.submitted++;
+    }
+    DrawStaticLayers(INT_MAX, nextStatic, renderer, bounds);
+}
+
+// ============================================================================
+// Geometría estática
+// ============================================================================
+
+void RenderSystem::MarkStaticDirty(int layer) {
+    FindOrAddStaticLayer(ClampLayer(layer)).dirty = true;
+    m_StaticDirty = true;
+}
+
+void RenderSystem::InvalidateStatic() {
+    for (auto& staticLayer : m_StaticLayers) {
+        staticLayer.dirty = true;
+    }
+    m_StaticDirty = !m_StaticLayers.empty();
+}
+
+void RenderSystem::Connect(entt::registry& registry) {
+    Disconnect();
+    m_Registry = &registry;
+
+    registry.on_construct<Components::Static>().connect<&RenderSystem::OnStaticChanged>(*this);
+    registry.on_destroy<Components::Static>().connect<&RenderSystem::OnStaticChanged>(*this);
+    registry.on_construct<Components::Transform>().connect<&RenderSystem::OnStaticChanged>(*this);
+    registry.on_update<Components::Transform>().connect<&RenderSystem::OnStaticChanged>(*this);
+    registry.on_destroy<Components::Transform>().connect<&RenderSystem::OnStaticChanged>(*this);
+    registry.on_construct<Components::Renderable>().connect<&RenderSystem::OnStaticChanged>(*this);
+    registry.on_update<Components::Renderable>().connect<&RenderSystem::OnStaticChanged>(*this);
+    registry.on_destroy<Components::Renderable>().connect<&RenderSystem::OnStaticChanged>(*this);
+
+    // Lo horneado pertenecía a otro registry (o a ninguno): todo sucio,
+    // incluidos los layers de las entidades estáticas que ya existen
+    m_StaticMembership.clear();
+    InvalidateStatic();
+    auto view = registry.view<Components::Renderable, Components::Static>();
+    for (auto entity : view) {
+        MarkStaticDirty(view.get<Components::Renderable>(entity).layer);
+    }
+}
+
+void RenderSystem::Disconnect() {
+    if (m_Registry == nullptr) {
+        return;
+    }
+
+    m_Registry->on_construct<Components::Static>().disconnect<&RenderSystem::OnStaticChanged>(*this);
+    m_Registry->on_destroy<Components::Static>().disconnect<&RenderSystem::OnStaticChanged>(*this);
+    m_Registry->on_construct<Components::Transform>().disconnect<&RenderSystem::OnStaticChanged>(*this);
+    m_Registry->on_update<Components::Transform>().disconnect<&RenderSystem::OnStaticChanged>(*this);
+    m_Registry->on_destroy<Components::Transform>().disconnect<&RenderSystem::OnStaticChanged>(*this);
+    m_Registry->on_construct<Components::Renderable>().disconnect<&RenderSystem::OnStaticChanged>(*this);
+    m_Registry->on_update<Components::Renderable>().disconnect<&RenderSystem::OnStaticChanged>(*this);
+    m_Registry->on_destroy<Components::Renderable>().disconnect<&RenderSystem::OnStaticChanged>(*this);
+    m_Registry = nullptr;
+}
+
+/**
+ * @brief Invalida los layers afectados por un cambio en una entidad
+ *
+ * Se llama también para entidades dinámicas (cualquier patch de Transform),
+ * así que lo común tiene que ser barato: una búsqueda y un all_of.
+ * Marca sucio el layer donde estaba horneada y el layer al que pertenece
+ * ahora (distintos si el cambio fue de layer).
+ */
+void RenderSystem::OnStaticChanged(entt::registry& registry, entt::entity entity) {
+    auto baked = m_StaticMembership.find(entity);
+    if (baked != m_StaticMembership.end()) {
+        MarkStaticDirty(baked->second);
+        m_StaticMembership.erase(baked);
+    }
+
+    if (registry.all_of<Components::Static, Components::Renderable>(entity)) {
+        MarkStaticDirty(registry.get<Components::Renderable>(entity).layer);
+    }
+}
+
+RenderSystem::StaticLayer& RenderSystem::FindOrAddStaticLayer(int layer) {
+    auto it = std::lower_bound(m_StaticLayers.begin(), m_StaticLayers.end(), layer,
+                               [](const StaticLayer& a, int l) { return a.layer < l; });
+    if (it == m_StaticLayers.end() || it->layer != layer) {
+        StaticLayer staticLayer;
+        staticLayer.layer = layer;
+        it = m_StaticLayers.insert(it, staticLayer);
+    }
+    return *it;
+}
+
+/**
+ * @brief Rehace los batches de los layers sucios
+ *
+ * Una sola pasada por las entidades estáticas: se recogen las de layers
+ * sucios con claves [layer | textura | índice] (mismo radix sort que los
+ * dinámicos) y cada layer se sube como un rango contiguo. Las ocultas no
+ * se hornean pero sí se recuerda su layer, para que volver a mostrarlas
+ * rehaga el batch correcto.
+ */
+void RenderSystem::RebuildStaticLayers(entt::registry& registry,
+                                       Infrastructure::Rendering::IRenderer& renderer) {
+    if (!m_StaticDirty) {
+        return;
+    }
+    m_StaticDirty = false;
+
+    m_StaticSprites.clear();
+    m_StaticKeys.clear();
+
+    auto view = registry.view<Components::Transform, Components::Renderable, Components::Static>();
+    for (auto entity : view) {
+        const auto& renderable = view.get<Components::Renderable>(entity);
+        const int layer = ClampLayer(renderable.layer);
+
+        auto it = std::lower_bound(m_StaticLayers.begin(), m_StaticLayers.end(), layer,
+                                   [](const StaticLayer& a, int l) { return a.layer < l; });
+        if (it == m_StaticLayers.end() || it->layer != layer || !it->dirty) {
+            continue;
+        }
+
+        m_StaticMembership[entity] = layer;
+        if (!renderable.visible) {
+            continue;
+        }
+
+        if (m_StaticSprites.size() >= MAX_SPRITES_PER_FRAME) {
+            spdlog::warn("RenderSystem: límite de {} sprites estáticos alcanzado", MAX_SPRITES_PER_FRAME);
+            break;
+        }
+
+        const auto& transform = view.get<Components::Transform>(entity);
+        const auto index = static_cast<uint32_t>(m_StaticSprites.size());
+        m_StaticKeys.push_back(MakeSortKey(layer, renderable.texture.index, index));
+        m_StaticSprites.push_back({
+            renderable.texture,
+            {transform.position, renderable.size * transform.scale, transform.rotation, renderable.color}
+        });
+    }
+
+    Utils::RadixSort64(m_StaticKeys, m_ScratchKeys, INDEX_BYTES);
+
+    size_t cursor = 0;
+    for (auto& staticLayer : m_StaticLayers) {
+        if (!staticLayer.dirty) {
+            continue;
+        }
+        staticLayer.dirty = false;
+
+        // Las claves van ordenadas por layer: el rango de este layer empieza en cursor
+        m_StaticUpload.clear();
+        glm::vec2 boundsMin{0.0f};
+        glm::vec2 boundsMax{0.0f};
+        for (; cursor < m_StaticKeys.size() && KeyLayer(m_StaticKeys[cursor]) == staticLayer.layer; ++cursor) {
+            const auto& staticSprite = m_StaticSprites[m_StaticKeys[cursor] & INDEX_MASK];
+            const auto& sprite = staticSprite.sprite;
+
+            // Bounding circle de cada sprite (cubre cualquier rotación)
+            const glm::vec2 center = sprite.position + 0.5f * sprite.size;
+            const glm::vec2 radius{0.5f * glm::length(sprite.size)};
+            boundsMin = m_StaticUpload.empty() ? center - radius : glm::min(boundsMin, center - radius);
+            boundsMax = m_StaticUpload.empty() ? center + radius : glm::max(boundsMax, center + radius);
+            m_StaticUpload.push_back(staticSprite);
+        }
+
+        staticLayer.spriteCount = static_cast<uint32_t>(m_StaticUpload.size());
+        staticLayer.boundsMin = boundsMin;
+        staticLayer.boundsMax = boundsMax;
+        m_Stats.staticRebuilt++;
+
+        if (m_StaticUpload.empty()) {
+            continue;   // Se elimina abajo
+        }
+
+        if (staticLayer.batch == Infrastructure::Rendering::IRenderer::INVALID_STATIC_BATCH) {
+            staticLayer.batch = renderer.CreateStaticBatch();
+        }
+        if (!renderer.UpdateStaticBatch(staticLayer.batch, m_StaticUpload.data(), m_StaticUpload.size())) {
+            spdlog::error("RenderSystem: no se pudo hornear el layer estático {}", staticLayer.layer);
+            staticLayer.spriteCount = 0;
+        }
+    }
+
+    // Layers que se quedaron sin sprites visibles
+    auto empty = std::remove_if(m_StaticLayers.begin(), m_StaticLayers.end(),
+                                [&renderer](const StaticLayer& staticLayer) {
+        if (staticLayer.spriteCount > 0) {
+            return false;
+        }
+        if (staticLayer.batch != Infrastructure::Rendering::IRenderer::INVALID_STATIC_BATCH) {
+            renderer.DestroyStaticBatch(staticLayer.batch);
+        }
+        return true;
+    });
+    m_StaticLayers.erase(empty, m_StaticLayers.end());
+}
+
+void RenderSystem::DrawStaticLayers(int maxLayer, size_t& next,
+                                    Infrastructure::Rendering::IRenderer& renderer,
+                                    const ViewBounds& bounds) {
+    for (; next < m_StaticLayers.size() && m_StaticLayers[next].layer <= maxLayer; ++next) {
+        const auto& staticLayer = m_StaticLayers[next];
+
+        // Culling del layer entero: si nada cae en pantalla, ni un draw call
+        if (staticLayer.boundsMax.x < bounds.min.x || staticLayer.boundsMin.x > bounds.max.x ||
+            staticLayer.boundsMax.y < bounds.min.y || staticLayer.boundsMin.y > bounds.max.y) {
+            continue;
+        }
+
+        renderer.DrawStaticBatch(staticLayer.batch);
+        m_Stats.staticLayers++;
+        m_Stats.staticSprites += staticLayer.spriteCount;
+    }
+}
 
 } // namespace MultiNinjaEspacial::Core::Systems
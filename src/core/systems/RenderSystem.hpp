@@ -0,0 +1,259 @@
+// ============================================================================
+// Render System - Header
+// ============================================================================
+
+#pragma once
+
+#include "../../infrastructure/rendering/IRenderer.hpp"
+#include "CameraSystem.hpp"
+#include <entt/entt.hpp>
+#include <glm/glm.hpp>
+#include <cstdint>
+#include <unordered_map>
+#include <vector>
+
+namespace MultiNinjaEspacial::Core::Systems {
+
+/**
+ * @brief Sistema que dibuja las entidades con Transform + Renderable
+ *
+ * Cada frame:
+ * 1. Recorre la view y descarta entidades invisibles o fuera de pantalla
+ *    (con cámaras: fuera de todas ellas)
+ * 2. Construye una clave de 64 bits por sprite: [layer | textura | índice]
+ * 3. Ordena las claves con radix sort (O(n), estable)
+ * 4. Envía los sprites al IRenderer en ese orden (con cámaras: una vez por
+ *    cámara, solo los que esa cámara ve, tras IRenderer::SetView)
+ *
+ * Ordenar por textura dentro de cada layer agrupa sprites con la misma
+ * textura, lo que minimiza cambios de estado y rupturas de batch.
+ *
+ * Las entidades con el tag Static no entran en ese recorrido: se hornean en
+ * un batch estático del renderer por layer, que solo se rehace cuando
+ * alguna de sus entidades cambia (señales de EnTT). Cada frame un layer
+ * estático es un DrawStaticBatch, dibujado antes que los sprites dinámicos
+ * del mismo layer, sin trabajo por sprite en la CPU.
+ *
+ * Las entidades con PreviousTransform se dibujan interpoladas entre el
+ * paso de simulación anterior y el actual (SetInterpolationAlpha), para que
+ * el movimiento sea suave aunque la simulación vaya a menos Hz que el
+ * render.
+ *
+ * A diferencia de MovementSystem, este sistema tiene estado: reutiliza sus
+ * buffers entre frames para no asignar memoria en el path de render. Los
+ * batches estáticos viven en el renderer: usar siempre el mismo (o el
+ * grabador de su hilo de render) y un registry que sobreviva al sistema.
+ *
+ * Ejemplo de uso:
+ * ```cpp
+ * RenderSystem renderSystem;
+ *
+ * // En GameLoop::Render()
+ * RenderSystem::ViewBounds bounds{{0, 0}, {800, 600}};
+ * renderSystem.Render(registry, renderer, bounds);
+ *
+ * // O con las entidades Camera (varias vistas, un solo recorrido)
+ * cameraSystem.Update(registry, {800, 600});
+ * renderSystem.Render(registry, renderer, cameraSystem);
+ * ```
+ */
+class RenderSystem {
+public:
+    /**
+     * @brief Rectángulo visible en coordenadas del mundo
+     */
+    struct ViewBounds {
+        glm::vec2 min{0.0f, 0.0f};
+        glm::vec2 max{0.0f, 0.0f};
+    };
+
+    /**
+     * @brief Métricas del último frame
+     */
+    struct Stats {
+        uint32_t visited{0};    // Entidades recorridas
+        uint32_t hidden{0};     // Descartadas por visible == false
+        uint32_t culled{0};     // Descartadas por estar fuera de pantalla (de todas las cámaras)
+        uint32_t submitted{0};  // Enviadas al renderer (una vez por cámara que las ve)
+        uint32_t views{0};      // Vistas dibujadas
+        uint32_t staticLayers{0};   // Batches estáticos dibujados
+        uint32_t staticSprites{0};  // Sprites dentro de esos batches
+        uint32_t staticRebuilt{0};  // Layers estáticos rehechos este frame
+    };
+
+    // Límites del empaquetado de la clave de ordenación
+    static constexpr uint32_t INDEX_BITS = 24;
+    static constexpr uint32_t TEXTURE_BITS = 24;
+    static constexpr uint32_t MAX_SPRITES_PER_FRAME = 1u << INDEX_BITS;
+
+    RenderSystem() = default;
+    ~RenderSystem();
+
+    // Las señales del registry apuntan a esta instancia
+    RenderSystem(const RenderSystem&) = delete;
+    RenderSystem& operator=(const RenderSystem&) = delete;
+
+    /**
+     * @brief Dibuja todas las entidades visibles
+     * @param registry Registro de EnTT
+     * @param renderer Renderer destino
+     * @param bounds Zona visible (lo que quede fuera se descarta)
+     */
+    void Render(entt::registry& registry,
+                Infrastructure::Rendering::IRenderer& renderer,
+                const ViewBounds& bounds);
+
+    /**
+     * @brief Dibuja todas las entidades visibles con cada cámara
+     * @param registry Registro de EnTT
+     * @param renderer Renderer destino
+     * @param cameras Cámaras ya actualizadas (CameraSystem::Update)
+     *
+     * Un solo recorrido y una sola ordenación para todas las cámaras; cada
+     * cámara recibe su SetView y solo los sprites que ve. Al terminar deja
+     * el renderer en la vista de pantalla. Sin cámaras activas no dibuja.
+     */
+    void Render(entt::registry& registry,
+                Infrastructure::Rendering::IRenderer& renderer,
+                const CameraSystem& cameras);
+
+    /**
+     * @brief Fija el punto entre los dos últimos pasos de simulación
+     * @param alpha 0 = paso anterior (PreviousTransform), 1 = Transform actual
+     *
+     * GameLoop lo calcula cada frame como acumulador / paso fijo.
+     */
+    void SetInterpolationAlpha(float alpha) { m_InterpolationAlpha = glm::clamp(alpha, 0.0f, 1.0f); }
+
+    [[nodiscard]] float GetInterpolationAlpha() const { return m_InterpolationAlpha; }
+
+    /**
+     * @brief Fuerza a rehacer el batch estático de un layer
+     * @param layer Layer del Renderable
+     *
+     * Para cambios que no emiten señales (escritura directa vía get()).
+     */
+    void MarkStaticDirty(int layer);
+
+    /**
+     * @brief Fuerza a rehacer todos los batches estáticos
+     *
+     * Necesario si las texturas se reorganizan (BuildTextureAtlas): las UVs
+     * quedan horneadas en los batches. También tras UnloadTexture: el
+     * renderer vacía los batches que usaban la textura descargada.
+     */
+    void InvalidateStatic();
+
+    /**
+     * @brief Layers con batch estático
+     */
+    [[nodiscard]] size_t GetStaticLayerCount() const { return m_StaticLayers.size(); }
+
+    /**
+     * @brief Construye la clave de ordenación de un sprite
+     * @param layer Layer del Renderable (mayor = encima)
+     * @param textureKey Clave numérica de la textura (índice del TextureHandle)
+     * @param index Índice del sprite en el frame
+     * @return Clave [layer:16 | textura:24 | índice:24]
+     */
+    [[nodiscard]] static uint64_t MakeSortKey(int layer, uint32_t textureKey, uint32_t index);
+
+    /**
+     * @brief Obtiene las métricas del último Render()
+     */
+    [[nodiscard]] const Stats& GetStats() const { return m_Stats; }
+
+private:
+    /**
+     * @brief Datos de un sprite que pasó el culling
+     */
+    struct DrawItem {
+        glm::vec2 position;
+        glm::vec2 size;
+        float rotation;
+        glm::vec4 color;
+        Components::TextureHandle texture;
+        uint32_t viewMask;      // Bit i = lo ve la vista i
+    };
+
+    /**
+     * @brief Batch estático de un layer
+     */
+    struct StaticLayer {
+        int layer{0};
+        Infrastructure::Rendering::IRenderer::StaticBatchId batch{
+            Infrastructure::Rendering::IRenderer::INVALID_STATIC_BATCH};
+        uint32_t spriteCount{0};
+        glm::vec2 boundsMin{0.0f};      // AABB de todos sus sprites (culling del layer)
+        glm::vec2 boundsMax{0.0f};
+        bool dirty{true};
+    };
+
+    /**
+     * @brief Recorre las entidades dinámicas, descarta y ordena
+     * @param views Zonas visibles (máximo CameraSystem::MAX_CAMERAS)
+     */
+    void CollectVisible(entt::registry& registry, Infrastructure::Rendering::IRenderer& renderer,
+                        const ViewBounds* views, uint32_t viewCount);
+
+    /**
+     * @brief Envía los sprites de una vista, intercalando los layers estáticos
+     * @param viewBit Bit de la vista en DrawItem::viewMask
+     */
+    void SubmitView(Infrastructure::Rendering::IRenderer& renderer,
+                    const ViewBounds& bounds, uint32_t viewBit);
+
+    /**
+     * @brief Conecta las señales que invalidan los layers estáticos
+     */
+    void Connect(entt::registry& registry);
+
+    /**
+     * @brief Desconecta las señales del registry actual
+     */
+    void Disconnect();
+
+    /**
+     * @brief Señal de EnTT: Transform/Renderable/Static de una entidad cambió
+     */
+    void OnStaticChanged(entt::registry& registry, entt::entity entity);
+
+    /**
+     * @brief Busca un layer estático (lo crea, sucio, si no existe)
+     */
+    StaticLayer& FindOrAddStaticLayer(int layer);
+
+    /**
+     * @brief Rehace los batches de los layers sucios
+     */
+    void RebuildStaticLayers(entt::registry& registry, Infrastructure::Rendering::IRenderer& renderer);
+
+    /**
+     * @brief Dibuja los layers estáticos pendientes hasta un layer (incluido)
+     * @param next Índice del siguiente layer estático por dibujar (avanza)
+     */
+    void DrawStaticLayers(int maxLayer, size_t& next,
+                          Infrastructure::Rendering::IRenderer& renderer,
+                          const ViewBounds& bounds);
+
+    // Buffers reutilizados entre frames
+    std::vector<DrawItem> m_Items;
+    std::vector<uint64_t> m_Keys;
+    std::vector<uint64_t> m_ScratchKeys;
+    std::vector<ViewBounds> m_ViewBounds;
+
+    // Geometría estática
+    entt::registry* m_Registry{nullptr};
+    std::vector<StaticLayer> m_StaticLayers;                    // Ordenados por layer
+    std::unordered_map<entt::entity, int> m_StaticMembership;   // Entidad → layer horneado
+    std::vector<Infrastructure::Rendering::IRenderer::StaticSprite> m_StaticSprites;
+    std::vector<uint64_t> m_StaticKeys;
+    std::vector<Infrastructure::Rendering::IRenderer::StaticSprite> m_StaticUpload;
+    bool m_StaticDirty{false};
+
+    float m_InterpolationAlpha{1.0f};
+
+    Stats m_Stats;
+};
+
+} // namespace MultiNinjaEspacial::Core::Systems
@@ -0,0 +1,91 @@
+// ============================================================================
+// Radix Sort - Ordenación LSD de claves de 64 bits
+// ============================================================================
+// Ordenación estable O(n) para claves empaquetadas (ej: claves de render)
+// ============================================================================
+
+#pragma once
+
+#include <array>
+#include <cstdint>
+#include <utility>
+#include <vector>
+
+namespace MultiNinjaEspacial::Core::Utils {
+
+/**
+ * @brief Ordena claves de 64 bits con radix sort LSD (dígitos de 8 bits)
+ * @param keys Claves a ordenar (se ordenan in-place)
+ * @param scratch Buffer auxiliar reutilizable (se redimensiona si hace falta)
+ * @param firstByte Primer byte a ordenar (0 = clave completa)
+ *
+ * Características:
+ * - Estable: claves iguales conservan el orden de entrada
+ * - Un único recorrido calcula los 8 histogramas
+ * - Se saltan las pasadas cuyo byte es igual en todas las claves
+ *   (típico: pocas capas y pocas texturas → 2-3 pasadas efectivas)
+ *
+ * Si los bytes inferiores a firstByte ya vienen ordenados en la entrada
+ * (ej: un índice secuencial), no hace falta ordenarlos: la estabilidad
+ * garantiza que se conserva su orden.
+ *
+ * Ejemplo de uso:
+ * ```cpp
+ * std::vector<uint64_t> keys = {...};
+ * std::vector<uint64_t> scratch;
+ * RadixSort64(keys, scratch);
+ * ```
+ */
+inline void RadixSort64(std::vector<uint64_t>& keys, std::vector<uint64_t>& scratch,
+                        unsigned firstByte = 0) {
+    constexpr unsigned BYTES = 8;
+    const size_t count = keys.size();
+    if (count < 2 || firstByte >= BYTES) {
+        return;
+    }
+
+    // Histogramas de los 8 bytes en un solo recorrido
+    std::array<std::array<uint32_t, 256>, BYTES> histograms{};
+    for (uint64_t key : keys) {
+        for (unsigned byte = firstByte; byte < BYTES; ++byte) {
+            histograms[byte][(key >> (byte * 8)) & 0xFF]++;
+        }
+    }
+
+    scratch.resize(count);
+    uint64_t* src = keys.data();
+    uint64_t* dst = scratch.data();
+
+    for (unsigned byte = firstByte; byte < BYTES; ++byte) {
+        auto& histogram = histograms[byte];
+
+        // Si todas las claves comparten este byte, la pasada no cambia nada
+        const uint64_t firstDigit = (src[0] >> (byte * 8)) & 0xFF;
+        if (histogram[firstDigit] == count) {
+            continue;
+        }
+
+        // Prefijos exclusivos → posición de inicio de cada dígito
+        uint32_t offset = 0;
+        for (auto& bucket : histogram) {
+            const uint32_t bucketCount = bucket;
+            bucket = offset;
+            offset += bucketCount;
+        }
+
+        const unsigned shift = byte * 8;
+        for (size_t i = 0; i < count; ++i) {
+            const uint64_t key = src[i];
+            dst[histogram[(key >> shift) & 0xFF]++] = key;
+        }
+
+        std::swap(src, dst);
+    }
+
+    // Si el resultado quedó en el buffer auxiliar, intercambiar
+    if (src != keys.data()) {
+        keys.swap(scratch);
+    }
+}
+
+} // namespace MultiNinjaEspacial::Core::Utils
@@ -0,0 +1,69 @@
+// ============================================================================
+// Dynamic Resolution - Implementación
+// ============================================================================
+
+#include "DynamicResolution.hpp"
+#include <spdlog/spdlog.h>
+#include <algorithm>
+#include <cmath>
+
+namespace MultiNinjaEspacial::Infrastructure::Rendering {
+
+float DynamicResolution::Update(float gpuTime) {
+    if (!(gpuTime > 0.0f)) {
+        return m_Stats.scale;
+    }
+
+    // Medidas todavía de la escala anterior
+    if (m_StaleFrames > 0) {
+        m_StaleFrames--;
+        return m_Stats.scale;
+    }
+
+    m_Stats.gpuTime = m_Samples == 0 ? gpuTime : m_Stats.gpuTime + (gpuTime - m_Stats.gpuTime) * SMOOTHING;
+    m_Samples++;
+    if (m_Samples < MIN_SAMPLES) {
+        return m_Stats.scale;
+    }
+
+    const float scale = m_Stats.scale;
+    float target = scale;
+    if (m_Stats.gpuTime > m_GpuBudget) {
+        // Coste ∝ píxeles: escala que deja el frame justo en el presupuesto
+        target = scale * std::sqrt(m_GpuBudget / m_Stats.gpuTime);
+        target = std::max(target, scale - MAX_STEP_DOWN);
+    } else if (m_Stats.gpuTime < m_GpuBudget * RAISE_THRESHOLD && scale < 1.0f) {
+        // Subir sin pasar del umbral: la siguiente medida no debe obligar a bajar
+        target = scale * std::sqrt(m_GpuBudget * RAISE_THRESHOLD / m_Stats.gpuTime);
+        target = std::min(target, scale + MAX_STEP_UP);
+    } else {
+        return scale;
+    }
+
+    // Cuantizar hacia abajo (el margen de redondeo evita perder un paso exacto)
+    target = std::floor(target / SCALE_QUANTUM + 1e-3f) * SCALE_QUANTUM;
+    target = std::clamp(target, IRenderer::MIN_RESOLUTION_SCALE, 1.0f);
+    if (std::abs(target - scale) < 0.5f * SCALE_QUANTUM) {
+        return scale;
+    }
+
+    spdlog::debug("DynamicResolution: {:.2f} → {:.2f} (GPU {:.2f}ms, presupuesto {:.2f}ms)",
+                  scale, target, m_Stats.gpuTime, m_GpuBudget);
+
+    m_Stats.changes++;
+    if (target < scale) {
+        m_Stats.decreases++;
+    }
+    m_Stats.scale = target;
+    m_Samples = 0;
+    m_StaleFrames = STALE_FRAMES;
+    return target;
+}
+
+void DynamicResolution::Reset() {
+    m_Samples = 0;
+    m_StaleFrames = 0;
+    m_Stats = Stats{};
+}
+
+} // namespace MultiNinjaEspacial::Infrastructure::Rendering
@@ -0,0 +1,100 @@
+// ============================================================================
+// Dynamic Resolution - Escala de resolución guiada por el tiempo de GPU
+// ============================================================================
+// Independiente de la API gráfica: recibe el tiempo de GPU de cada frame
+// (RenderStats::frameTime) y decide la escala para IRenderer::SetResolutionScale
+// ============================================================================
+
+#pragma once
+
+#include "IRenderer.hpp"
+#include <cstdint>
+
+namespace MultiNinjaEspacial::Infrastructure::Rendering {
+
+/**
+ * @brief Controlador de resolución dinámica
+ *
+ * Funcionamiento:
+ * - Suaviza el tiempo de GPU (media exponencial) para no reaccionar a picos.
+ * - Por encima del presupuesto baja la escala; por debajo del
+ *   RAISE_THRESHOLD del presupuesto la sube. El coste se estima
+ *   proporcional a los píxeles (escala²), así que casi siempre acierta al
+ *   primer ajuste.
+ * - Baja rápido (hasta MAX_STEP_DOWN) y sube despacio (MAX_STEP_UP), en
+ *   pasos de SCALE_QUANTUM para que la imagen no "respire".
+ * - Tras un cambio descarta los frames cuya medida aún es de la escala
+ *   anterior (los timer queries llegan con retraso).
+ *
+ * Ejemplo de uso:
+ * ```cpp
+ * DynamicResolution dynamicResolution;
+ * dynamicResolution.SetGpuBudget(5.0f);
+ *
+ * // Tras cada Present:
+ * float scale = dynamicResolution.Update(renderer.GetStats().frameTime);
+ * renderer.SetResolutionScale(scale);
+ * ```
+ */
+class DynamicResolution {
+public:
+    // 30% de un frame de 60 FPS (objetivo de GPU en streaming, ver .spec/project.md)
+    static constexpr float DEFAULT_GPU_BUDGET = 5.0f;
+
+    static constexpr float SCALE_QUANTUM = 0.05f;
+    static constexpr float MAX_STEP_DOWN = 0.15f;
+    static constexpr float MAX_STEP_UP = 0.05f;
+
+    // Solo se sube si sobra margen (evita oscilar alrededor del presupuesto)
+    static constexpr float RAISE_THRESHOLD = 0.8f;
+
+    // Peso de cada muestra en la media exponencial
+    static constexpr float SMOOTHING = 0.1f;
+
+    // Frames ignorados tras un cambio (latencia de los timer queries)
+    static constexpr uint32_t STALE_FRAMES = 4;
+
+    // Muestras necesarias antes de decidir
+    static constexpr uint32_t MIN_SAMPLES = 8;
+
+    /**
+     * @brief Estado y métricas
+     */
+    struct Stats {
+        float scale{1.0f};          // Escala actual
+        float gpuTime{0.0f};        // Tiempo de GPU suavizado (ms)
+        uint32_t changes{0};        // Cambios de escala desde Reset
+        uint32_t decreases{0};      // De ellos, bajadas
+    };
+
+    /**
+     * @brief Presupuesto de GPU por frame
+     * @param milliseconds Tiempo de GPU objetivo
+     */
+    void SetGpuBudget(float milliseconds) { m_GpuBudget = milliseconds; }
+
+    [[nodiscard]] float GetGpuBudget() const { return m_GpuBudget; }
+
+    /**
+     * @brief Registra el tiempo de GPU de un frame y devuelve la escala
+     * @param gpuTime Milisegundos (0 = sin medida: la escala no cambia)
+     * @return Escala para el siguiente frame
+     */
+    float Update(float gpuTime);
+
+    /**
+     * @brief Vuelve a escala 1 y borra el historial
+     */
+    void Reset();
+
+    [[nodiscard]] float GetScale() const { return m_Stats.scale; }
+    [[nodiscard]] const Stats& GetStats() const { return m_Stats; }
+
+private:
+    float m_GpuBudget{DEFAULT_GPU_BUDGET};
+    uint32_t m_Samples{0};
+    uint32_t m_StaleFrames{0};
+    Stats m_Stats;
+};
+
+} // namespace MultiNinjaEspacial::Infrastructure::Rendering
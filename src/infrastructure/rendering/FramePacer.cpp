@@ -0,0 +1,205 @@
+// ============================================================================
+// Frame Pacer - Implementación
+// ============================================================================
+
+#include "FramePacer.hpp"
+#include <algorithm>
+#include <cmath>
+#include <thread>
+
+namespace MultiNinjaEspacial::Infrastructure::Rendering {
+
+namespace {
+
+float ToMilliseconds(FramePacer::Clock::duration duration) {
+    return std::chrono::duration<float, std::milli>(duration).count();
+}
+
+FramePacer::Clock::duration FromMilliseconds(float milliseconds) {
+    return std::chrono::duration_cast<FramePacer::Clock::duration>(
+        std::chrono::duration<float, std::milli>(milliseconds));
+}
+
+} // namespace
+
+void FramePacer::SetTargetFPS(int targetFPS) {
+    m_TargetFPS = std::max(targetFPS, 0);
+    m_FrameTime = m_TargetFPS > 0
+        ? std::chrono::duration_cast<Clock::duration>(std::chrono::duration<double>(1.0 / m_TargetFPS))
+        : Clock::duration::zero();
+
+    // El calendario anterior era de otro ritmo
+    m_Started = false;
+}
+
+void FramePacer::SetRefreshRate(float hz) {
+    m_RefreshPeriod = hz > 0.0f
+        ? std::chrono::duration_cast<Clock::duration>(std::chrono::duration<double>(1.0 / hz))
+        : Clock::duration::zero();
+    m_HasVBlank = false;
+}
+
+void FramePacer::NotifyVBlank(TimePoint time) {
+    if (m_RefreshPeriod <= Clock::duration::zero()) {
+        return;
+    }
+
+    if (!m_HasVBlank) {
+        m_VBlankPhase = time;
+        m_HasVBlank = true;
+        return;
+    }
+
+    // Error respecto al vblank predicho (entre -periodo/2 y +periodo/2)
+    const Clock::duration error = time - AlignToVBlank(time, m_VBlankPhase, m_RefreshPeriod);
+    m_VBlankPhase += Clock::duration(static_cast<Clock::rep>(
+        static_cast<float>(error.count()) * VBLANK_SMOOTHING));
+}
+
+void FramePacer::Reset(TimePoint now) {
+    const float sleepMargin = m_Stats.sleepMargin;
+    m_Stats = Stats{};
+    m_Stats.sleepMargin = sleepMargin;     // Depende del sistema, no de la partida
+
+    m_HistoryCount = 0;
+    m_HistoryNext = 0;
+
+    m_Schedule = now;
+    m_Deadline = now;
+    m_Deadline = Advance();
+    m_LastWake = now;
+    m_Started = true;
+}
+
+/**
+ * @brief Espera al siguiente frame
+ *
+ * 1. Sleep grueso hasta SleepMargin antes del deadline
+ * 2. Espera activa: yield mientras falte más de SPIN_THRESHOLD, luego giro
+ * 3. Registro del error y cálculo del siguiente deadline
+ *
+ * Un frame que llega tarde no espera. Si llega tarde por más de un frame,
+ * el calendario se reinicia desde ahora (cuenta como missed).
+ */
+FramePacer::TimePoint FramePacer::Wait() {
+    TimePoint now = Clock::now();
+    if (m_FrameTime <= Clock::duration::zero()) {
+        return now;
+    }
+
+    if (!m_Started) {
+        Reset(now);
+    }
+
+    if (now - m_Deadline > m_FrameTime) {
+        m_Stats.missed++;
+        Record(m_Deadline, now);
+
+        m_Schedule = now;
+        m_Deadline = now;
+        m_Deadline = Advance();
+        return now;
+    }
+
+    if (now < m_Deadline) {
+        SleepUntil(m_Deadline);
+
+        while ((now = Clock::now()) < m_Deadline) {
+            if (m_Deadline - now > FromMilliseconds(SPIN_THRESHOLD)) {
+                std::this_thread::yield();
+            }
+        }
+    }
+
+    Record(m_Deadline, now);
+    m_Deadline = Advance();
+    return now;
+}
+
+FramePacer::TimePoint FramePacer::AlignToVBlank(TimePoint time, TimePoint phase, Clock::duration period) {
+    const double periods = static_cast<double>((time - phase).count()) / static_cast<double>(period.count());
+    return phase + period * static_cast<Clock::rep>(std::llround(periods));
+}
+
+/**
+ * @brief Avanza el calendario un frame
+ *
+ * El calendario nominal (m_Schedule) avanza exactamente un frame; solo el
+ * deadline se ajusta al vblank. Ajustar el propio calendario redondearía
+ * siempre hacia el mismo lado (60 FPS en 144 Hz son 2.4 vblank: se
+ * quedaría en 2 y el juego iría a 72 FPS).
+ */
+FramePacer::TimePoint FramePacer::Advance() {
+    m_Schedule += m_FrameTime;
+    if (!m_HasVBlank) {
+        return m_Schedule;
+    }
+
+    TimePoint aligned = AlignToVBlank(m_Schedule, m_VBlankPhase, m_RefreshPeriod);
+    if (aligned <= m_Deadline) {
+        aligned += m_RefreshPeriod;     // Más FPS que Hz: nunca dos frames en el mismo vblank
+    }
+    return aligned;
+}
+
+/**
+ * @brief Sleep grueso y adaptación del margen
+ *
+ * El margen tiene que cubrir lo que se pasa el sleep (con un 25% de
+ * holgura): si un sleep se pasa, el margen sube de golpe; si sobra, baja un
+ * MARGIN_DECAY por frame. Así la espera activa se queda en lo mínimo que
+ * permite el planificador de cada máquina.
+ */
+void FramePacer::SleepUntil(TimePoint deadline) {
+    const TimePoint target = deadline - FromMilliseconds(m_Stats.sleepMargin);
+    if (target <= Clock::now()) {
+        return;
+    }
+
+    std::this_thread::sleep_until(target);
+
+    const float needed = 1.25f * ToMilliseconds(Clock::now() - target);
+    float margin = m_Stats.sleepMargin;
+    if (needed > margin) {
+        margin = needed;
+    } else {
+        margin -= (margin - needed) * MARGIN_DECAY;
+    }
+    m_Stats.sleepMargin = std::clamp(margin, MIN_SLEEP_MARGIN, MAX_SLEEP_MARGIN);
+}
+
+void FramePacer::Record(TimePoint deadline, TimePoint wake) {
+    const float error = ToMilliseconds(wake - deadline);
+    m_Stats.lastError = error;
+    m_Stats.frames++;
+
+    m_Errors[m_HistoryNext] = error;
+    m_Intervals[m_HistoryNext] = ToMilliseconds(wake - m_LastWake);
+    m_LastWake = wake;
+    m_HistoryNext = (m_HistoryNext + 1) % HISTORY_SIZE;
+    m_HistoryCount = std::min(m_HistoryCount + 1, HISTORY_SIZE);
+
+    // HISTORY_SIZE muestras: recalcular entero cuesta menos que un yield
+    float sumError = 0.0f;
+    float maxError = 0.0f;
+    float sumInterval = 0.0f;
+    for (uint32_t i = 0; i < m_HistoryCount; ++i) {
+        sumError += std::abs(m_Errors[i]);
+        maxError = std::max(maxError, std::abs(m_Errors[i]));
+        sumInterval += m_Intervals[i];
+    }
+
+    const float count = static_cast<float>(m_HistoryCount);
+    const float meanInterval = sumInterval / count;
+    float variance = 0.0f;
+    for (uint32_t i = 0; i < m_HistoryCount; ++i) {
+        const float delta = m_Intervals[i] - meanInterval;
+        variance += delta * delta;
+    }
+
+    m_Stats.meanError = sumError / count;
+    m_Stats.maxError = maxError;
+    m_Stats.jitter = std::sqrt(variance / count);
+}
+
+} // namespace MultiNinjaEspacial::Infrastructure::Rendering
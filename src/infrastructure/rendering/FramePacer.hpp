@@ -0,0 +1,180 @@
+// ============================================================================
+// Frame Pacer - Limitador de frames de alta precisión
+// ============================================================================
+// Espera hasta el inicio del siguiente frame con error sub-milisegundo:
+// sleep grueso + espera activa final, opcionalmente alineado al vblank
+// ============================================================================
+
+#pragma once
+
+#include <array>
+#include <chrono>
+#include <cstdint>
+
+namespace MultiNinjaEspacial::Infrastructure::Rendering {
+
+/**
+ * @brief Limitador de frames con poco jitter
+ *
+ * std::this_thread::sleep_for se pasa de largo hasta un tick del
+ * planificador (~1 ms en Linux, más con carga), así que los frames caen a
+ * intervalos irregulares. FramePacer:
+ * - Duerme hasta SleepMargin antes del deadline. El margen se adapta al
+ *   retraso que se observa en cada sleep (sube en cuanto un sleep se pasa,
+ *   baja despacio si sobra).
+ * - El resto lo espera activamente: cede la CPU (yield) mientras falte más
+ *   de SPIN_THRESHOLD y gira en el último tramo.
+ * - Los deadlines avanzan desde el deadline anterior, no desde el momento
+ *   en que se despertó: el error de un frame no se acumula en los
+ *   siguientes. Si un frame llega tarde por más de un frame entero se
+ *   resincroniza (no se encadenan frames sin espera para recuperar).
+ * - Con la frecuencia del monitor y una estimación de sus vblank
+ *   (NotifyVBlank tras un swap con VSync), cada deadline se ajusta al
+ *   vblank más cercano.
+ *
+ * El error de cada frame (despertar - deadline) y el intervalo entre
+ * frames se guardan en un historial de HISTORY_SIZE frames.
+ *
+ * Ejemplo de uso:
+ * ```cpp
+ * FramePacer pacer;
+ * pacer.SetTargetFPS(144);
+ * pacer.Reset();
+ *
+ * while (running) {
+ *     Update();
+ *     Render();
+ *     window.SwapBuffers();
+ *     pacer.Wait();
+ * }
+ * spdlog::info("Jitter: {:.3f}ms", pacer.GetStats().jitter);
+ * ```
+ */
+class FramePacer {
+public:
+    using Clock = std::chrono::steady_clock;
+    using TimePoint = Clock::time_point;
+
+    // Margen inicial del sleep grueso y sus límites (ms)
+    static constexpr float DEFAULT_SLEEP_MARGIN = 1.0f;
+    static constexpr float MIN_SLEEP_MARGIN = 0.2f;
+    static constexpr float MAX_SLEEP_MARGIN = 4.0f;
+
+    // Fracción que baja el margen por frame si los sleeps van sobrados
+    static constexpr float MARGIN_DECAY = 0.01f;
+
+    // Por debajo de este tiempo restante (ms) se gira en vez de ceder la CPU
+    static constexpr float SPIN_THRESHOLD = 0.1f;
+
+    // Peso de cada vblank observado en la estimación de fase
+    static constexpr float VBLANK_SMOOTHING = 0.1f;
+
+    // Frames en el historial (error, intervalo)
+    static constexpr uint32_t HISTORY_SIZE = 128;
+
+    /**
+     * @brief Métricas del pacing (todo en ms)
+     */
+    struct Stats {
+        float lastError{0.0f};      // Despertar - deadline del último frame (> 0 = tarde)
+        float meanError{0.0f};      // Media de |error| en el historial
+        float maxError{0.0f};       // Máximo |error| en el historial
+        float jitter{0.0f};         // Desviación típica del intervalo entre frames
+        float sleepMargin{DEFAULT_SLEEP_MARGIN};    // Margen actual del sleep grueso
+        uint32_t frames{0};         // Frames esperados desde Reset
+        uint32_t missed{0};         // Frames que llegaron más de un frame tarde
+    };
+
+    /**
+     * @brief Configura los FPS objetivo
+     * @param targetFPS Frames por segundo (0 = sin límite: Wait no espera)
+     */
+    void SetTargetFPS(int targetFPS);
+
+    [[nodiscard]] int GetTargetFPS() const { return m_TargetFPS; }
+
+    /**
+     * @brief Frecuencia del monitor para alinear los frames a su vblank
+     * @param hz Frecuencia de refresco (0 = sin alineación)
+     *
+     * La alineación empieza con el primer NotifyVBlank.
+     */
+    void SetRefreshRate(float hz);
+
+    /**
+     * @brief Registra un vblank observado
+     * @param time Momento en que volvió un swap con VSync (≈ vblank)
+     *
+     * Afina la fase estimada de los vblank (media exponencial del error de
+     * predicción), así que el ruido de un swap concreto apenas la mueve.
+     */
+    void NotifyVBlank(TimePoint time = Clock::now());
+
+    /**
+     * @brief Reinicia el calendario y el historial
+     * @param now El primer deadline será now + un frame
+     */
+    void Reset(TimePoint now = Clock::now());
+
+    /**
+     * @brief Espera hasta el inicio del siguiente frame
+     * @return Momento en que se despertó
+     */
+    TimePoint Wait();
+
+    /**
+     * @brief Deadline del siguiente Wait
+     */
+    [[nodiscard]] TimePoint GetNextDeadline() const { return m_Deadline; }
+
+    [[nodiscard]] const Stats& GetStats() const { return m_Stats; }
+
+    /**
+     * @brief Ajusta un instante al vblank más cercano
+     * @param time Instante a ajustar
+     * @param phase Un vblank conocido
+     * @param period Periodo de refresco
+     */
+    [[nodiscard]] static TimePoint AlignToVBlank(TimePoint time, TimePoint phase, Clock::duration period);
+
+private:
+    /**
+     * @brief Avanza el calendario un frame
+     * @return Deadline del siguiente frame (con alineación al vblank)
+     */
+    [[nodiscard]] TimePoint Advance();
+
+    /**
+     * @brief Duerme hasta cerca de un instante y adapta el margen
+     */
+    void SleepUntil(TimePoint deadline);
+
+    /**
+     * @brief Guarda un frame en el historial y recalcula las métricas
+     */
+    void Record(TimePoint deadline, TimePoint wake);
+
+    int m_TargetFPS{0};
+    Clock::duration m_FrameTime{Clock::duration::zero()};
+
+    // Vblank estimado
+    Clock::duration m_RefreshPeriod{Clock::duration::zero()};
+    TimePoint m_VBlankPhase{};
+    bool m_HasVBlank{false};
+
+    // Calendario: nominal (avanza un frame exacto) y deadline (alineado)
+    TimePoint m_Schedule{};
+    TimePoint m_Deadline{};
+    TimePoint m_LastWake{};
+    bool m_Started{false};
+
+    // Historial circular (ms)
+    std::array<float, HISTORY_SIZE> m_Errors{};
+    std::array<float, HISTORY_SIZE> m_Intervals{};
+    uint32_t m_HistoryCount{0};
+    uint32_t m_HistoryNext{0};
+
+    Stats m_Stats;
+};
+
+} // namespace MultiNinjaEspacial::Infrastructure::Rendering
@@ -7,12 +7,19 @@
 
 #pragma once
 
+#include "../../core/components/TextureHandle.hpp"
 #include <glm/glm.hpp>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
 #include <string>
 #include <memory>
 
 namespace MultiNinjaEspacial::Infrastructure::Rendering {
 
+// Handle de textura compartido con el dominio (Renderable)
+using TextureHandle = Core::Components::TextureHandle;
+
 /**
  * @brief Interfaz abstracta para renderizado
  *
@@ -35,8 +42,10 @@ namespace MultiNinjaEspacial::Infrastructure::Rendering {
  * #endif
  *
  * renderer->Initialize(800, 600);
+ * TextureHandle tex = renderer->LoadTexture("player", "assets/sprites/player.png");
+ *
  * renderer->Clear({0.0f, 0.0f, 0.0f, 1.0f});
- * // ... drawing ...
+ * renderer->DrawSprite(tex, {400, 300}, {64, 64}, 0.0f, {1, 1, 1, 1});
  * renderer->Present();
  * ```
  */
@@ -77,35 +86,225 @@ public:
      */
     virtual void SetViewport(int x, int y, int width, int height) = 0;
 
+    /**
+     * @brief Dibuja lo que venga después con una cámara
+     * @param viewProjection Matriz mundo → clip
+     * @param viewport Zona de la ventana (x, y, ancho, alto en píxeles; y desde arriba)
+     *
+     * Vacía lo acumulado con la vista anterior. Dura hasta ResetView(),
+     * BeginOverlay() o Present(), que vuelven a la vista de pantalla
+     * (píxeles de la ventana, viewport completo).
+     */
+    virtual void SetView(const glm::mat4& viewProjection, const glm::ivec4& viewport) = 0;
+
+    /**
+     * @brief Vuelve a la vista de pantalla
+     */
+    virtual void ResetView() = 0;
+
+    // Escala mínima de la pasada del mundo (ver SetResolutionScale)
+    static constexpr float MIN_RESOLUTION_SCALE = 0.5f;
+
+    /**
+     * @brief Escala de resolución con la que se dibuja el mundo
+     * @param scale Fracción del tamaño de la ventana, [MIN_RESOLUTION_SCALE, 1]
+     *
+     * Se aplica en el siguiente Clear(). Con escala < 1 todo lo dibujado
+     * hasta BeginOverlay() va a un framebuffer reducido que después se
+     * escala a la ventana; las coordenadas no cambian (siguen siendo las
+     * de la ventana).
+     */
+    virtual void SetResolutionScale(float scale) = 0;
+
+    /**
+     * @brief Cierra la pasada del mundo y empieza la de interfaz
+     *
+     * Escala lo dibujado hasta ahora a la ventana; lo que se dibuje después
+     * (HUD, texto) va a resolución nativa. Si no se llama, lo hace Present().
+     */
+    virtual void BeginOverlay() = 0;
+
     /**
      * @brief Dibuja un sprite en 2D
-     * @param textureId ID de textura
+     * @param texture Handle de textura (inválido = blanco)
      * @param position Posición en pantalla
      * @param size Tamaño del sprite
      * @param rotation Rotación en grados
      * @param color Tint de color (RGBA)
      */
     virtual void DrawSprite(
-        const std::string& textureId,
+        TextureHandle texture,
         const glm::vec2& position,
         const glm::vec2& size,
         float rotation,
         const glm::vec4& color
     ) = 0;
 
+    /**
+     * @brief Sprite de un envío en bloque (DrawSprites)
+     */
+    struct SpriteDraw {
+        glm::vec2 position{0.0f};   // Esquina superior izquierda
+        glm::vec2 size{1.0f};
+        float rotation{0.0f};       // Grados, alrededor del centro
+        glm::vec4 color{1.0f};
+    };
+
+    /**
+     * @brief Dibuja muchos sprites con la misma textura
+     * @param texture Handle de textura compartido por todos
+     * @param sprites Array de sprites
+     * @param count Número de sprites
+     *
+     * Equivale a un DrawSprite por elemento, pero los backends con batching
+     * lo resuelven con una sola búsqueda de textura y una copia en bloque
+     * (partículas, tiles...).
+     */
+    virtual void DrawSprites(TextureHandle texture, const SpriteDraw* sprites, size_t count) {
+        for (size_t i = 0; i < count; ++i) {
+            DrawSprite(texture, sprites[i].position, sprites[i].size, sprites[i].rotation, sprites[i].color);
+        }
+    }
+
+    /**
+     * @brief Sprite de un batch estático (cada uno con su textura)
+     */
+    struct StaticSprite {
+        TextureHandle texture;
+        SpriteDraw sprite;
+    };
+
+    using StaticBatchId = uint32_t;
+    static constexpr StaticBatchId INVALID_STATIC_BATCH = 0xFFFFFFFFu;
+
+    /**
+     * @brief Crea un batch estático vacío
+     * @return ID del batch (INVALID_STATIC_BATCH si falla)
+     *
+     * Un batch estático guarda sus sprites en memoria del backend (en GPU
+     * con OpenGL): dibujarlo no copia ni procesa nada por sprite. Pensado
+     * para geometría que no se mueve (fondos, decorados, muebles).
+     */
+    virtual StaticBatchId CreateStaticBatch() = 0;
+
+    /**
+     * @brief Reemplaza el contenido de un batch estático
+     * @param batch ID del batch
+     * @param sprites Sprites (se copian; pueden mezclar texturas)
+     * @param count Número de sprites (0 = vacío)
+     * @return true si exitoso
+     *
+     * Los sprites se agrupan por textura (las regiones de una página de
+     * atlas comparten grupo): el orden de dibujo entre texturas distintas
+     * no se conserva. Las UVs de atlas se resuelven aquí, así que tras
+     * reorganizar texturas (BuildTextureAtlas) hay que volver a llenarlo.
+     */
+    virtual bool UpdateStaticBatch(StaticBatchId batch, const StaticSprite* sprites, size_t count) = 0;
+
+    /**
+     * @brief Dibuja un batch estático (en orden con el resto de draws)
+     */
+    virtual void DrawStaticBatch(StaticBatchId batch) = 0;
+
+    /**
+     * @brief Libera un batch estático
+     */
+    virtual void DestroyStaticBatch(StaticBatchId batch) = 0;
+
+    /**
+     * @brief Callback de fin de carga de una textura
+     * @param texture Handle de la textura
+     * @param success false si el archivo no se pudo leer/decodificar
+     */
+    using TextureLoadCallback = std::function<void(TextureHandle texture, bool success)>;
+
     /**
      * @brief Carga una textura desde archivo
      * @param id ID único para la textura
      * @param filepath Path al archivo de imagen
-     * @return true si carga exitosa
+     * @return Handle de la textura (inválido si falla)
+     *
+     * Si el ID ya estaba cargado, devuelve el handle existente.
+     * La carga puede ser asíncrona: el handle es válido de inmediato y,
+     * hasta que la textura esté residente, se dibuja un placeholder.
      */
-    virtual bool LoadTexture(const std::string& id, const std::string& filepath) = 0;
+    virtual TextureHandle LoadTexture(const std::string& id, const std::string& filepath) = 0;
 
     /**
-     * @brief Descarga una textura de memoria
+     * @brief Carga una textura y avisa cuando esté lista
+     * @param id ID único para la textura
+     * @param filepath Path al archivo de imagen
+     * @param onLoaded Se llama en el hilo de render al terminar la carga
+     * @return Handle de la textura (utilizable ya, con placeholder)
+     */
+    virtual TextureHandle LoadTextureAsync(const std::string& id, const std::string& filepath,
+                                           TextureLoadCallback onLoaded) = 0;
+
+    /**
+     * @brief Indica si la textura ya está en GPU (no se dibuja el placeholder)
+     */
+    [[nodiscard]] virtual bool IsTextureResident(TextureHandle texture) const = 0;
+
+    /**
+     * @brief Carga un atlas pre-empaquetado (ver tools/atlas_packer)
+     * @param manifestPath Path al manifest del atlas
+     * @return true si exitoso
+     *
+     * Cada región del manifest queda registrada como textura con su propio
+     * ID, resoluble con FindTexture(). Las regiones de una misma página se
+     * dibujan en un solo batch.
+     */
+    virtual bool LoadTextureAtlas(const std::string& manifestPath) = 0;
+
+    /**
+     * @brief Crea una textura a partir de píxeles en memoria
+     * @param id ID único para la textura
+     * @param width Ancho en píxeles
+     * @param height Alto en píxeles
+     * @param pixels RGBA8, width * height * 4 bytes (se copian)
+     * @return Handle de la textura (inválido si falla o el ID ya existe)
+     *
+     * Para texturas generadas en runtime (atlas de glyphs, etc.). La subida
+     * es inmediata y cuenta en RenderStats::uploadBytes.
+     */
+    virtual TextureHandle CreateTexture(const std::string& id, uint32_t width, uint32_t height,
+                                        const uint8_t* pixels) = 0;
+
+    /**
+     * @brief Registra un rectángulo de una textura como textura propia
+     * @param id ID único de la región
+     * @param page Textura que contiene la región
+     * @param x Columna de la esquina superior izquierda (px)
+     * @param y Fila de la esquina superior izquierda (px)
+     * @param width Ancho (px)
+     * @param height Alto (px)
+     * @return Handle de la región (inválido si la página no existe)
+     *
+     * Igual que las regiones de LoadTextureAtlas: todas las regiones de una
+     * página se dibujan en el mismo batch.
+     */
+    virtual TextureHandle CreateTextureRegion(const std::string& id, TextureHandle page,
+                                              uint32_t x, uint32_t y,
+                                              uint32_t width, uint32_t height) = 0;
+
+    /**
+     * @brief Resuelve el handle de una textura ya cargada
      * @param id ID de la textura
+     * @return Handle (inválido si no está cargada)
+     *
+     * Pensado para tiempo de carga, no para el path de render.
+     */
+    [[nodiscard]] virtual TextureHandle FindTexture(const std::string& id) const = 0;
+
+    /**
+     * @brief Descarga una textura de memoria
+     * @param texture Handle de la textura
+     *
+     * Los batches estáticos que la usan se vacían: tienen su slot y sus UVs
+     * horneados y el slot se reutiliza para la siguiente textura. Hay que
+     * rellenarlos otra vez (RenderSystem::InvalidateStatic).
      */
-    virtual void UnloadTexture(const std::string& id) = 0;
+    virtual void UnloadTexture(TextureHandle texture) = 0;
 
     /**
      * @brief Obtiene el nombre del backend de renderizado
@@ -115,19 +314,28 @@ public:
 
     /**
      * @brief Obtiene estadísticas de renderizado
-     * @return Struct con métricas (draw calls, triángulos, etc.)
+     * @return Struct con métricas del último frame presentado (draw calls, triángulos, etc.)
      */
     struct RenderStats {
         uint32_t drawCalls{0};
         uint32_t triangles{0};
         uint32_t vertices{0};
-        float frameTime{0.0f}; // en milisegundos
+        uint32_t batches{0};   // grupos de sprites enviados juntos
+        uint32_t sprites{0};   // sprites dibujados (sprites / batches = ahorro)
+        float frameTime{0.0f}; // GPU, en milisegundos (llega con unos frames de retraso)
+        float cpuSubmitTime{0.0f}; // CPU de Clear() a Present(), en milisegundos
+        uint64_t textureMemory{0}; // Bytes de texturas residentes en GPU
+        uint64_t uploadBytes{0};   // Bytes subidos a la GPU en el frame (texturas + instancias)
+        uint32_t staticSprites{0}; // De sprites, los dibujados desde batches estáticos
+        float resolutionScale{1.0f}; // Escala con la que se dibujó el mundo
     };
 
     [[nodiscard]] virtual RenderStats GetStats() const = 0;
 
     /**
-     * @brief Resetea estadísticas de renderizado (llamar cada frame)
+     * @brief Resetea las estadísticas del frame en curso
+     *
+     * Present() ya lo hace tras guardar las del frame que termina.
      */
     virtual void ResetStats() = 0;
 };
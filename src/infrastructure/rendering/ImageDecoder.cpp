@@ -0,0 +1,32 @@
+// ============================================================================
+// Image Decoder - Implementación
+// ============================================================================
+
+// Única unidad de traducción con la implementación de stb_image
+#define STB_IMAGE_IMPLEMENTATION
+#include <stb_image.h>
+
+#include "ImageDecoder.hpp"
+
+namespace MultiNinjaEspacial::Infrastructure::Rendering {
+
+bool DecodeImageFile(const std::string& filepath, DecodedImage& out, std::string& error) {
+    int width = 0;
+    int height = 0;
+    int channels = 0;
+
+    // Forzar 4 canales: todas las texturas se suben como RGBA8
+    stbi_uc* data = stbi_load(filepath.c_str(), &width, &height, &channels, 4);
+    if (data == nullptr) {
+        error = stbi_failure_reason();
+        return false;
+    }
+
+    out.width = static_cast<uint32_t>(width);
+    out.height = static_cast<uint32_t>(height);
+    out.pixels.assign(data, data + static_cast<size_t>(width) * height * 4);
+    stbi_image_free(data);
+    return true;
+}
+
+} // namespace MultiNinjaEspacial::Infrastructure::Rendering
@@ -0,0 +1,36 @@
+// ============================================================================
+// Image Decoder - Decodificación de imágenes a RGBA8
+// ============================================================================
+// Envoltorio sobre stb_image. Independiente de la API gráfica y seguro de
+// llamar desde varios hilos a la vez (lo usan los workers de TextureStreamer).
+// ============================================================================
+
+#pragma once
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace MultiNinjaEspacial::Infrastructure::Rendering {
+
+/**
+ * @brief Imagen decodificada en memoria (RGBA8, fila superior primero)
+ */
+struct DecodedImage {
+    uint32_t width{0};
+    uint32_t height{0};
+    std::vector<uint8_t> pixels;  // width * height * 4 bytes
+
+    [[nodiscard]] size_t GetSizeBytes() const { return pixels.size(); }
+};
+
+/**
+ * @brief Decodifica un archivo de imagen (PNG, JPG, TGA, BMP...)
+ * @param filepath Path al archivo
+ * @param out Imagen destino
+ * @param error Motivo del fallo (si lo hay)
+ * @return true si exitoso
+ */
+bool DecodeImageFile(const std::string& filepath, DecodedImage& out, std::string& error);
+
+} // namespace MultiNinjaEspacial::Infrastructure::Rendering
@@ -0,0 +1,192 @@
+// ============================================================================
+// Render Command List - Lista de comandos de dibujo en memoria
+// ============================================================================
+// Registro compacto de las llamadas de un frame a IRenderer, que se puede
+// inspeccionar (tests, benchmarks) o reproducir sobre otro renderer
+// ============================================================================
+
+#pragma once
+
+#include "IRenderer.hpp"
+#include <glm/glm.hpp>
+#include <cstdint>
+#include <vector>
+
+namespace MultiNinjaEspacial::Infrastructure::Rendering {
+
+/**
+ * @brief Un comando de dibujo (POD, sin asignaciones)
+ *
+ * Los campos se reutilizan según el tipo:
+ * - Clear: color
+ * - SetViewport: position = (x, y), size = (ancho, alto)
+ * - SetView: texture.index = índice en la tabla de vistas de la lista
+ * - ResetView: ninguno
+ * - SetResolutionScale: rotation = escala
+ * - BeginOverlay: ninguno
+ * - DrawStaticBatch: texture.index = ID del batch
+ * - DrawSprite: todos
+ */
+struct RenderCommand {
+    enum class Type : uint8_t {
+        Clear,
+        SetViewport,
+        SetView,
+        ResetView,
+        SetResolutionScale,
+        BeginOverlay,
+        DrawStaticBatch,
+        DrawSprite
+    };
+
+    Type type{Type::DrawSprite};
+    TextureHandle texture;
+    glm::vec2 position{0.0f};
+    glm::vec2 size{0.0f};
+    float rotation{0.0f};
+    glm::vec4 color{1.0f};
+};
+
+/**
+ * @brief Parámetros de un SetView (no caben en RenderCommand)
+ */
+struct RenderView {
+    glm::mat4 viewProjection{1.0f};
+    glm::ivec4 viewport{0, 0, 0, 0};
+};
+
+/**
+ * @brief Secuencia de comandos de un frame
+ *
+ * La memoria se conserva entre frames (Clear no libera), así que grabar un
+ * frame del mismo tamaño que el anterior no asigna.
+ *
+ * Ejemplo de uso:
+ * ```cpp
+ * RenderCommandList commands;
+ * commands.RecordClear({0, 0, 0, 1});
+ * commands.RecordSprite(texture, {10, 10}, {32, 32}, 0.0f, {1, 1, 1, 1});
+ *
+ * commands.Replay(openGLRenderer);
+ * commands.Clear();
+ * ```
+ */
+class RenderCommandList {
+public:
+    void RecordClear(const glm::vec4& color) {
+        RenderCommand command;
+        command.type = RenderCommand::Type::Clear;
+        command.color = color;
+        m_Commands.push_back(command);
+    }
+
+    void RecordViewport(int x, int y, int width, int height) {
+        RenderCommand command;
+        command.type = RenderCommand::Type::SetViewport;
+        command.position = {static_cast<float>(x), static_cast<float>(y)};
+        command.size = {static_cast<float>(width), static_cast<float>(height)};
+        m_Commands.push_back(command);
+    }
+
+    void RecordView(const glm::mat4& viewProjection, const glm::ivec4& viewport) {
+        RenderCommand command;
+        command.type = RenderCommand::Type::SetView;
+        command.texture = TextureHandle(static_cast<uint32_t>(m_Views.size()));
+        m_Views.push_back(RenderView{viewProjection, viewport});
+        m_Commands.push_back(command);
+    }
+
+    void RecordResetView() {
+        RenderCommand command;
+        command.type = RenderCommand::Type::ResetView;
+        m_Commands.push_back(command);
+    }
+
+    void RecordResolutionScale(float scale) {
+        RenderCommand command;
+        command.type = RenderCommand::Type::SetResolutionScale;
+        command.rotation = scale;
+        m_Commands.push_back(command);
+    }
+
+    void RecordBeginOverlay() {
+        RenderCommand command;
+        command.type = RenderCommand::Type::BeginOverlay;
+        m_Commands.push_back(command);
+    }
+
+    void RecordStaticBatch(IRenderer::StaticBatchId batch) {
+        RenderCommand command;
+        command.type = RenderCommand::Type::DrawStaticBatch;
+        command.texture = TextureHandle(batch);
+        m_Commands.push_back(command);
+    }
+
+    void RecordSprite(TextureHandle texture, const glm::vec2& position, const glm::vec2& size,
+                      float rotation, const glm::vec4& color) {
+        m_Commands.push_back(RenderCommand{RenderCommand::Type::DrawSprite, texture,
+                                           position, size, rotation, color});
+    }
+
+    /**
+     * @brief Ejecuta los comandos sobre un renderer, en orden
+     * @param renderer Destino (no se llama a Present)
+     */
+    void Replay(IRenderer& renderer) const {
+        for (const RenderCommand& command : m_Commands) {
+            switch (command.type) {
+                case RenderCommand::Type::Clear:
+                    renderer.Clear(command.color);
+                    break;
+                case RenderCommand::Type::SetViewport:
+                    renderer.SetViewport(static_cast<int>(command.position.x),
+                                         static_cast<int>(command.position.y),
+                                         static_cast<int>(command.size.x),
+                                         static_cast<int>(command.size.y));
+                    break;
+                case RenderCommand::Type::SetView: {
+                    const RenderView& view = m_Views[command.texture.index];
+                    renderer.SetView(view.viewProjection, view.viewport);
+                    break;
+                }
+                case RenderCommand::Type::ResetView:
+                    renderer.ResetView();
+                    break;
+                case RenderCommand::Type::SetResolutionScale:
+                    renderer.SetResolutionScale(command.rotation);
+                    break;
+                case RenderCommand::Type::BeginOverlay:
+                    renderer.BeginOverlay();
+                    break;
+                case RenderCommand::Type::DrawStaticBatch:
+                    renderer.DrawStaticBatch(command.texture.index);
+                    break;
+                case RenderCommand::Type::DrawSprite:
+                    renderer.DrawSprite(command.texture, command.position, command.size,
+                                        command.rotation, command.color);
+                    break;
+            }
+        }
+    }
+
+    /**
+     * @brief Vacía la lista conservando la capacidad
+     */
+    void Clear() {
+        m_Commands.clear();
+        m_Views.clear();
+    }
+
+    void Reserve(size_t count) { m_Commands.reserve(count); }
+
+    [[nodiscard]] const std::vector<RenderCommand>& GetCommands() const { return m_Commands; }
+    [[nodiscard]] const std::vector<RenderView>& GetViews() const { return m_Views; }
+    [[nodiscard]] size_t GetSize() const { return m_Commands.size(); }
+    [[nodiscard]] bool IsEmpty() const { return m_Commands.empty(); }
+
+private:
+    std::vector<RenderCommand> m_Commands;
+    std::vector<RenderView> m_Views;
+};
+
+} // namespace MultiNinjaEspacial::Infrastructure::Rendering
@@ -0,0 +1,284 @@
+// ============================================================================
+// Render Thread - Implementación
+// ============================================================================
+
+#include "RenderThread.hpp"
+#include <spdlog/spdlog.h>
+
+namespace MultiNinjaEspacial::Infrastructure::Rendering {
+
+// ----------------------------------------------------------------------------
+// RecordingRenderer
+// ----------------------------------------------------------------------------
+
+void RecordingRenderer::Clear(const glm::vec4& color) {
+    m_Thread.GetWriteList().RecordClear(color);
+}
+
+void RecordingRenderer::Present() {
+    m_Thread.SubmitFrame();
+}
+
+void RecordingRenderer::SetViewport(int x, int y, int width, int height) {
+    m_Thread.GetWriteList().RecordViewport(x, y, width, height);
+}
+
+void RecordingRenderer::SetView(const glm::mat4& viewProjection, const glm::ivec4& viewport) {
+    m_Thread.GetWriteList().RecordView(viewProjection, viewport);
+}
+
+void RecordingRenderer::ResetView() {
+    m_Thread.GetWriteList().RecordResetView();
+}
+
+void RecordingRenderer::SetResolutionScale(float scale) {
+    m_Thread.GetWriteList().RecordResolutionScale(scale);
+}
+
+void RecordingRenderer::BeginOverlay() {
+    m_Thread.GetWriteList().RecordBeginOverlay();
+}
+
+void RecordingRenderer::DrawSprite(
+    TextureHandle texture,
+    const glm::vec2& position,
+    const glm::vec2& size,
+    float rotation,
+    const glm::vec4& color
+) {
+    m_Thread.GetWriteList().RecordSprite(texture, position, size, rotation, color);
+}
+
+TextureHandle RecordingRenderer::LoadTexture(const std::string& id, const std::string& filepath) {
+    TextureHandle result;
+    m_Thread.Invoke([&](IRenderer& renderer) { result = renderer.LoadTexture(id, filepath); });
+    return result;
+}
+
+TextureHandle RecordingRenderer::LoadTextureAsync(const std::string& id, const std::string& filepath,
+                                                  TextureLoadCallback onLoaded) {
+    TextureHandle result;
+    m_Thread.Invoke([&](IRenderer& renderer) {
+        result = renderer.LoadTextureAsync(id, filepath, std::move(onLoaded));
+    });
+    return result;
+}
+
+bool RecordingRenderer::IsTextureResident(TextureHandle texture) const {
+    bool result = false;
+    m_Thread.Invoke([&](IRenderer& renderer) { result = renderer.IsTextureResident(texture); });
+    return result;
+}
+
+bool RecordingRenderer::LoadTextureAtlas(const std::string& manifestPath) {
+    bool result = false;
+    m_Thread.Invoke([&](IRenderer& renderer) { result = renderer.LoadTextureAtlas(manifestPath); });
+    return result;
+}
+
+TextureHandle RecordingRenderer::CreateTexture(const std::string& id, uint32_t width, uint32_t height,
+                                               const uint8_t* pixels) {
+    // Invoke es síncrono: los píxeles del llamador siguen vivos durante la subida
+    TextureHandle result;
+    m_Thread.Invoke([&](IRenderer& renderer) { result = renderer.CreateTexture(id, width, height, pixels); });
+    return result;
+}
+
+TextureHandle RecordingRenderer::CreateTextureRegion(const std::string& id, TextureHandle page,
+                                                     uint32_t x, uint32_t y,
+                                                     uint32_t width, uint32_t height) {
+    TextureHandle result;
+    m_Thread.Invoke([&](IRenderer& renderer) {
+        result = renderer.CreateTextureRegion(id, page, x, y, width, height);
+    });
+    return result;
+}
+
+TextureHandle RecordingRenderer::FindTexture(const std::string& id) const {
+    TextureHandle result;
+    m_Thread.Invoke([&](IRenderer& renderer) { result = renderer.FindTexture(id); });
+    return result;
+}
+
+void RecordingRenderer::UnloadTexture(TextureHandle texture) {
+    m_Thread.Invoke([&](IRenderer& renderer) { renderer.UnloadTexture(texture); });
+}
+
+IRenderer::StaticBatchId RecordingRenderer::CreateStaticBatch() {
+    StaticBatchId result = INVALID_STATIC_BATCH;
+    m_Thread.Invoke([&](IRenderer& renderer) { result = renderer.CreateStaticBatch(); });
+    return result;
+}
+
+bool RecordingRenderer::UpdateStaticBatch(StaticBatchId batch, const StaticSprite* sprites, size_t count) {
+    // Se ejecuta después de presentar el frame en vuelo: no lo modifica
+    bool result = false;
+    m_Thread.Invoke([&](IRenderer& renderer) { result = renderer.UpdateStaticBatch(batch, sprites, count); });
+    return result;
+}
+
+void RecordingRenderer::DrawStaticBatch(StaticBatchId batch) {
+    m_Thread.GetWriteList().RecordStaticBatch(batch);
+}
+
+void RecordingRenderer::DestroyStaticBatch(StaticBatchId batch) {
+    m_Thread.Invoke([&](IRenderer& renderer) { renderer.DestroyStaticBatch(batch); });
+}
+
+std::string RecordingRenderer::GetName() const {
+    std::string result;
+    m_Thread.Invoke([&](IRenderer& renderer) { result = renderer.GetName(); });
+    return result + " (render thread)";
+}
+
+IRenderer::RenderStats RecordingRenderer::GetStats() const {
+    return m_Thread.GetLastStats();
+}
+
+// ----------------------------------------------------------------------------
+// RenderThread
+// ----------------------------------------------------------------------------
+
+RenderThread::RenderThread()
+    : m_Recorder(*this) {
+}
+
+RenderThread::~RenderThread() {
+    Stop();
+}
+
+bool RenderThread::Start(IRenderer& renderer, Hooks hooks) {
+    if (IsRunning()) {
+        spdlog::warn("RenderThread ya está en marcha");
+        return false;
+    }
+
+    m_Renderer = &renderer;
+    m_Hooks = std::move(hooks);
+    m_FramePending = false;
+    m_StopRequested = false;
+    for (RenderCommandList& list : m_Lists) {
+        list.Clear();
+    }
+
+    m_Thread = std::thread(&RenderThread::ThreadMain, this);
+    spdlog::info("RenderThread iniciado");
+    return true;
+}
+
+void RenderThread::Stop() {
+    if (!IsRunning()) {
+        return;
+    }
+
+    {
+        std::lock_guard<std::mutex> lock(m_Mutex);
+        m_StopRequested = true;
+    }
+    m_WakeRender.notify_one();
+    m_Thread.join();
+
+    m_Renderer = nullptr;
+    spdlog::info("RenderThread detenido");
+}
+
+void RenderThread::SubmitFrame() {
+    if (!IsRunning()) {
+        GetWriteList().Clear();
+        return;
+    }
+
+    {
+        std::unique_lock<std::mutex> lock(m_Mutex);
+
+        // Como mucho un frame en vuelo: esperar a que el anterior se presente
+        m_WakeMain.wait(lock, [this] { return !m_FramePending; });
+
+        m_SubmittedIndex = m_WriteIndex;
+        m_WriteIndex ^= 1u;
+        m_FramePending = true;
+    }
+    m_WakeRender.notify_one();
+
+    // El hilo de render ya no lee esta lista (terminó el frame anterior)
+    GetWriteList().Clear();
+}
+
+void RenderThread::Invoke(const std::function<void(IRenderer&)>& task) {
+    if (!IsRunning()) {
+        // Sin hilo, el contexto está en el llamador
+        if (m_Renderer != nullptr) {
+            task(*m_Renderer);
+        }
+        return;
+    }
+
+    std::unique_lock<std::mutex> lock(m_Mutex);
+    const uint64_t ticket = ++m_TasksQueued;
+    m_Tasks.emplace_back([this, &task] { task(*m_Renderer); });
+    m_WakeRender.notify_one();
+
+    m_WakeMain.wait(lock, [this, ticket] { return m_TasksCompleted >= ticket; });
+}
+
+IRenderer::RenderStats RenderThread::GetLastStats() const {
+    std::lock_guard<std::mutex> lock(m_Mutex);
+    return m_LastStats;
+}
+
+void RenderThread::ThreadMain() {
+    if (m_Hooks.makeCurrent) {
+        m_Hooks.makeCurrent();
+    }
+
+    std::unique_lock<std::mutex> lock(m_Mutex);
+    while (true) {
+        m_WakeRender.wait(lock, [this] {
+            return m_StopRequested || m_FramePending || !m_Tasks.empty();
+        });
+
+        if (m_FramePending) {
+            const uint32_t index = m_SubmittedIndex;
+            lock.unlock();
+
+            m_Lists[index].Replay(*m_Renderer);
+            m_Renderer->Present();
+            if (m_Hooks.swapBuffers) {
+                m_Hooks.swapBuffers();
+            }
+            const IRenderer::RenderStats stats = m_Renderer->GetStats();
+
+            lock.lock();
+            m_LastStats = stats;
+            m_FramePending = false;
+            m_WakeMain.notify_all();
+        }
+
+        // Tareas después: Invoke es síncrono, así que todo lo encolado se
+        // pidió después de enviar el frame pendiente y no debe verse en él
+        // (un UpdateStaticBatch o UnloadTexture del frame N+1 no puede
+        // cambiar lo que dibuja el frame N)
+        while (!m_Tasks.empty()) {
+            auto task = std::move(m_Tasks.front());
+            m_Tasks.pop_front();
+
+            lock.unlock();
+            task();
+            lock.lock();
+
+            m_TasksCompleted++;
+            m_WakeMain.notify_all();
+        }
+
+        if (m_StopRequested && m_Tasks.empty() && !m_FramePending) {
+            break;
+        }
+    }
+    lock.unlock();
+
+    if (m_Hooks.releaseCurrent) {
+        m_Hooks.releaseCurrent();
+    }
+}
+
+} // namespace MultiNinjaEspacial::Infrastructure::Rendering
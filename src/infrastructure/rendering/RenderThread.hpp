@@ -0,0 +1,205 @@
+// ============================================================================
+// Render Thread - Hilo de render dedicado
+// ============================================================================
+// El hilo principal graba los comandos de un frame y el hilo de render los
+// reproduce sobre el renderer real y presenta, un frame por detrás
+// ============================================================================
+
+#pragma once
+
+#include "IRenderer.hpp"
+#include "RenderCommandList.hpp"
+#include <array>
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <mutex>
+#include <thread>
+
+namespace MultiNinjaEspacial::Infrastructure::Rendering {
+
+class RenderThread;
+
+/**
+ * @brief IRenderer que graba en lugar de dibujar (lo usa el hilo principal)
+ *
+ * - Clear / SetViewport / SetResolutionScale / BeginOverlay / DrawSprite /
+ *   DrawStaticBatch se graban en la lista del frame.
+ * - Present entrega la lista al hilo de render (RenderThread::SubmitFrame).
+ * - Carga/descarga de texturas, creación/relleno de batches estáticos y
+ *   consultas se ejecutan en el hilo de render y bloquean hasta terminar
+ *   (son operaciones de tiempo de carga o poco frecuentes). Si hay un frame
+ *   en vuelo, esperan a que se presente: no cambian lo que ya se envió.
+ * - GetStats devuelve las del último frame presentado por el hilo de render.
+ */
+class RecordingRenderer : public IRenderer {
+public:
+    explicit RecordingRenderer(RenderThread& thread) : m_Thread(thread) {}
+
+    bool Initialize(int, int) override { return true; }
+    void Shutdown() override {}
+    void Clear(const glm::vec4& color) override;
+    void Present() override;
+    void SetViewport(int x, int y, int width, int height) override;
+    void SetView(const glm::mat4& viewProjection, const glm::ivec4& viewport) override;
+    void ResetView() override;
+    void SetResolutionScale(float scale) override;
+    void BeginOverlay() override;
+
+    void DrawSprite(
+        TextureHandle texture,
+        const glm::vec2& position,
+        const glm::vec2& size,
+        float rotation,
+        const glm::vec4& color
+    ) override;
+
+    TextureHandle LoadTexture(const std::string& id, const std::string& filepath) override;
+    TextureHandle LoadTextureAsync(const std::string& id, const std::string& filepath,
+                                   TextureLoadCallback onLoaded) override;
+    [[nodiscard]] bool IsTextureResident(TextureHandle texture) const override;
+    bool LoadTextureAtlas(const std::string& manifestPath) override;
+    TextureHandle CreateTexture(const std::string& id, uint32_t width, uint32_t height,
+                                const uint8_t* pixels) override;
+    TextureHandle CreateTextureRegion(const std::string& id, TextureHandle page,
+                                      uint32_t x, uint32_t y, uint32_t width, uint32_t height) override;
+    [[nodiscard]] TextureHandle FindTexture(const std::string& id) const override;
+    void UnloadTexture(TextureHandle texture) override;
+
+    StaticBatchId CreateStaticBatch() override;
+    bool UpdateStaticBatch(StaticBatchId batch, const StaticSprite* sprites, size_t count) override;
+    void DrawStaticBatch(StaticBatchId batch) override;
+    void DestroyStaticBatch(StaticBatchId batch) override;
+
+    [[nodiscard]] std::string GetName() const override;
+    [[nodiscard]] RenderStats GetStats() const override;
+    void ResetStats() override {}
+
+private:
+    RenderThread& m_Thread;
+};
+
+/**
+ * @brief Hilo que posee el contexto gráfico y reproduce los frames grabados
+ *
+ * Dos listas de comandos: mientras el hilo de render reproduce y presenta
+ * el frame N, el principal simula y graba el N+1. SubmitFrame solo espera
+ * si el hilo de render aún no ha terminado el frame anterior.
+ *
+ * El contexto (OpenGL) solo puede estar activo en un hilo: el llamador lo
+ * suelta antes de Start() y lo recupera después de Stop(). Los hooks
+ * permiten usar cualquier ventana/backend sin que este código conozca SDL.
+ *
+ * Ejemplo de uso:
+ * ```cpp
+ * RenderThread::Hooks hooks;
+ * hooks.makeCurrent = [&] { SDL_GL_MakeCurrent(window, context); };
+ * hooks.releaseCurrent = [&] { SDL_GL_MakeCurrent(window, nullptr); };
+ * hooks.swapBuffers = [&] { SDL_GL_SwapWindow(window); };
+ *
+ * SDL_GL_MakeCurrent(window, nullptr);
+ * renderThread.Start(openGLRenderer, hooks);
+ *
+ * IRenderer& renderer = renderThread.GetRecorder();
+ * renderer.Clear(color);
+ * renderSystem.Render(registry, renderer, bounds);
+ * renderer.Present();   // Entrega el frame
+ *
+ * renderThread.Stop();
+ * SDL_GL_MakeCurrent(window, context);
+ * ```
+ */
+class RenderThread {
+public:
+    /**
+     * @brief Operaciones dependientes de la ventana (todas opcionales)
+     */
+    struct Hooks {
+        std::function<void()> makeCurrent;      // Al arrancar, en el hilo de render
+        std::function<void()> releaseCurrent;   // Al terminar, en el hilo de render
+        std::function<void()> swapBuffers;      // Tras cada Present
+    };
+
+    RenderThread();
+    ~RenderThread();
+
+    RenderThread(const RenderThread&) = delete;
+    RenderThread& operator=(const RenderThread&) = delete;
+
+    /**
+     * @brief Arranca el hilo de render
+     * @param renderer Renderer real (ya inicializado); solo lo toca el hilo de render
+     * @param hooks Gestión de contexto y swap
+     * @return true si arrancó
+     */
+    bool Start(IRenderer& renderer, Hooks hooks);
+
+    /**
+     * @brief Termina el frame en curso, para el hilo y lo une
+     *
+     * El frame pendiente (si lo hay) se presenta antes de salir.
+     */
+    void Stop();
+
+    /**
+     * @brief Renderer para grabar desde el hilo principal
+     */
+    [[nodiscard]] IRenderer& GetRecorder() { return m_Recorder; }
+
+    /**
+     * @brief Entrega la lista grabada al hilo de render
+     *
+     * Bloquea solo si el frame anterior todavía se está reproduciendo.
+     */
+    void SubmitFrame();
+
+    /**
+     * @brief Ejecuta una tarea en el hilo de render y espera a que termine
+     * @param task Tarea (recibe el renderer real)
+     *
+     * Si hay un frame pendiente, la tarea se ejecuta después de presentarlo.
+     * No llamar desde el propio hilo de render.
+     */
+    void Invoke(const std::function<void(IRenderer&)>& task);
+
+    [[nodiscard]] bool IsRunning() const { return m_Thread.joinable(); }
+
+    /**
+     * @brief Estadísticas del último frame presentado
+     */
+    [[nodiscard]] IRenderer::RenderStats GetLastStats() const;
+
+private:
+    friend class RecordingRenderer;
+
+    /**
+     * @brief Lista en la que graba el hilo principal
+     */
+    [[nodiscard]] RenderCommandList& GetWriteList() { return m_Lists[m_WriteIndex]; }
+
+    void ThreadMain();
+
+    IRenderer* m_Renderer{nullptr};
+    Hooks m_Hooks;
+    RecordingRenderer m_Recorder;
+    std::thread m_Thread;
+
+    // Doble buffer de comandos
+    std::array<RenderCommandList, 2> m_Lists;
+    uint32_t m_WriteIndex{0};       // Solo lo toca el hilo principal
+    uint32_t m_SubmittedIndex{0};
+
+    // Sincronización
+    mutable std::mutex m_Mutex;
+    std::condition_variable m_WakeRender;     // Frame o tarea nuevos / stop
+    std::condition_variable m_WakeMain;       // Frame o tarea terminados
+    bool m_FramePending{false};               // Entregado y aún no presentado
+    bool m_StopRequested{false};
+    std::deque<std::function<void()>> m_Tasks;
+    uint64_t m_TasksCompleted{0};
+    uint64_t m_TasksQueued{0};
+
+    IRenderer::RenderStats m_LastStats;
+};
+
+} // namespace MultiNinjaEspacial::Infrastructure::Rendering
@@ -0,0 +1,224 @@
+// ============================================================================
+// Texture Atlas - Implementación
+// ============================================================================
+
+#include "TextureAtlas.hpp"
+#include <spdlog/spdlog.h>
+#include <algorithm>
+#include <fstream>
+#include <numeric>
+#include <sstream>
+
+namespace MultiNinjaEspacial::Infrastructure::Rendering {
+
+namespace {
+
+constexpr int MANIFEST_VERSION = 1;
+
+/**
+ * @brief Fila de una página: altura fija, se llena de izquierda a derecha
+ */
+struct Shelf {
+    uint32_t page;
+    uint32_t y;
+    uint32_t height;
+    uint32_t cursorX;
+};
+
+} // namespace
+
+// ============================================================================
+// AtlasManifest
+// ============================================================================
+
+uint32_t AtlasManifest::GetPageCount() const {
+    uint32_t count = 0;
+    for (const auto& region : regions) {
+        count = std::max(count, region.page + 1);
+    }
+    return count;
+}
+
+glm::vec4 AtlasManifest::GetUVRect(const AtlasRegion& region) const {
+    const float invW = 1.0f / static_cast<float>(pageWidth);
+    const float invH = 1.0f / static_cast<float>(pageHeight);
+    return {
+        static_cast<float>(region.x) * invW,
+        static_cast<float>(region.y) * invH,
+        static_cast<float>(region.x + region.width) * invW,
+        static_cast<float>(region.y + region.height) * invH
+    };
+}
+
+bool AtlasManifest::Save(const std::string& path) const {
+    std::ofstream file(path);
+    if (!file.is_open()) {
+        spdlog::error("No se pudo escribir el manifest de atlas: {}", path);
+        return false;
+    }
+
+    file << "atlas " << MANIFEST_VERSION << ' ' << pageWidth << ' ' << pageHeight << '\n';
+    for (const auto& image : pageImages) {
+        file << "page " << image << '\n';
+    }
+    for (const auto& region : regions) {
+        file << "region " << region.id << ' ' << region.page << ' '
+             << region.x << ' ' << region.y << ' '
+             << region.width << ' ' << region.height << '\n';
+    }
+
+    return file.good();
+}
+
+bool AtlasManifest::Load(const std::string& path, AtlasManifest& out) {
+    std::ifstream file(path);
+    if (!file.is_open()) {
+        spdlog::error("No se pudo abrir el manifest de atlas: {}", path);
+        return false;
+    }
+
+    out = AtlasManifest{};
+
+    std::string line;
+    bool hasHeader = false;
+    while (std::getline(file, line)) {
+        if (line.empty() || line[0] == '#') {
+            continue;
+        }
+
+        std::istringstream stream(line);
+        std::string tag;
+        stream >> tag;
+
+        if (tag == "atlas") {
+            int version = 0;
+            stream >> version >> out.pageWidth >> out.pageHeight;
+            if (version != MANIFEST_VERSION) {
+                spdlog::error("Versión de manifest no soportada ({}): {}", version, path);
+                return false;
+            }
+            hasHeader = true;
+        } else if (tag == "page") {
+            std::string image;
+            stream >> image;
+            out.pageImages.push_back(image);
+        } else if (tag == "region") {
+            AtlasRegion region;
+            stream >> region.id >> region.page >> region.x >> region.y
+                   >> region.width >> region.height;
+            out.regions.push_back(region);
+        }
+
+        if (stream.fail()) {
+            spdlog::error("Línea inválida en manifest de atlas {}: '{}'", path, line);
+            return false;
+        }
+    }
+
+    if (!hasHeader || out.pageWidth == 0 || out.pageHeight == 0) {
+        spdlog::error("Manifest de atlas sin cabecera válida: {}", path);
+        return false;
+    }
+
+    // Todas las regiones deben caer dentro de una página existente
+    for (const auto& region : out.regions) {
+        if (region.page >= out.pageImages.size() ||
+            region.x + region.width > out.pageWidth ||
+            region.y + region.height > out.pageHeight) {
+            spdlog::error("Región '{}' fuera de rango en manifest: {}", region.id, path);
+            return false;
+        }
+    }
+
+    return true;
+}
+
+// ============================================================================
+// AtlasPacker
+// ============================================================================
+
+AtlasPacker::AtlasPacker(uint32_t pageSize, uint32_t padding)
+    : m_PageSize(pageSize)
+    , m_Padding(padding) {
+}
+
+void AtlasPacker::Add(const std::string& id, uint32_t width, uint32_t height) {
+    AtlasRegion region;
+    region.id = id;
+    region.width = width;
+    region.height = height;
+    m_Pending.push_back(region);
+}
+
+/**
+ * @brief Empaqueta por estanterías
+ *
+ * Proceso:
+ * 1. Ordenar por altura descendente (las estanterías quedan "llenas")
+ * 2. Para cada textura, probar todas las estanterías abiertas (first-fit)
+ * 3. Si no cabe, abrir estantería nueva debajo de la última de la página
+ * 4. Si la página está llena, abrir página nueva
+ */
+bool AtlasPacker::Pack(AtlasManifest& out) const {
+    out = AtlasManifest{};
+    out.pageWidth = m_PageSize;
+    out.pageHeight = m_PageSize;
+    out.regions = m_Pending;
+
+    std::vector<size_t> order(out.regions.size());
+    std::iota(order.begin(), order.end(), size_t{0});
+    std::stable_sort(order.begin(), order.end(), [&](size_t a, size_t b) {
+        const auto& ra = out.regions[a];
+        const auto& rb = out.regions[b];
+        return ra.height != rb.height ? ra.height > rb.height : ra.width > rb.width;
+    });
+
+    std::vector<Shelf> shelves;
+    std::vector<uint32_t> pageBottoms;  // Primer Y libre de cada página
+
+    for (size_t i : order) {
+        AtlasRegion& region = out.regions[i];
+        const uint32_t w = region.width + m_Padding;
+        const uint32_t h = region.height + m_Padding;
+
+        if (w > m_PageSize || h > m_PageSize) {
+            spdlog::error("Textura '{}' ({}x{}) no cabe en una página de {}px",
+                          region.id, region.width, region.height, m_PageSize);
+            return false;
+        }
+
+        Shelf* target = nullptr;
+        for (auto& shelf : shelves) {
+            if (h <= shelf.height && shelf.cursorX + w <= m_PageSize) {
+                target = &shelf;
+                break;
+            }
+        }
+
+        if (target == nullptr) {
+            // Buscar página con hueco vertical para una estantería nueva
+            uint32_t page = 0;
+            while (page < pageBottoms.size() && pageBottoms[page] + h > m_PageSize) {
+                ++page;
+            }
+            if (page == pageBottoms.size()) {
+                pageBottoms.push_back(0);
+            }
+
+            shelves.push_back(Shelf{page, pageBottoms[page], h, 0});
+            pageBottoms[page] += h;
+            target = &shelves.back();
+        }
+
+        region.page = target->page;
+        region.x = target->cursorX;
+        region.y = target->y;
+        target->cursorX += w;
+    }
+
+    spdlog::debug("Atlas empaquetado: {} texturas en {} página(s) de {}px",
+                  out.regions.size(), pageBottoms.size(), m_PageSize);
+    return true;
+}
+
+} // namespace MultiNinjaEspacial::Infrastructure::Rendering
@@ -0,0 +1,126 @@
+// ============================================================================
+// Texture Atlas - Empaquetado de texturas en páginas compartidas
+// ============================================================================
+// Independiente de la API gráfica: solo calcula rectángulos y los serializa.
+// Lo usan OpenGLRenderer (en runtime) y la herramienta offline atlas_packer.
+// ============================================================================
+
+#pragma once
+
+#include <glm/glm.hpp>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace MultiNinjaEspacial::Infrastructure::Rendering {
+
+/**
+ * @brief Región de una textura dentro de una página del atlas
+ */
+struct AtlasRegion {
+    std::string id;       // ID de la textura (sin espacios)
+    uint32_t page{0};     // Índice de página
+    uint32_t x{0};        // Posición en la página (píxeles)
+    uint32_t y{0};
+    uint32_t width{0};    // Tamaño de la textura original
+    uint32_t height{0};
+};
+
+/**
+ * @brief Resultado del empaquetado: páginas + regiones
+ *
+ * Se puede guardar a disco (modo offline) para que el juego no tenga que
+ * empaquetar al arrancar. Formato de texto, una entrada por línea:
+ *
+ * ```
+ * atlas 1 <pageWidth> <pageHeight>
+ * page <imagen relativa al manifest>
+ * region <id> <page> <x> <y> <width> <height>
+ * ```
+ */
+struct AtlasManifest {
+    uint32_t pageWidth{0};
+    uint32_t pageHeight{0};
+    std::vector<std::string> pageImages;  // Vacío si las páginas son solo runtime
+    std::vector<AtlasRegion> regions;
+
+    /**
+     * @brief Número de páginas usadas por las regiones
+     */
+    [[nodiscard]] uint32_t GetPageCount() const;
+
+    /**
+     * @brief Calcula las coordenadas UV de una región
+     * @return {u0, v0, u1, v1}
+     */
+    [[nodiscard]] glm::vec4 GetUVRect(const AtlasRegion& region) const;
+
+    /**
+     * @brief Guarda el manifest en disco
+     * @param path Path del archivo
+     * @return true si exitoso
+     */
+    bool Save(const std::string& path) const;
+
+    /**
+     * @brief Carga un manifest desde disco
+     * @param path Path del archivo
+     * @param out Manifest destino
+     * @return true si exitoso (y el formato es válido)
+     */
+    static bool Load(const std::string& path, AtlasManifest& out);
+};
+
+/**
+ * @brief Empaquetador de rectángulos por estanterías (shelf packing)
+ *
+ * Ordena las texturas por altura descendente y las coloca en filas
+ * ("estanterías") de izquierda a derecha, con first-fit sobre todas las
+ * estanterías abiertas. Es simple, determinista y suficiente para sprites.
+ *
+ * Ejemplo de uso:
+ * ```cpp
+ * AtlasPacker packer(2048, 1);
+ * packer.Add("player", 64, 64);
+ * packer.Add("enemy", 32, 48);
+ *
+ * AtlasManifest manifest;
+ * if (packer.Pack(manifest)) {
+ *     manifest.Save("assets/atlas/sprites.atlas");
+ * }
+ * ```
+ */
+class AtlasPacker {
+public:
+    /**
+     * @brief Constructor
+     * @param pageSize Lado de cada página en píxeles (páginas cuadradas)
+     * @param padding Separación entre regiones (evita sangrado al filtrar)
+     */
+    explicit AtlasPacker(uint32_t pageSize = 2048, uint32_t padding = 1);
+
+    /**
+     * @brief Añade una textura a empaquetar
+     */
+    void Add(const std::string& id, uint32_t width, uint32_t height);
+
+    /**
+     * @brief Empaqueta todas las texturas añadidas
+     * @param out Manifest resultante (sin imágenes de página). Las regiones
+     *            quedan en el mismo orden en que se añadieron con Add()
+     * @return false si alguna textura no cabe en una página
+     */
+    bool Pack(AtlasManifest& out) const;
+
+    /**
+     * @brief Número de texturas añadidas
+     */
+    [[nodiscard]] size_t GetCount() const { return m_Pending.size(); }
+
+private:
+    uint32_t m_PageSize;
+    uint32_t m_Padding;
+    std::vector<AtlasRegion> m_Pending;
+};
+
+} // namespace MultiNinjaEspacial::Infrastructure::Rendering
@@ -0,0 +1,263 @@
+// ============================================================================
+// Frame Sink - Implementación
+// ============================================================================
+
+#include "FrameSink.hpp"
+#include <spdlog/spdlog.h>
+#include <algorithm>
+#include <cstring>
+#include <utility>
+
+#ifndef _WIN32
+#include <csignal>
+#include <pthread.h>
+#endif
+
+namespace MultiNinjaEspacial::Infrastructure::Rendering {
+
+namespace {
+
+void ReplaceAll(std::string& text, const std::string& from, const std::string& to) {
+    for (size_t pos = text.find(from); pos != std::string::npos; pos = text.find(from, pos + to.size())) {
+        text.replace(pos, from.size(), to);
+    }
+}
+
+} // namespace
+
+// ============================================================================
+// StreamFrameSink
+// ============================================================================
+
+StreamFrameSink::~StreamFrameSink() {
+    // Las subclases llaman a Close() en su destructor (WriteFrame es
+    // virtual); aquí solo se garantiza que el hilo no quede suelto
+    if (m_Writer.joinable()) {
+        {
+            std::lock_guard<std::mutex> lock(m_Mutex);
+            m_Stop = true;
+        }
+        m_Condition.notify_all();
+        m_Writer.join();
+    }
+}
+
+bool StreamFrameSink::Open(uint32_t width, uint32_t height) {
+    Close();
+
+    if (width == 0 || height == 0 || !OpenStream(width, height)) {
+        spdlog::error("Captura: no se pudo abrir {}", GetName());
+        return false;
+    }
+
+    m_Width = width;
+    m_Height = height;
+
+    // Toda la memoria se reserva aquí: SubmitFrame no asigna
+    m_Slots.assign(QUEUE_DEPTH, Slot{});
+    m_FreeSlots.clear();
+    for (uint32_t i = 0; i < QUEUE_DEPTH; ++i) {
+        m_Slots[i].pixels.resize(size_t{width} * height * 4);
+        m_FreeSlots.push_back(i);
+    }
+    m_Queued.clear();
+    m_Stop = false;
+    m_Failed = false;
+    m_LatencySum = 0.0;
+    m_Stats = Stats{};
+
+    m_Writer = std::thread(&StreamFrameSink::WriterMain, this);
+
+    spdlog::info("Captura: {} ({}x{})", GetName(), width, height);
+    return true;
+}
+
+bool StreamFrameSink::SubmitFrame(const CapturedFrame& frame) {
+    if (frame.width != m_Width || frame.height != m_Height) {
+        std::lock_guard<std::mutex> lock(m_Mutex);
+        m_Stats.dropped++;
+        return false;
+    }
+
+    uint32_t slotIndex;
+    {
+        std::lock_guard<std::mutex> lock(m_Mutex);
+        if (m_FreeSlots.empty() || m_Failed || !m_Writer.joinable()) {
+            m_Stats.dropped++;
+            return false;
+        }
+        slotIndex = m_FreeSlots.back();
+        m_FreeSlots.pop_back();
+    }
+
+    // Copia fuera del lock (el escritor no toca slots que no están en cola),
+    // volteando las filas para que el destino reciba la imagen de arriba abajo
+    Slot& slot = m_Slots[slotIndex];
+    const size_t rowBytes = size_t{m_Width} * 4;
+    for (uint32_t row = 0; row < m_Height; ++row) {
+        std::memcpy(slot.pixels.data() + row * rowBytes,
+                    frame.pixels + size_t{m_Height - 1 - row} * frame.stride, rowBytes);
+    }
+    slot.issuedAt = frame.issuedAt;
+
+    {
+        std::lock_guard<std::mutex> lock(m_Mutex);
+        m_Queued.push_back(slotIndex);
+    }
+    m_Condition.notify_one();
+    return true;
+}
+
+void StreamFrameSink::Close() {
+    if (!m_Writer.joinable()) {
+        return;
+    }
+
+    // El escritor vacía la cola antes de salir
+    {
+        std::lock_guard<std::mutex> lock(m_Mutex);
+        m_Stop = true;
+    }
+    m_Condition.notify_all();
+    m_Writer.join();
+
+    CloseStream();
+
+    const Stats stats = GetStats();
+    spdlog::info("Captura cerrada: {} frames, {} descartados, latencia media {:.2f}ms (máx {:.2f}ms)",
+                 stats.frames, stats.dropped, stats.averageLatency, stats.maxLatency);
+}
+
+IFrameSink::Stats StreamFrameSink::GetStats() const {
+    std::lock_guard<std::mutex> lock(m_Mutex);
+    return m_Stats;
+}
+
+void StreamFrameSink::WriterMain() {
+#ifndef _WIN32
+    // Si el lector de un pipe muere, write() manda SIGPIPE al hilo que
+    // escribe y su acción por defecto termina el juego. Bloqueada en este
+    // hilo, la escritura falla con EPIPE y se trata como cualquier error
+    sigset_t signals;
+    sigemptyset(&signals);
+    sigaddset(&signals, SIGPIPE);
+    pthread_sigmask(SIG_BLOCK, &signals, nullptr);
+#endif
+
+    for (;;) {
+        uint32_t slotIndex;
+        {
+            std::unique_lock<std::mutex> lock(m_Mutex);
+            m_Condition.wait(lock, [this] { return m_Stop || !m_Queued.empty(); });
+            if (m_Queued.empty()) {
+                return;     // Stop con la cola vacía
+            }
+            slotIndex = m_Queued.front();
+            m_Queued.pop_front();
+        }
+
+        Slot& slot = m_Slots[slotIndex];
+        const bool written = WriteFrame(slot.pixels.data(), slot.pixels.size());
+        const float latency = std::chrono::duration<float, std::milli>(
+            std::chrono::steady_clock::now() - slot.issuedAt).count();
+
+        std::lock_guard<std::mutex> lock(m_Mutex);
+        m_FreeSlots.push_back(slotIndex);
+        if (!written) {
+            if (!m_Failed) {
+                spdlog::error("Captura: fallo al escribir en {}; se descartan los frames", GetName());
+            }
+            m_Failed = true;
+            m_Stats.dropped++;
+            continue;
+        }
+
+        m_Stats.frames++;
+        m_Stats.lastLatency = latency;
+        m_Stats.maxLatency = std::max(m_Stats.maxLatency, latency);
+        m_LatencySum += latency;
+        m_Stats.averageLatency = static_cast<float>(m_LatencySum / static_cast<double>(m_Stats.frames));
+    }
+}
+
+// ============================================================================
+// RawFileFrameSink
+// ============================================================================
+
+RawFileFrameSink::RawFileFrameSink(std::string path)
+    : m_Path(std::move(path)) {
+}
+
+RawFileFrameSink::~RawFileFrameSink() {
+    Close();
+}
+
+bool RawFileFrameSink::OpenStream(uint32_t, uint32_t) {
+    m_File = std::fopen(m_Path.c_str(), "wb");
+    return m_File != nullptr;
+}
+
+bool RawFileFrameSink::WriteFrame(const uint8_t* pixels, size_t bytes) {
+    return std::fwrite(pixels, 1, bytes, m_File) == bytes;
+}
+
+void RawFileFrameSink::CloseStream() {
+    if (m_File != nullptr) {
+        std::fclose(m_File);
+        m_File = nullptr;
+    }
+}
+
+// ============================================================================
+// PipeFrameSink
+// ============================================================================
+
+PipeFrameSink::PipeFrameSink(std::string command)
+    : m_Command(std::move(command)) {
+}
+
+PipeFrameSink::~PipeFrameSink() {
+    Close();
+}
+
+bool PipeFrameSink::OpenStream(uint32_t width, uint32_t height) {
+    std::string command = m_Command;
+    ReplaceAll(command, "{width}", std::to_string(width));
+    ReplaceAll(command, "{height}", std::to_string(height));
+
+#ifdef _WIN32
+    m_Pipe = _popen(command.c_str(), "wb");
+#else
+    m_Pipe = popen(command.c_str(), "w");
+#endif
+    if (m_Pipe == nullptr) {
+        return false;
+    }
+
+    // Sin buffer de stdio: cada frame va entero a write() desde el hilo
+    // escritor y pclose (en el hilo que cierra) no tiene nada pendiente
+    // que volcar a un pipe roto
+    std::setvbuf(m_Pipe, nullptr, _IONBF, 0);
+    return true;
+}
+
+bool PipeFrameSink::WriteFrame(const uint8_t* pixels, size_t bytes) {
+    return std::fwrite(pixels, 1, bytes, m_Pipe) == bytes;
+}
+
+void PipeFrameSink::CloseStream() {
+    if (m_Pipe != nullptr) {
+        // Espera a que el encoder termine de procesar lo recibido
+#ifdef _WIN32
+        const int status = _pclose(m_Pipe);
+#else
+        const int status = pclose(m_Pipe);
+#endif
+        m_Pipe = nullptr;
+        if (status != 0) {
+            spdlog::warn("Captura: el proceso '{}' terminó con estado {}", m_Command, status);
+        }
+    }
+}
+
+} // namespace MultiNinjaEspacial::Infrastructure::Rendering
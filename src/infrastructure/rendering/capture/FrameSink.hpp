@@ -0,0 +1,213 @@
+// ============================================================================
+// Frame Sink - Destino de los frames capturados
+// ============================================================================
+// Independiente de la API gráfica: recibe los píxeles que lee FrameCapture
+// (OpenGL) y los escribe a un archivo o a la entrada de un encoder
+// ============================================================================
+
+#pragma once
+
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <cstdio>
+#include <deque>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace MultiNinjaEspacial::Infrastructure::Rendering {
+
+/**
+ * @brief Frame leído del framebuffer
+ *
+ * Los píxeles son RGBA8 con las filas de abajo arriba (orden de OpenGL) y
+ * solo son válidos durante la llamada a IFrameSink::SubmitFrame (apuntan a
+ * la memoria mapeada del PBO).
+ */
+struct CapturedFrame {
+    const uint8_t* pixels{nullptr};
+    uint32_t width{0};
+    uint32_t height{0};
+    uint32_t stride{0};     // Bytes por fila
+    uint64_t index{0};      // Número de frame desde StartCapture
+    std::chrono::steady_clock::time_point issuedAt;  // Cuándo se pidió la lectura
+};
+
+/**
+ * @brief Interfaz de un destino de captura
+ *
+ * SubmitFrame se llama en el hilo del contexto OpenGL, justo después de
+ * mapear el PBO: no debe bloquear. Si el destino no da abasto, descarta
+ * el frame y lo cuenta.
+ */
+class IFrameSink {
+public:
+    /**
+     * @brief Métricas de la captura
+     */
+    struct Stats {
+        uint64_t frames{0};             // Frames escritos
+        uint64_t dropped{0};            // Descartados (destino lento)
+        float lastLatency{0.0f};        // ms desde la lectura hasta escrito (último frame)
+        float averageLatency{0.0f};     // ms, media desde Open
+        float maxLatency{0.0f};         // ms, peor frame desde Open
+    };
+
+    virtual ~IFrameSink() = default;
+
+    /**
+     * @brief Prepara el destino para frames de un tamaño
+     * @return true si exitoso
+     */
+    virtual bool Open(uint32_t width, uint32_t height) = 0;
+
+    /**
+     * @brief Entrega un frame (sin bloquear)
+     * @return false si se descartó
+     */
+    virtual bool SubmitFrame(const CapturedFrame& frame) = 0;
+
+    /**
+     * @brief Termina de escribir lo pendiente y cierra el destino
+     */
+    virtual void Close() = 0;
+
+    /**
+     * @brief Métricas (seguro desde cualquier hilo)
+     */
+    [[nodiscard]] virtual Stats GetStats() const = 0;
+
+    /**
+     * @brief Descripción para logs
+     */
+    [[nodiscard]] virtual std::string GetName() const = 0;
+};
+
+/**
+ * @brief Destino con un hilo escritor y una cola acotada
+ *
+ * SubmitFrame copia el frame (volteando las filas: el resultado queda de
+ * arriba abajo) a uno de QUEUE_DEPTH buffers reservados en Open y lo
+ * encola; el hilo escritor llama a WriteFrame. Si no queda buffer libre el
+ * frame se descarta: la E/S lenta nunca frena al hilo de render.
+ *
+ * Las subclases solo implementan OpenStream / WriteFrame / CloseStream.
+ */
+class StreamFrameSink : public IFrameSink {
+public:
+    // Frames en vuelo entre el hilo de render y el escritor
+    static constexpr uint32_t QUEUE_DEPTH = 4;
+
+    ~StreamFrameSink() override;
+
+    bool Open(uint32_t width, uint32_t height) final;
+    bool SubmitFrame(const CapturedFrame& frame) final;
+    void Close() final;
+    [[nodiscard]] Stats GetStats() const final;
+
+protected:
+    StreamFrameSink() = default;
+
+    /**
+     * @brief Abre el archivo/proceso destino (hilo de Open)
+     */
+    virtual bool OpenStream(uint32_t width, uint32_t height) = 0;
+
+    /**
+     * @brief Escribe un frame RGBA8 de arriba abajo (hilo escritor)
+     * @return false si el destino falló (se deja de escribir)
+     */
+    virtual bool WriteFrame(const uint8_t* pixels, size_t bytes) = 0;
+
+    /**
+     * @brief Cierra el destino (hilo de Close, tras vaciar la cola)
+     */
+    virtual void CloseStream() = 0;
+
+private:
+    struct Slot {
+        std::vector<uint8_t> pixels;
+        std::chrono::steady_clock::time_point issuedAt;
+    };
+
+    /**
+     * @brief Bucle del hilo escritor
+     */
+    void WriterMain();
+
+    uint32_t m_Width{0};
+    uint32_t m_Height{0};
+
+    // Compartido con el escritor (protegido por m_Mutex)
+    mutable std::mutex m_Mutex;
+    std::condition_variable m_Condition;
+    std::vector<Slot> m_Slots;
+    std::vector<uint32_t> m_FreeSlots;
+    std::deque<uint32_t> m_Queued;
+    bool m_Stop{false};
+    bool m_Failed{false};
+    double m_LatencySum{0.0};
+    Stats m_Stats;
+
+    std::thread m_Writer;
+};
+
+/**
+ * @brief Escribe los frames seguidos en un archivo (RGBA8 sin cabecera)
+ *
+ * Ejemplo de uso:
+ * ```cpp
+ * renderer.StartCapture(std::make_unique<RawFileFrameSink>("capture.rgba"));
+ * // ffmpeg -f rawvideo -pix_fmt rgba -s 800x600 -i capture.rgba out.mp4
+ * ```
+ */
+class RawFileFrameSink final : public StreamFrameSink {
+public:
+    explicit RawFileFrameSink(std::string path);
+    ~RawFileFrameSink() override;
+
+    [[nodiscard]] std::string GetName() const override { return "archivo " + m_Path; }
+
+protected:
+    bool OpenStream(uint32_t width, uint32_t height) override;
+    bool WriteFrame(const uint8_t* pixels, size_t bytes) override;
+    void CloseStream() override;
+
+private:
+    std::string m_Path;
+    std::FILE* m_File{nullptr};
+};
+
+/**
+ * @brief Envía los frames por la entrada estándar de un proceso (encoder)
+ *
+ * El comando admite {width} y {height}, que se sustituyen al abrir. Si el
+ * proceso termina antes de tiempo, las escrituras fallan (sin SIGPIPE) y
+ * el resto de frames se descarta.
+ *
+ * Ejemplo de uso:
+ * ```cpp
+ * renderer.StartCapture(std::make_unique<PipeFrameSink>(
+ *     "ffmpeg -y -f rawvideo -pix_fmt rgba -s {width}x{height} -r 60 -i - out.mp4"));
+ * ```
+ */
+class PipeFrameSink final : public StreamFrameSink {
+public:
+    explicit PipeFrameSink(std::string command);
+    ~PipeFrameSink() override;
+
+    [[nodiscard]] std::string GetName() const override { return "pipe '" + m_Command + "'"; }
+
+protected:
+    bool OpenStream(uint32_t width, uint32_t height) override;
+    bool WriteFrame(const uint8_t* pixels, size_t bytes) override;
+    void CloseStream() override;
+
+private:
+    std::string m_Command;
+    std::FILE* m_Pipe{nullptr};
+};
+
+} // namespace MultiNinjaEspacial::Infrastructure::Rendering
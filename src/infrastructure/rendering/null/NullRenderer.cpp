@@ -0,0 +1,454 @@
+// ============================================================================
+// Null Renderer - Implementación
+// ============================================================================
+
+#include "NullRenderer.hpp"
+#include "../TextureAtlas.hpp"
+#include <spdlog/spdlog.h>
+#include <algorithm>
+
+namespace MultiNinjaEspacial::Infrastructure::Rendering {
+
+bool NullRenderer::Initialize(int width, int height) {
+    spdlog::info("Inicializando NullRenderer ({}x{})", width, height);
+
+    m_Width = width;
+    m_Height = height;
+    m_BatchTextures.reserve(MAX_TEXTURE_SLOTS);
+    m_PassTextures.reserve(MULTI_DRAW_TEXTURE_UNITS);
+    m_Counters = Counters{};
+    m_LastFrameStats = RenderStats{};
+    ResetStats();
+    return true;
+}
+
+void NullRenderer::Shutdown() {
+    m_TextureTable.clear();
+    m_FreeTextureSlots.clear();
+    m_TextureIds.clear();
+    m_TextureMemory = 0;
+    m_SceneTargetBytes = 0;
+    m_StaticBatches.clear();
+    m_FreeStaticBatches.clear();
+    m_PendingCallbacks.clear();
+    m_Commands.Clear();
+    m_LastFrameCommands.Clear();
+}
+
+void NullRenderer::Clear(const glm::vec4& color) {
+    m_FrameSubmitStart = std::chrono::steady_clock::now();
+    m_FrameSubmitStarted = true;
+
+    // Como OpenGLRenderer: la escala se fija al abrir el frame
+    m_ResolutionScale = m_PendingResolutionScale;
+    m_ScenePassActive = m_ResolutionScale < 1.0f;
+    // A nativa no se dibuja en el framebuffer reducido: no cuenta
+    m_SceneTargetBytes = m_ScenePassActive
+        ? static_cast<uint64_t>(m_Width) * static_cast<uint64_t>(m_Height) * 4
+        : 0;
+
+    if (m_RecordCommands) {
+        m_Commands.RecordClear(color);
+    }
+}
+
+void NullRenderer::Present() {
+    RestoreScreenView();
+    ResolveScenePass();
+    FlushBatch();
+
+    // Confirmar las cargas del frame (en el hilo de render, como OpenGL)
+    auto callbacks = std::move(m_PendingCallbacks);
+    m_PendingCallbacks.clear();
+    for (auto& [texture, callback] : callbacks) {
+        callback(texture, true);
+    }
+
+    if (m_FrameSubmitStarted) {
+        m_Stats.cpuSubmitTime = std::chrono::duration<float, std::milli>(
+            std::chrono::steady_clock::now() - m_FrameSubmitStart).count();
+        m_FrameSubmitStarted = false;
+    }
+
+    // Comandos y estadísticas del frame quedan consultables hasta el siguiente
+    std::swap(m_Commands, m_LastFrameCommands);
+    m_Commands.Clear();
+
+    m_Stats.textureMemory = m_TextureMemory + m_SceneTargetBytes;
+    m_Stats.resolutionScale = m_ResolutionScale;
+    m_Counters.frames++;
+    m_LastFrameStats = m_Stats;
+    ResetStats();
+}
+
+void NullRenderer::SetViewport(int x, int y, int width, int height) {
+    // Igual que OpenGL: lo acumulado se dibuja con la proyección anterior
+    FlushBatch();
+
+    m_Width = width;
+    m_Height = height;
+    m_Counters.stateChanges++;
+
+    if (m_RecordCommands) {
+        m_Commands.RecordViewport(x, y, width, height);
+    }
+}
+
+void NullRenderer::SetView(const glm::mat4& viewProjection, const glm::ivec4& viewport) {
+    // Cambio de viewport y de UBO del frame: corta el batch, como en OpenGL
+    FlushBatch();
+    m_Counters.stateChanges++;
+    m_ViewActive = true;
+
+    if (m_RecordCommands) {
+        m_Commands.RecordView(viewProjection, viewport);
+    }
+}
+
+void NullRenderer::ResetView() {
+    if (m_RecordCommands) {
+        m_Commands.RecordResetView();
+    }
+    RestoreScreenView();
+}
+
+void NullRenderer::RestoreScreenView() {
+    if (!m_ViewActive) {
+        return;
+    }
+    FlushBatch();
+    m_Counters.stateChanges++;
+    m_ViewActive = false;
+}
+
+void NullRenderer::SetResolutionScale(float scale) {
+    if (m_RecordCommands) {
+        m_Commands.RecordResolutionScale(scale);
+    }
+    m_PendingResolutionScale = std::clamp(scale, MIN_RESOLUTION_SCALE, 1.0f);
+}
+
+void NullRenderer::BeginOverlay() {
+    if (m_RecordCommands) {
+        m_Commands.RecordBeginOverlay();
+    }
+    RestoreScreenView();
+    ResolveScenePass();
+}
+
+void NullRenderer::DrawSprite(
+    TextureHandle texture,
+    const glm::vec2& position,
+    const glm::vec2& size,
+    float rotation,
+    const glm::vec4& color
+) {
+    if (m_RecordCommands) {
+        m_Commands.RecordSprite(texture, position, size, rotation, color);
+    }
+
+    // Misma asignación de slots que SpriteBatch::AcquireTextureSlot
+    const uint32_t bindKey = ResolveBindKey(texture);
+    const bool inBatch = std::find(m_BatchTextures.begin(), m_BatchTextures.end(), bindKey) !=
+                         m_BatchTextures.end();
+    if (!inBatch) {
+        if (m_BatchTextures.size() == MAX_TEXTURE_SLOTS) {
+            // Batch lleno: se cierra y se abre otro
+            CloseBatch();
+        }
+        m_BatchTextures.push_back(bindKey);
+    }
+
+    m_PendingSprites++;
+}
+
+NullRenderer::StaticBatchId NullRenderer::CreateStaticBatch() {
+    StaticBatchId id;
+    if (!m_FreeStaticBatches.empty()) {
+        id = m_FreeStaticBatches.back();
+        m_FreeStaticBatches.pop_back();
+    } else {
+        id = static_cast<StaticBatchId>(m_StaticBatches.size());
+        m_StaticBatches.emplace_back();
+    }
+
+    m_StaticBatches[id] = StaticBatch{};
+    m_StaticBatches[id].used = true;
+    return id;
+}
+
+bool NullRenderer::UpdateStaticBatch(StaticBatchId batch, const StaticSprite* sprites, size_t count) {
+    if (batch >= m_StaticBatches.size() || !m_StaticBatches[batch].used) {
+        spdlog::error("UpdateStaticBatch: batch {} inválido", batch);
+        return false;
+    }
+
+    // Mismo agrupado que OpenGLRenderer: por textura enlazada, de 8 en 8
+    m_StaticBindKeys.clear();
+    for (size_t i = 0; i < count; ++i) {
+        m_StaticBindKeys.push_back(ResolveBindKey(sprites[i].texture));
+    }
+    std::sort(m_StaticBindKeys.begin(), m_StaticBindKeys.end());
+    m_StaticBindKeys.erase(std::unique(m_StaticBindKeys.begin(), m_StaticBindKeys.end()), m_StaticBindKeys.end());
+    const auto textures = static_cast<uint32_t>(m_StaticBindKeys.size());
+
+    StaticBatch& staticBatch = m_StaticBatches[batch];
+    staticBatch.sprites = static_cast<uint32_t>(count);
+    staticBatch.bindKeys.assign(m_StaticBindKeys.begin(), m_StaticBindKeys.end());
+    staticBatch.ranges = (textures + MAX_TEXTURE_SLOTS - 1) / MAX_TEXTURE_SLOTS;
+
+    m_Stats.uploadBytes += count * SPRITE_INSTANCE_BYTES;
+    m_Counters.bytesUploaded += count * SPRITE_INSTANCE_BYTES;
+    return true;
+}
+
+void NullRenderer::DrawStaticBatch(StaticBatchId batch) {
+    if (batch >= m_StaticBatches.size() || !m_StaticBatches[batch].used) {
+        return;
+    }
+
+    // Lo pendiente se dibuja antes (orden de envío)
+    FlushBatch();
+
+    if (m_RecordCommands) {
+        m_Commands.RecordStaticBatch(batch);
+    }
+
+    const StaticBatch& staticBatch = m_StaticBatches[batch];
+    m_Stats.drawCalls += staticBatch.ranges;
+    m_Stats.batches += staticBatch.ranges;
+    m_Stats.sprites += staticBatch.sprites;
+    m_Stats.staticSprites += staticBatch.sprites;
+    m_Stats.triangles += staticBatch.sprites * 2;
+    m_Stats.vertices += staticBatch.sprites * 6;
+
+    m_Counters.drawCalls += staticBatch.ranges;
+    m_Counters.sprites += staticBatch.sprites;
+    m_Counters.vertices += uint64_t{staticBatch.sprites} * 6;
+    m_Counters.stateChanges += staticBatch.bindKeys.size();
+}
+
+void NullRenderer::DestroyStaticBatch(StaticBatchId batch) {
+    if (batch >= m_StaticBatches.size() || !m_StaticBatches[batch].used) {
+        return;
+    }
+
+    m_StaticBatches[batch].used = false;
+    m_FreeStaticBatches.push_back(batch);
+}
+
+TextureHandle NullRenderer::LoadTexture(const std::string& id, const std::string& filepath) {
+    auto it = m_TextureIds.find(id);
+    if (it != m_TextureIds.end()) {
+        return it->second;
+    }
+
+    spdlog::debug("NullRenderer: textura '{}' registrada sin leer {}", id, filepath);
+    return AddTextureEntry(id);
+}
+
+TextureHandle NullRenderer::LoadTextureAsync(const std::string& id, const std::string& filepath,
+                                             TextureLoadCallback onLoaded) {
+    TextureHandle handle = LoadTexture(id, filepath);
+    if (onLoaded) {
+        m_PendingCallbacks.emplace_back(handle, std::move(onLoaded));
+    }
+    return handle;
+}
+
+bool NullRenderer::IsTextureResident(TextureHandle texture) const {
+    return texture.IsValid() && texture.index < m_TextureTable.size() &&
+           !m_TextureTable[texture.index].IsFree();
+}
+
+bool NullRenderer::LoadTextureAtlas(const std::string& manifestPath) {
+    AtlasManifest manifest;
+    if (!AtlasManifest::Load(manifestPath, manifest)) {
+        return false;
+    }
+
+    // Una entrada por página y una por región apuntando a su página
+    std::vector<uint32_t> pages;
+    pages.reserve(manifest.GetPageCount());
+    for (uint32_t page = 0; page < manifest.GetPageCount(); ++page) {
+        pages.push_back(AddTextureEntry(manifestPath + "#" + std::to_string(page)).index);
+    }
+
+    for (const AtlasRegion& region : manifest.regions) {
+        if (m_TextureIds.count(region.id) > 0) {
+            spdlog::warn("NullRenderer: textura '{}' ya cargada, se ignora la del atlas", region.id);
+            continue;
+        }
+        TextureHandle handle = AddTextureEntry(region.id);
+        m_TextureTable[handle.index].page = pages[region.page];
+    }
+
+    return true;
+}
+
+TextureHandle NullRenderer::CreateTexture(const std::string& id, uint32_t width, uint32_t height,
+                                          const uint8_t* pixels) {
+    if (m_TextureIds.count(id) > 0 || width == 0 || height == 0 || pixels == nullptr) {
+        spdlog::error("NullRenderer: no se puede crear la textura '{}'", id);
+        return {};
+    }
+
+    const uint64_t bytes = uint64_t{width} * height * 4;
+    TextureHandle handle = AddTextureEntry(id);
+    m_TextureTable[handle.index].bytes = bytes;
+
+    m_TextureMemory += bytes;
+    m_Stats.uploadBytes += bytes;
+    m_Counters.bytesUploaded += bytes;
+    return handle;
+}
+
+TextureHandle NullRenderer::CreateTextureRegion(const std::string& id, TextureHandle page,
+                                                uint32_t, uint32_t, uint32_t, uint32_t) {
+    if (m_TextureIds.count(id) > 0 || !IsTextureResident(page)) {
+        spdlog::error("NullRenderer: no se puede crear la región '{}'", id);
+        return {};
+    }
+
+    TextureHandle handle = AddTextureEntry(id);
+    m_TextureTable[handle.index].page = ResolveBindKey(page);
+    return handle;
+}
+
+TextureHandle NullRenderer::FindTexture(const std::string& id) const {
+    auto it = m_TextureIds.find(id);
+    return it != m_TextureIds.end() ? it->second : TextureHandle{};
+}
+
+void NullRenderer::UnloadTexture(TextureHandle texture) {
+    if (!IsTextureResident(texture)) {
+        return;
+    }
+
+    // Como OpenGLRenderer: los batches estáticos que la enlazan se vacían
+    for (StaticBatchId id = 0; id < m_StaticBatches.size(); ++id) {
+        StaticBatch& staticBatch = m_StaticBatches[id];
+        if (staticBatch.used &&
+            std::binary_search(staticBatch.bindKeys.begin(), staticBatch.bindKeys.end(), texture.index)) {
+            spdlog::warn("Batch estático {} vaciado: usaba la textura descargada (handle {})", id, texture.index);
+            staticBatch = StaticBatch{};
+            staticBatch.used = true;
+        }
+    }
+
+    TextureEntry& entry = m_TextureTable[texture.index];
+    m_TextureMemory -= entry.bytes;
+    m_TextureIds.erase(entry.id);
+    entry = TextureEntry{};
+    m_FreeTextureSlots.push_back(texture.index);
+}
+
+TextureHandle NullRenderer::AddTextureEntry(const std::string& id) {
+    uint32_t index;
+    if (!m_FreeTextureSlots.empty()) {
+        index = m_FreeTextureSlots.back();
+        m_FreeTextureSlots.pop_back();
+    } else {
+        index = static_cast<uint32_t>(m_TextureTable.size());
+        m_TextureTable.emplace_back();
+    }
+
+    m_TextureTable[index].id = id;
+    TextureHandle handle(index);
+    m_TextureIds[id] = handle;
+    return handle;
+}
+
+uint32_t NullRenderer::ResolveBindKey(TextureHandle texture) const {
+    if (!IsTextureResident(texture)) {
+        return TextureHandle::INVALID_INDEX;
+    }
+
+    const TextureEntry& entry = m_TextureTable[texture.index];
+    return entry.page != TextureHandle::INVALID_INDEX ? entry.page : texture.index;
+}
+
+void NullRenderer::SetMultiDrawEnabled(bool enabled) {
+    if (m_MultiDrawEnabled == enabled) {
+        return;
+    }
+    FlushBatch();
+    m_MultiDrawEnabled = enabled;
+}
+
+void NullRenderer::CloseBatch() {
+    if (!m_MultiDrawEnabled) {
+        m_Counters.stateChanges += m_BatchTextures.size();
+    } else {
+        // Mismo reparto que SpriteBatch::DrawBatchesIndirect: si las
+        // texturas nuevas no caben, la pasada se envía antes del batch
+        size_t missing = 0;
+        for (uint32_t bindKey : m_BatchTextures) {
+            if (std::find(m_PassTextures.begin(), m_PassTextures.end(), bindKey) == m_PassTextures.end()) {
+                missing++;
+            }
+        }
+        if (m_PassTextures.size() + missing > MULTI_DRAW_TEXTURE_UNITS) {
+            m_Counters.stateChanges += m_PassTextures.size();
+            m_PassTextures.clear();
+            m_PassCount++;
+        }
+        for (uint32_t bindKey : m_BatchTextures) {
+            if (std::find(m_PassTextures.begin(), m_PassTextures.end(), bindKey) == m_PassTextures.end()) {
+                m_PassTextures.push_back(bindKey);
+            }
+        }
+    }
+    m_BatchTextures.clear();
+    m_BatchCount++;
+}
+
+void NullRenderer::FlushBatch() {
+    if (m_PendingSprites == 0) {
+        return;
+    }
+
+    // Cerrar el último batch abierto (y en multi-draw, la última pasada)
+    CloseBatch();
+    uint32_t drawCalls = m_BatchCount;
+    if (m_MultiDrawEnabled) {
+        m_Counters.stateChanges += m_PassTextures.size();
+        m_PassTextures.clear();
+        drawCalls = m_PassCount + 1;
+        m_PassCount = 0;
+    }
+
+    m_Stats.drawCalls += drawCalls;
+    m_Stats.batches += m_BatchCount;
+    m_Stats.sprites += m_PendingSprites;
+    m_Stats.triangles += m_PendingSprites * 2;
+    m_Stats.vertices += m_PendingSprites * 6;
+
+    m_Counters.drawCalls += drawCalls;
+    m_Counters.sprites += m_PendingSprites;
+    m_Counters.vertices += uint64_t{m_PendingSprites} * 6;
+    m_Stats.uploadBytes += uint64_t{m_PendingSprites} * SPRITE_INSTANCE_BYTES;
+    m_Counters.bytesUploaded += uint64_t{m_PendingSprites} * SPRITE_INSTANCE_BYTES;
+
+    m_BatchCount = 0;
+    m_PendingSprites = 0;
+}
+
+void NullRenderer::ResolveScenePass() {
+    if (!m_ScenePassActive) {
+        return;
+    }
+
+    // Lo acumulado va al framebuffer reducido; después, un quad a pantalla
+    FlushBatch();
+    m_ScenePassActive = false;
+
+    m_Stats.drawCalls++;
+    m_Stats.triangles += 2;
+    m_Stats.vertices += 6;
+    m_Counters.drawCalls++;
+    m_Counters.vertices += 6;
+    m_Counters.stateChanges++;  // Cambio de framebuffer
+}
+
+} // namespace MultiNinjaEspacial::Infrastructure::Rendering
@@ -0,0 +1,239 @@
+// ============================================================================
+// Null Renderer - Backend sin GPU para benchmarks y tests
+// ============================================================================
+// Implementa IRenderer sin tocar OpenGL: graba los comandos del frame y
+// cuenta draws, cambios de estado y bytes subidos como lo haría el batch
+// de OpenGLRenderer
+// ============================================================================
+
+#pragma once
+
+#include "../IRenderer.hpp"
+#include "../RenderCommandList.hpp"
+#include <chrono>
+#include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+namespace MultiNinjaEspacial::Infrastructure::Rendering {
+
+/**
+ * @brief Renderer headless (sin ventana ni contexto OpenGL)
+ *
+ * Reproduce las reglas de batching de SpriteBatch (MAX_TEXTURE_SLOTS
+ * texturas por batch, flush en Present y SetViewport, regiones de atlas
+ * que comparten página) y el draw extra del escalado de resolución para
+ * que las métricas sean comparables con las del backend OpenGL. Las texturas nunca se leen de disco: cualquier
+ * LoadTexture tiene éxito y queda residente al instante. Los batches
+ * estáticos cuentan un draw call por cada MAX_TEXTURE_SLOTS texturas.
+ * Con SetMultiDrawEnabled(true) cuenta como el path multi-draw de OpenGL:
+ * un draw call por pasada de hasta MULTI_DRAW_TEXTURE_UNITS texturas.
+ *
+ * Ejemplo de uso:
+ * ```cpp
+ * NullRenderer renderer;
+ * renderer.Initialize(800, 600);
+ *
+ * renderSystem.Render(registry, renderer, bounds);
+ * renderer.Present();
+ *
+ * auto stats = renderer.GetStats();                      // Último frame
+ * const auto& commands = renderer.GetLastFrameCommands(); // Orden de dibujo
+ * ```
+ */
+class NullRenderer : public IRenderer {
+public:
+    // Mismas constantes que el batch de OpenGL (ver SpriteBatch)
+    static constexpr uint32_t MAX_TEXTURE_SLOTS = 8;
+    static constexpr uint32_t MULTI_DRAW_TEXTURE_UNITS = 16;
+    static constexpr size_t SPRITE_INSTANCE_BYTES = 56;   // sizeof(SpriteInstance)
+
+    /**
+     * @brief Contadores acumulados desde Initialize / ResetCounters
+     */
+    struct Counters {
+        uint64_t frames{0};
+        uint64_t drawCalls{0};
+        uint64_t sprites{0};
+        uint64_t vertices{0};
+        uint64_t stateChanges{0};   // Binds de textura + cambios de viewport
+        uint64_t bytesUploaded{0};  // Instancias + texturas creadas en memoria
+    };
+
+    NullRenderer() = default;
+    ~NullRenderer() override = default;
+
+    // Implementación de IRenderer
+    bool Initialize(int width, int height) override;
+    void Shutdown() override;
+    void Clear(const glm::vec4& color) override;
+    void Present() override;
+    void SetViewport(int x, int y, int width, int height) override;
+    void SetView(const glm::mat4& viewProjection, const glm::ivec4& viewport) override;
+    void ResetView() override;
+    void SetResolutionScale(float scale) override;
+    void BeginOverlay() override;
+
+    void DrawSprite(
+        TextureHandle texture,
+        const glm::vec2& position,
+        const glm::vec2& size,
+        float rotation,
+        const glm::vec4& color
+    ) override;
+
+    StaticBatchId CreateStaticBatch() override;
+    bool UpdateStaticBatch(StaticBatchId batch, const StaticSprite* sprites, size_t count) override;
+    void DrawStaticBatch(StaticBatchId batch) override;
+    void DestroyStaticBatch(StaticBatchId batch) override;
+
+    TextureHandle LoadTexture(const std::string& id, const std::string& filepath) override;
+    TextureHandle LoadTextureAsync(const std::string& id, const std::string& filepath,
+                                   TextureLoadCallback onLoaded) override;
+    [[nodiscard]] bool IsTextureResident(TextureHandle texture) const override;
+    bool LoadTextureAtlas(const std::string& manifestPath) override;
+    TextureHandle CreateTexture(const std::string& id, uint32_t width, uint32_t height,
+                                const uint8_t* pixels) override;
+    TextureHandle CreateTextureRegion(const std::string& id, TextureHandle page,
+                                      uint32_t x, uint32_t y, uint32_t width, uint32_t height) override;
+    [[nodiscard]] TextureHandle FindTexture(const std::string& id) const override;
+    void UnloadTexture(TextureHandle texture) override;
+
+    [[nodiscard]] std::string GetName() const override { return "Null"; }
+    [[nodiscard]] RenderStats GetStats() const override { return m_LastFrameStats; }
+    void ResetStats() override { m_Stats = RenderStats{}; }
+
+    /**
+     * @brief Activa/desactiva la grabación de comandos
+     *
+     * Desactivarla deja solo el coste de las métricas (benchmarks de
+     * throughput del path de render).
+     */
+    void SetRecordCommands(bool enabled) { m_RecordCommands = enabled; }
+
+    /**
+     * @brief Simula el envío con multi-draw indirect (ver SpriteBatch)
+     *
+     * Los batches se agrupan en pasadas de hasta MULTI_DRAW_TEXTURE_UNITS
+     * texturas: drawCalls cuenta pasadas y batches sigue contando batches.
+     * Vacía el batch pendiente antes de cambiar de modo, como OpenGL.
+     */
+    void SetMultiDrawEnabled(bool enabled);
+
+    [[nodiscard]] bool IsMultiDrawEnabled() const { return m_MultiDrawEnabled; }
+
+    /**
+     * @brief Comandos del último frame presentado
+     */
+    [[nodiscard]] const RenderCommandList& GetLastFrameCommands() const { return m_LastFrameCommands; }
+
+    [[nodiscard]] const Counters& GetCounters() const { return m_Counters; }
+    void ResetCounters() { m_Counters = Counters{}; }
+
+    [[nodiscard]] int GetWidth() const { return m_Width; }
+    [[nodiscard]] int GetHeight() const { return m_Height; }
+
+private:
+    /**
+     * @brief Entrada de la tabla de texturas (misma semántica que en OpenGL)
+     */
+    struct TextureEntry {
+        std::string id;         // Vacío = slot libre
+        uint32_t page{TextureHandle::INVALID_INDEX};  // Página de atlas (si es región)
+        uint64_t bytes{0};      // Memoria que ocuparía en GPU (solo CreateTexture)
+
+        [[nodiscard]] bool IsFree() const { return id.empty(); }
+    };
+
+    /**
+     * @brief Batch estático: solo lo que hace falta para contar su dibujo
+     */
+    struct StaticBatch {
+        uint32_t sprites{0};
+        uint32_t ranges{0};     // Draw calls (MAX_TEXTURE_SLOTS texturas por rango)
+        std::vector<uint32_t> bindKeys;     // Texturas/páginas distintas (ordenadas)
+        bool used{false};
+    };
+
+    /**
+     * @brief Reserva una entrada de la tabla (reutiliza slots libres)
+     */
+    TextureHandle AddTextureEntry(const std::string& id);
+
+    /**
+     * @brief Textura que se enlazaría para dibujar (la página en las regiones)
+     * @return Índice de la entrada, o INVALID_INDEX para el placeholder
+     */
+    [[nodiscard]] uint32_t ResolveBindKey(TextureHandle texture) const;
+
+    /**
+     * @brief Cierra el batch abierto (en multi-draw lo suma a la pasada)
+     */
+    void CloseBatch();
+
+    /**
+     * @brief Cierra el batch pendiente y actualiza estadísticas
+     */
+    void FlushBatch();
+
+    /**
+     * @brief Vuelve a la vista de pantalla si había una cámara activa
+     */
+    void RestoreScreenView();
+
+    /**
+     * @brief Cierra la pasada del mundo a resolución reducida (si está abierta)
+     */
+    void ResolveScenePass();
+
+    int m_Width{0};
+    int m_Height{0};
+
+    // Tabla de texturas
+    std::vector<TextureEntry> m_TextureTable;
+    std::vector<uint32_t> m_FreeTextureSlots;
+    std::unordered_map<std::string, TextureHandle> m_TextureIds;
+    uint64_t m_TextureMemory{0};
+
+    // Resolución dinámica (el framebuffer reducido solo se contabiliza)
+    float m_PendingResolutionScale{1.0f};   // Se aplica en Clear
+    float m_ResolutionScale{1.0f};
+    bool m_ScenePassActive{false};
+
+    // Hay una vista de cámara activa (SetView sin ResetView)
+    bool m_ViewActive{false};
+    uint64_t m_SceneTargetBytes{0};
+
+    // Batches estáticos
+    std::vector<StaticBatch> m_StaticBatches;
+    std::vector<StaticBatchId> m_FreeStaticBatches;
+    std::vector<uint32_t> m_StaticBindKeys;
+
+    // Cargas "asíncronas": se confirman en el siguiente Present, como en OpenGL
+    std::vector<std::pair<TextureHandle, TextureLoadCallback>> m_PendingCallbacks;
+
+    // Batch en curso (simulado)
+    std::vector<uint32_t> m_BatchTextures;
+    uint32_t m_BatchCount{0};
+    uint32_t m_PendingSprites{0};
+
+    // Pasada multi-draw en curso (simulada)
+    bool m_MultiDrawEnabled{false};
+    std::vector<uint32_t> m_PassTextures;
+    uint32_t m_PassCount{0};
+
+    // Comandos grabados
+    bool m_RecordCommands{true};
+    RenderCommandList m_Commands;
+    RenderCommandList m_LastFrameCommands;
+
+    // Métricas
+    std::chrono::steady_clock::time_point m_FrameSubmitStart;
+    bool m_FrameSubmitStarted{false};
+    RenderStats m_Stats;
+    RenderStats m_LastFrameStats;
+    Counters m_Counters;
+};
+
+} // namespace MultiNinjaEspacial::Infrastructure::Rendering
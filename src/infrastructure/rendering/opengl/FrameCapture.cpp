@@ -0,0 +1,175 @@
+// ============================================================================
+// Frame Capture - Implementación
+// ============================================================================
+
+#include "FrameCapture.hpp"
+#include <spdlog/spdlog.h>
+
+namespace MultiNinjaEspacial::Infrastructure::Rendering {
+
+namespace {
+
+// Espera máxima por fence en Stop (1 segundo en nanosegundos)
+constexpr GLuint64 STOP_TIMEOUT_NS = 1'000'000'000;
+
+} // namespace
+
+FrameCapture::~FrameCapture() {
+    Stop();
+}
+
+void FrameCapture::Start(std::unique_ptr<IFrameSink> sink) {
+    Stop();
+
+    m_Sink = std::move(sink);
+    m_SinkOpen = false;
+    m_Width = 0;
+    m_Height = 0;
+    m_NextIndex = 0;
+    m_Stats = Stats{};
+}
+
+void FrameCapture::Stop() {
+    if (!m_Sink) {
+        return;
+    }
+
+    // Los frames ya leídos merecen llegar al destino
+    Collect(true);
+    ReleaseBuffers();
+
+    if (m_SinkOpen) {
+        m_Sink->Close();
+    }
+    m_Stats.sink = m_Sink->GetStats();
+    m_Sink.reset();
+    m_SinkOpen = false;
+}
+
+void FrameCapture::Capture(uint32_t width, uint32_t height) {
+    if (!m_Sink || width == 0 || height == 0) {
+        return;
+    }
+
+    // Primer frame: el tamaño de la ventana fija el de la captura
+    if (m_Width == 0) {
+        if (!m_Sink->Open(width, height)) {
+            spdlog::error("FrameCapture: no se pudo abrir {}; captura detenida", m_Sink->GetName());
+            m_Sink.reset();
+            return;
+        }
+        m_SinkOpen = true;
+        m_Width = width;
+        m_Height = height;
+
+        const auto bytes = static_cast<GLsizeiptr>(size_t{width} * height * 4);
+        for (Slot& slot : m_Slots) {
+            glGenBuffers(1, &slot.pbo);
+            glBindBuffer(GL_PIXEL_PACK_BUFFER, slot.pbo);
+            glBufferData(GL_PIXEL_PACK_BUFFER, bytes, nullptr, GL_STREAM_READ);
+        }
+        glBindBuffer(GL_PIXEL_PACK_BUFFER, 0);
+    }
+
+    Collect(false);
+
+    if (width != m_Width || height != m_Height) {
+        m_Stats.skipped++;
+        spdlog::trace("FrameCapture: tamaño {}x{} distinto al de la captura, frame descartado", width, height);
+        return;
+    }
+
+    // Anillo lleno: la GPU no ha terminado ni el frame más viejo
+    if (m_InFlight == PBO_COUNT) {
+        m_Stats.skipped++;
+        return;
+    }
+
+    Slot& slot = m_Slots[(m_Oldest + m_InFlight) % PBO_COUNT];
+
+    // Con un PBO enlazado el último argumento es un offset: la copia es asíncrona
+    glBindFramebuffer(GL_READ_FRAMEBUFFER, 0);
+    glReadBuffer(GL_BACK);
+    glPixelStorei(GL_PACK_ALIGNMENT, 4);
+    glBindBuffer(GL_PIXEL_PACK_BUFFER, slot.pbo);
+    glReadPixels(0, 0, static_cast<GLsizei>(width), static_cast<GLsizei>(height),
+                 GL_RGBA, GL_UNSIGNED_BYTE, nullptr);
+    glBindBuffer(GL_PIXEL_PACK_BUFFER, 0);
+
+    slot.fence = glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+    slot.index = m_NextIndex++;
+    slot.issuedAt = std::chrono::steady_clock::now();
+
+    m_InFlight++;
+    m_Stats.issued++;
+}
+
+FrameCapture::Stats FrameCapture::GetStats() const {
+    Stats stats = m_Stats;
+    stats.inFlight = m_InFlight;
+    if (m_Sink) {
+        stats.sink = m_Sink->GetStats();
+    }
+    return stats;
+}
+
+void FrameCapture::Collect(bool wait) {
+    while (m_InFlight > 0) {
+        Slot& slot = m_Slots[m_Oldest];
+
+        // Sin esperar: si la GPU no llegó, se reintenta el frame siguiente
+        GLenum result = glClientWaitSync(slot.fence, wait ? GL_SYNC_FLUSH_COMMANDS_BIT : 0,
+                                         wait ? STOP_TIMEOUT_NS : 0);
+        if (result == GL_TIMEOUT_EXPIRED) {
+            if (!wait) {
+                return;
+            }
+            spdlog::warn("FrameCapture: la GPU no terminó el frame {}, se descarta", slot.index);
+        } else if (result != GL_WAIT_FAILED) {
+            Deliver(slot);
+        }
+
+        glDeleteSync(slot.fence);
+        slot.fence = nullptr;
+        m_Oldest = (m_Oldest + 1) % PBO_COUNT;
+        m_InFlight--;
+    }
+}
+
+void FrameCapture::Deliver(Slot& slot) {
+    const size_t bytes = size_t{m_Width} * m_Height * 4;
+
+    glBindBuffer(GL_PIXEL_PACK_BUFFER, slot.pbo);
+    const void* mapped = glMapBufferRange(GL_PIXEL_PACK_BUFFER, 0, static_cast<GLsizeiptr>(bytes),
+                                          GL_MAP_READ_BIT);
+    if (mapped != nullptr) {
+        CapturedFrame frame;
+        frame.pixels = static_cast<const uint8_t*>(mapped);
+        frame.width = m_Width;
+        frame.height = m_Height;
+        frame.stride = m_Width * 4;
+        frame.index = slot.index;
+        frame.issuedAt = slot.issuedAt;
+        m_Sink->SubmitFrame(frame);
+        glUnmapBuffer(GL_PIXEL_PACK_BUFFER);
+    } else {
+        spdlog::error("FrameCapture: no se pudo mapear el PBO del frame {}", slot.index);
+    }
+    glBindBuffer(GL_PIXEL_PACK_BUFFER, 0);
+}
+
+void FrameCapture::ReleaseBuffers() {
+    for (Slot& slot : m_Slots) {
+        if (slot.fence != nullptr) {
+            glDeleteSync(slot.fence);
+        }
+        if (slot.pbo != 0) {
+            glDeleteBuffers(1, &slot.pbo);
+        }
+        slot = Slot{};
+    }
+    m_Oldest = 0;
+    m_InFlight = 0;
+}
+
+} // namespace MultiNinjaEspacial::Infrastructure::Rendering
@@ -0,0 +1,140 @@
+// ============================================================================
+// Frame Capture - Lectura asíncrona del framebuffer para streaming
+// ============================================================================
+// Copia el backbuffer a un anillo de pixel buffer objects y lo entrega a un
+// IFrameSink varios frames después, cuando la GPU ya terminó: capturar
+// nunca bloquea el pipeline con un glReadPixels síncrono
+// ============================================================================
+
+#pragma once
+
+#include "../capture/FrameSink.hpp"
+#include <GL/glew.h>
+#include <array>
+#include <chrono>
+#include <cstdint>
+#include <memory>
+
+namespace MultiNinjaEspacial::Infrastructure::Rendering {
+
+/**
+ * @brief Captura de frames por PBO + fences
+ *
+ * Cada Capture():
+ * 1. Entrega al sink los PBOs cuya fence ya está señalizada (mapeo de
+ *    solo lectura, sin copia intermedia) y los libera.
+ * 2. Lanza glReadPixels del backbuffer al siguiente PBO libre: con un PBO
+ *    enlazado a GL_PIXEL_PACK_BUFFER la copia la hace la GPU en orden con
+ *    el resto de comandos y la llamada vuelve al instante.
+ * 3. Pone una fence detrás de la lectura.
+ *
+ * Si la GPU va más de PBO_COUNT frames detrás, el frame no se lee (se
+ * cuenta en skipped) en lugar de esperar. Todas las llamadas deben
+ * hacerse en el hilo del contexto OpenGL.
+ *
+ * Ejemplo de uso:
+ * ```cpp
+ * FrameCapture capture;
+ * capture.Start(std::make_unique<RawFileFrameSink>("capture.rgba"));
+ *
+ * // Al final de cada frame, antes del swap:
+ * capture.Capture(width, height);
+ *
+ * capture.Stop();     // Espera a los frames en vuelo y cierra el sink
+ * ```
+ */
+class FrameCapture {
+public:
+    // Frames en vuelo: la lectura de un frame se consume ~2 frames después
+    static constexpr uint32_t PBO_COUNT = 3;
+
+    /**
+     * @brief Métricas de la captura
+     */
+    struct Stats {
+        uint64_t issued{0};         // Lecturas lanzadas
+        uint64_t skipped{0};        // Frames sin leer (GPU atrasada o tamaño distinto)
+        uint32_t inFlight{0};       // PBOs esperando a la GPU
+        IFrameSink::Stats sink;     // Escritos, descartados y latencia
+    };
+
+    FrameCapture() = default;
+    ~FrameCapture();
+
+    FrameCapture(const FrameCapture&) = delete;
+    FrameCapture& operator=(const FrameCapture&) = delete;
+
+    /**
+     * @brief Empieza a capturar hacia un sink
+     * @param sink Destino (se abre con el tamaño del primer frame)
+     *
+     * No hace llamadas OpenGL: se puede llamar antes de que el contexto
+     * pase al hilo de render.
+     */
+    void Start(std::unique_ptr<IFrameSink> sink);
+
+    /**
+     * @brief Termina la captura: entrega los frames en vuelo y cierra el sink
+     *
+     * Es el único punto que espera a la GPU.
+     */
+    void Stop();
+
+    /**
+     * @brief Lee el backbuffer del frame actual (llamar antes del swap)
+     * @param width Ancho del framebuffer de la ventana
+     * @param height Alto del framebuffer de la ventana
+     *
+     * Si el tamaño cambia respecto al del primer frame, los frames se
+     * descartan (el sink tiene un tamaño fijo).
+     */
+    void Capture(uint32_t width, uint32_t height);
+
+    [[nodiscard]] bool IsActive() const { return m_Sink != nullptr; }
+
+    /**
+     * @brief Métricas (incluye las del sink)
+     */
+    [[nodiscard]] Stats GetStats() const;
+
+private:
+    /**
+     * @brief PBO del anillo y su lectura en curso
+     */
+    struct Slot {
+        GLuint pbo{0};
+        GLsync fence{nullptr};
+        uint64_t index{0};
+        std::chrono::steady_clock::time_point issuedAt;
+    };
+
+    /**
+     * @brief Entrega los frames terminados (en orden)
+     * @param wait true = esperar a la GPU (solo en Stop)
+     */
+    void Collect(bool wait);
+
+    /**
+     * @brief Mapea un PBO terminado y lo pasa al sink
+     */
+    void Deliver(Slot& slot);
+
+    /**
+     * @brief Libera PBOs y fences
+     */
+    void ReleaseBuffers();
+
+    std::unique_ptr<IFrameSink> m_Sink;
+    bool m_SinkOpen{false};
+    uint32_t m_Width{0};
+    uint32_t m_Height{0};
+
+    std::array<Slot, PBO_COUNT> m_Slots{};
+    uint32_t m_Oldest{0};       // Siguiente slot a entregar
+    uint32_t m_InFlight{0};
+
+    uint64_t m_NextIndex{0};
+    Stats m_Stats;
+};
+
+} // namespace MultiNinjaEspacial::Infrastructure::Rendering
@@ -0,0 +1,127 @@
+// ============================================================================
+// GPU Timer - Implementación
+// ============================================================================
+
+#include "GpuTimer.hpp"
+#include <spdlog/spdlog.h>
+
+namespace MultiNinjaEspacial::Infrastructure::Rendering {
+
+GpuTimer::~GpuTimer() {
+    Shutdown();
+}
+
+bool GpuTimer::Initialize() {
+    // GL_TIME_ELAPSED es core desde 3.3 (ARB_timer_query)
+    if (!GLEW_VERSION_3_3 && !GLEW_ARB_timer_query) {
+        spdlog::info("GpuTimer desactivado: el driver no soporta timer queries");
+        return false;
+    }
+
+    for (FrameQueries& frame : m_Frames) {
+        glGenQueries(static_cast<GLsizei>(MAX_PASSES), frame.queries.data());
+        frame.passCount = 0;
+        frame.pending = false;
+    }
+
+    m_Current = 0;
+    m_PassOpen = false;
+    m_PassTimings.reserve(MAX_PASSES);
+    m_Enabled = true;
+
+    spdlog::debug("GpuTimer inicializado ({} frames x {} pasadas)", FRAME_COUNT, MAX_PASSES);
+    return true;
+}
+
+void GpuTimer::Shutdown() {
+    if (!m_Enabled) {
+        return;
+    }
+
+    EndPass();
+    for (FrameQueries& frame : m_Frames) {
+        glDeleteQueries(static_cast<GLsizei>(MAX_PASSES), frame.queries.data());
+        frame = FrameQueries{};
+    }
+    m_Enabled = false;
+}
+
+void GpuTimer::BeginPass(const char* name) {
+    if (!m_Enabled) {
+        return;
+    }
+
+    EndPass();
+
+    FrameQueries& frame = m_Frames[m_Current];
+    if (frame.passCount == MAX_PASSES) {
+        return;
+    }
+
+    frame.names[frame.passCount] = name;
+    glBeginQuery(GL_TIME_ELAPSED, frame.queries[frame.passCount]);
+    frame.passCount++;
+    m_PassOpen = true;
+}
+
+void GpuTimer::EndPass() {
+    if (!m_PassOpen) {
+        return;
+    }
+
+    glEndQuery(GL_TIME_ELAPSED);
+    m_PassOpen = false;
+}
+
+void GpuTimer::EndFrame() {
+    if (!m_Enabled) {
+        return;
+    }
+
+    EndPass();
+
+    FrameQueries& frame = m_Frames[m_Current];
+    frame.pending = frame.passCount > 0;
+    m_Current = (m_Current + 1) % FRAME_COUNT;
+
+    ResolvePending();
+
+    // La GPU va FRAME_COUNT frames detrás: descartar antes que bloquear
+    FrameQueries& next = m_Frames[m_Current];
+    if (next.pending) {
+        spdlog::trace("GpuTimer: frame descartado (GPU demasiado retrasada)");
+        next.pending = false;
+    }
+    next.passCount = 0;
+}
+
+void GpuTimer::ResolvePending() {
+    // Tras avanzar, m_Current es el frame más antiguo del anillo
+    for (uint32_t age = 0; age < FRAME_COUNT; ++age) {
+        FrameQueries& frame = m_Frames[(m_Current + age) % FRAME_COUNT];
+        if (!frame.pending) {
+            continue;
+        }
+
+        // Las queries terminan en orden: basta con mirar la última
+        GLint available = GL_FALSE;
+        glGetQueryObjectiv(frame.queries[frame.passCount - 1], GL_QUERY_RESULT_AVAILABLE, &available);
+        if (!available) {
+            return;
+        }
+
+        m_PassTimings.clear();
+        m_FrameTime = 0.0f;
+        for (uint32_t pass = 0; pass < frame.passCount; ++pass) {
+            GLuint64 elapsedNs = 0;
+            glGetQueryObjectui64v(frame.queries[pass], GL_QUERY_RESULT, &elapsedNs);
+
+            const float ms = static_cast<float>(elapsedNs) / 1'000'000.0f;
+            m_PassTimings.push_back(PassTiming{frame.names[pass], ms});
+            m_FrameTime += ms;
+        }
+        frame.pending = false;
+    }
+}
+
+} // namespace MultiNinjaEspacial::Infrastructure::Rendering
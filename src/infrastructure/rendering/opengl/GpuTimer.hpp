@@ -0,0 +1,133 @@
+// ============================================================================
+// GPU Timer - Medición de tiempo de GPU con timer queries
+// ============================================================================
+// Anillo de queries GL_TIME_ELAPSED que se leen con varios frames de retraso,
+// de forma que medir nunca bloquea la CPU esperando a la GPU
+// ============================================================================
+
+#pragma once
+
+#include <GL/glew.h>
+#include <array>
+#include <cstdint>
+#include <vector>
+
+namespace MultiNinjaEspacial::Infrastructure::Rendering {
+
+/**
+ * @brief Temporizador de GPU por pasadas con nombre
+ *
+ * Las queries GL_TIME_ELAPSED no se pueden anidar, así que las pasadas son
+ * consecutivas: BeginPass() cierra la anterior si seguía abierta. Los
+ * resultados se leen cuando la GPU los tiene listos (normalmente 1-2 frames
+ * después); si la GPU va más de FRAME_COUNT frames detrás, el frame más
+ * viejo se descarta en lugar de esperar.
+ *
+ * Ejemplo de uso:
+ * ```cpp
+ * GpuTimer timer;
+ * timer.Initialize();
+ *
+ * // Cada frame:
+ * timer.BeginPass("scene");
+ * // ... draws ...
+ * timer.BeginPass("uploads");
+ * // ... subidas ...
+ * timer.EndFrame();
+ *
+ * float gpuMs = timer.GetFrameTime();       // Último frame resuelto
+ * for (const auto& pass : timer.GetPassTimings()) { ... }
+ * ```
+ */
+class GpuTimer {
+public:
+    // Frames en vuelo (latencia máxima antes de descartar)
+    static constexpr uint32_t FRAME_COUNT = 4;
+
+    // Pasadas medibles por frame
+    static constexpr uint32_t MAX_PASSES = 8;
+
+    /**
+     * @brief Tiempo de GPU de una pasada
+     */
+    struct PassTiming {
+        const char* name{""};
+        float gpuTime{0.0f};    // Milisegundos
+    };
+
+    GpuTimer() = default;
+    ~GpuTimer();
+
+    GpuTimer(const GpuTimer&) = delete;
+    GpuTimer& operator=(const GpuTimer&) = delete;
+
+    /**
+     * @brief Crea las queries
+     * @return true si el driver soporta timer queries (si no, todo es no-op)
+     *
+     * Requiere contexto OpenGL activo.
+     */
+    bool Initialize();
+
+    /**
+     * @brief Libera las queries
+     */
+    void Shutdown();
+
+    /**
+     * @brief Empieza a medir una pasada (cierra la anterior si está abierta)
+     * @param name Nombre de la pasada (debe vivir toda la ejecución, p.ej. un literal)
+     *
+     * Si ya se usaron MAX_PASSES pasadas en el frame, el resto no se mide.
+     */
+    void BeginPass(const char* name);
+
+    /**
+     * @brief Termina la pasada abierta (si la hay)
+     */
+    void EndPass();
+
+    /**
+     * @brief Cierra el frame, avanza el anillo y recoge resultados disponibles
+     */
+    void EndFrame();
+
+    /**
+     * @brief Tiempo total de GPU del último frame resuelto (ms)
+     */
+    [[nodiscard]] float GetFrameTime() const { return m_FrameTime; }
+
+    /**
+     * @brief Pasadas del último frame resuelto
+     */
+    [[nodiscard]] const std::vector<PassTiming>& GetPassTimings() const { return m_PassTimings; }
+
+    [[nodiscard]] bool IsEnabled() const { return m_Enabled; }
+
+private:
+    /**
+     * @brief Queries de un frame del anillo
+     */
+    struct FrameQueries {
+        std::array<GLuint, MAX_PASSES> queries{};
+        std::array<const char*, MAX_PASSES> names{};
+        uint32_t passCount{0};
+        bool pending{false};    // Emitido y aún sin leer
+    };
+
+    /**
+     * @brief Lee, sin bloquear, los frames pendientes en orden de antigüedad
+     */
+    void ResolvePending();
+
+    std::array<FrameQueries, FRAME_COUNT> m_Frames{};
+    uint32_t m_Current{0};      // Frame que se está grabando
+    bool m_PassOpen{false};
+    bool m_Enabled{false};
+
+    // Último frame resuelto
+    float m_FrameTime{0.0f};
+    std::vector<PassTiming> m_PassTimings;
+};
+
+} // namespace MultiNinjaEspacial::Infrastructure::Rendering
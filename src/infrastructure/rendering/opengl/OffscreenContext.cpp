@@ -0,0 +1,116 @@
+// ============================================================================
+// Offscreen Context - Implementación
+// ============================================================================
+
+#include "OffscreenContext.hpp"
+#include <EGL/eglext.h>
+#include <spdlog/spdlog.h>
+#include <cstring>
+
+namespace MultiNinjaEspacial::Infrastructure::Rendering {
+
+namespace {
+
+EGLDisplay GetOffscreenDisplay() {
+    // Surfaceless (Mesa): no requiere servidor gráfico
+    const char* extensions = eglQueryString(EGL_NO_DISPLAY, EGL_EXTENSIONS);
+    if (extensions != nullptr && std::strstr(extensions, "EGL_MESA_platform_surfaceless") != nullptr) {
+        auto getPlatformDisplay = reinterpret_cast<PFNEGLGETPLATFORMDISPLAYEXTPROC>(
+            eglGetProcAddress("eglGetPlatformDisplayEXT"));
+        if (getPlatformDisplay != nullptr) {
+            EGLDisplay display = getPlatformDisplay(EGL_PLATFORM_SURFACELESS_MESA, EGL_DEFAULT_DISPLAY, nullptr);
+            if (display != EGL_NO_DISPLAY) {
+                return display;
+            }
+        }
+    }
+
+    return eglGetDisplay(EGL_DEFAULT_DISPLAY);
+}
+
+} // namespace
+
+OffscreenContext::~OffscreenContext() {
+    Destroy();
+}
+
+bool OffscreenContext::Create(int width, int height) {
+    m_Display = GetOffscreenDisplay();
+    if (m_Display == EGL_NO_DISPLAY) {
+        spdlog::error("OffscreenContext: no hay display EGL");
+        return false;
+    }
+
+    EGLint major = 0;
+    EGLint minor = 0;
+    if (!eglInitialize(m_Display, &major, &minor)) {
+        spdlog::error("OffscreenContext: eglInitialize falló (0x{:x})", eglGetError());
+        m_Display = EGL_NO_DISPLAY;
+        return false;
+    }
+
+    const EGLint configAttribs[] = {
+        EGL_SURFACE_TYPE, EGL_PBUFFER_BIT,
+        EGL_RENDERABLE_TYPE, EGL_OPENGL_BIT,
+        EGL_RED_SIZE, 8,
+        EGL_GREEN_SIZE, 8,
+        EGL_BLUE_SIZE, 8,
+        EGL_ALPHA_SIZE, 8,
+        EGL_NONE
+    };
+
+    EGLConfig config = nullptr;
+    EGLint configCount = 0;
+    if (!eglChooseConfig(m_Display, configAttribs, &config, 1, &configCount) || configCount == 0) {
+        spdlog::error("OffscreenContext: ninguna configuración EGL con pbuffer + OpenGL");
+        Destroy();
+        return false;
+    }
+
+    const EGLint surfaceAttribs[] = {
+        EGL_WIDTH, width,
+        EGL_HEIGHT, height,
+        EGL_NONE
+    };
+    m_Surface = eglCreatePbufferSurface(m_Display, config, surfaceAttribs);
+
+    // Mismo perfil que GameWindow: 3.3 Core
+    const EGLint contextAttribs[] = {
+        EGL_CONTEXT_MAJOR_VERSION, 3,
+        EGL_CONTEXT_MINOR_VERSION, 3,
+        EGL_CONTEXT_OPENGL_PROFILE_MASK, EGL_CONTEXT_OPENGL_CORE_PROFILE_BIT,
+        EGL_NONE
+    };
+    eglBindAPI(EGL_OPENGL_API);
+    m_Context = eglCreateContext(m_Display, config, EGL_NO_CONTEXT, contextAttribs);
+
+    if (m_Surface == EGL_NO_SURFACE || m_Context == EGL_NO_CONTEXT ||
+        !eglMakeCurrent(m_Display, m_Surface, m_Surface, m_Context)) {
+        spdlog::error("OffscreenContext: no se pudo crear el contexto (0x{:x})", eglGetError());
+        Destroy();
+        return false;
+    }
+
+    spdlog::info("OffscreenContext creado (EGL {}.{}, {}x{})", major, minor, width, height);
+    return true;
+}
+
+void OffscreenContext::Destroy() {
+    if (m_Display == EGL_NO_DISPLAY) {
+        return;
+    }
+
+    eglMakeCurrent(m_Display, EGL_NO_SURFACE, EGL_NO_SURFACE, EGL_NO_CONTEXT);
+    if (m_Context != EGL_NO_CONTEXT) {
+        eglDestroyContext(m_Display, m_Context);
+        m_Context = EGL_NO_CONTEXT;
+    }
+    if (m_Surface != EGL_NO_SURFACE) {
+        eglDestroySurface(m_Display, m_Surface);
+        m_Surface = EGL_NO_SURFACE;
+    }
+    eglTerminate(m_Display);
+    m_Display = EGL_NO_DISPLAY;
+}
+
+} // namespace MultiNinjaEspacial::Infrastructure::Rendering
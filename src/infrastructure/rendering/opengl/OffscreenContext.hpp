@@ -0,0 +1,61 @@
+// ============================================================================
+// Offscreen Context - Contexto OpenGL sin ventana (EGL)
+// ============================================================================
+// Permite ejecutar OpenGLRenderer en máquinas sin GPU ni servidor gráfico
+// (Mesa llvmpipe/softpipe) para tests y benchmarks.
+// Solo se compila con ENABLE_OFFSCREEN_GL.
+// ============================================================================
+
+#pragma once
+
+#include <EGL/egl.h>
+
+namespace MultiNinjaEspacial::Infrastructure::Rendering {
+
+/**
+ * @brief Contexto OpenGL 3.3 Core sobre un pbuffer EGL
+ *
+ * Usa la plataforma "surfaceless" de Mesa si está disponible (no necesita
+ * X11 ni Wayland) y, si no, el display por defecto. Para forzar render por
+ * software: LIBGL_ALWAYS_SOFTWARE=1.
+ *
+ * Ejemplo de uso:
+ * ```cpp
+ * OffscreenContext context;
+ * if (context.Create(800, 600)) {
+ *     OpenGLRenderer renderer;
+ *     renderer.Initialize(800, 600);
+ *     // ... draws, glReadPixels ...
+ * }
+ * ```
+ */
+class OffscreenContext {
+public:
+    OffscreenContext() = default;
+    ~OffscreenContext();
+
+    OffscreenContext(const OffscreenContext&) = delete;
+    OffscreenContext& operator=(const OffscreenContext&) = delete;
+
+    /**
+     * @brief Crea el contexto y lo hace actual en este hilo
+     * @param width Ancho del pbuffer
+     * @param height Alto del pbuffer
+     * @return true si exitoso
+     */
+    bool Create(int width, int height);
+
+    /**
+     * @brief Destruye el contexto
+     */
+    void Destroy();
+
+    [[nodiscard]] bool IsValid() const { return m_Context != EGL_NO_CONTEXT; }
+
+private:
+    EGLDisplay m_Display{EGL_NO_DISPLAY};
+    EGLSurface m_Surface{EGL_NO_SURFACE};
+    EGLContext m_Context{EGL_NO_CONTEXT};
+};
+
+} // namespace MultiNinjaEspacial::Infrastructure::Rendering
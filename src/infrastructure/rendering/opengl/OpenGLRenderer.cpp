@@ -3,17 +3,65 @@
 // ============================================================================
 
 #include "OpenGLRenderer.hpp"
+#include "ShaderCache.hpp"
 #include "ShaderProgram.hpp"
+#include "SpriteBatch.hpp"
+#include "TextureStreamer.hpp"
+#include "../TextureAtlas.hpp"
 #include <spdlog/spdlog.h>
 #include <glm/gtc/matrix_transform.hpp>
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <filesystem>
+#include <limits>
 #include <stdexcept>
-
-// TODO: Añadir biblioteca de carga de imágenes (stb_image) en Fase 1.1
-// Por ahora, LoadTexture es un stub
+#include <thread>
 
 namespace MultiNinjaEspacial::Infrastructure::Rendering {
 
-OpenGLRenderer::OpenGLRenderer() {
+namespace {
+
+/**
+ * @brief Crea una textura RGBA8 con filtrado nearest y clamp
+ * @param pixels Datos iniciales (nullptr = sin inicializar)
+ */
+GLuint CreateTexture2D(uint32_t width, uint32_t height, const void* pixels) {
+    GLuint texture;
+    glGenTextures(1, &texture);
+    glBindTexture(GL_TEXTURE_2D, texture);
+
+    glTexImage2D(GL_TEXTURE_2D, 0, GL_RGBA,
+                 static_cast<GLsizei>(width), static_cast<GLsizei>(height),
+                 0, GL_RGBA, GL_UNSIGNED_BYTE, pixels);
+
+    // Configurar parámetros de textura
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_NEAREST);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_NEAREST);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);
+
+    return texture;
+}
+
+/**
+ * @brief Lado del viewport reducido (nunca 0)
+ */
+GLsizei ScaleExtent(int extent, float scale) {
+    return std::max<GLsizei>(1, static_cast<GLsizei>(std::lround(static_cast<float>(extent) * scale)));
+}
+
+/**
+ * @brief Origen del viewport en la pasada reducida (puede ser 0)
+ */
+GLint ScaleOffset(int offset, float scale) {
+    return static_cast<GLint>(std::lround(static_cast<float>(offset) * scale));
+}
+
+} // namespace
+
+OpenGLRenderer::OpenGLRenderer()
+    : m_TextureUploadBudget(TextureStreamer::DEFAULT_UPLOAD_BUDGET) {
     spdlog::info("OpenGLRenderer creado");
 }
 
@@ -29,6 +77,13 @@ bool OpenGLRenderer::Initialize(int width, int height) {
 
     // Inicializar GLEW (carga extensiones de OpenGL)
     GLenum err = glewInit();
+#ifdef GLEW_ERROR_NO_GLX_DISPLAY
+    // Con contextos EGL (OffscreenContext) no hay display GLX, pero las
+    // funciones de OpenGL sí se han cargado
+    if (err == GLEW_ERROR_NO_GLX_DISPLAY) {
+        err = GLEW_OK;
+    }
+#endif
     if (err != GLEW_OK) {
         spdlog::error("GLEW Init failed: {}", reinterpret_cast<const char*>(glewGetErrorString(err)));
         return false;
@@ -56,11 +111,14 @@ bool OpenGLRenderer::Initialize(int width, int height) {
 
     // Crear projection matrix ortográfica
     // Coordenadas: (0, 0) = top-left, (width, height) = bottom-right
-    m_ProjectionMatrix = glm::ortho(
+    m_FrameUniforms.projection = glm::ortho(
         0.0f, static_cast<float>(width),
         static_cast<float>(height), 0.0f,
         -1.0f, 1.0f
     );
+    m_StartTime = std::chrono::steady_clock::now();
+    m_LastPresentTime = m_StartTime;
+    m_FrameUniformsDirty = true;
 
     // Inicializar shaders
     if (!InitializeShaders()) {
@@ -74,6 +132,26 @@ bool OpenGLRenderer::Initialize(int width, int height) {
         return false;
     }
 
+    // Multi-draw indirect si el driver lo soporta (antes del resumen de la
+    // cache: compila su propio programa)
+    if (m_SpriteBatch->SetMultiDrawEnabled(true)) {
+        spdlog::info("Batch de sprites: multi-draw indirect (GL 4.3)");
+    } else {
+        spdlog::info("Batch de sprites: un draw instanciado por batch (GL 3.3)");
+    }
+
+    // Todos los programas del renderer ya están creados
+    m_ShaderCache->LogSummary();
+
+    // Timer queries (si el driver no las soporta, los tiempos de GPU quedan a 0)
+    m_GpuTimer.Initialize();
+
+    // Inicializar carga asíncrona de texturas
+    if (!InitializeTextureStreaming()) {
+        spdlog::error("Fallo al inicializar la carga de texturas");
+        return false;
+    }
+
     spdlog::info("OpenGLRenderer inicializado correctamente");
     return true;
 }
@@ -81,11 +159,53 @@ bool OpenGLRenderer::Initialize(int width, int height) {
 void OpenGLRenderer::Shutdown() {
     spdlog::info("Cerrando OpenGLRenderer");
 
+    // Parar la carga de texturas (las cargas en curso se descartan)
+    if (m_TextureStreamer) {
+        m_TextureStreamer->Shutdown();
+        m_TextureStreamer.reset();
+    }
+    m_PendingLoads.clear();
+
+    // Entregar los frames capturados en vuelo mientras hay contexto
+    m_FrameCapture.Stop();
+
+    m_GpuTimer.Shutdown();
+
+    m_SceneTarget.Shutdown();
+    m_ScenePassActive = false;
+
     // Liberar texturas
-    for (auto& [id, handle] : m_Textures) {
-        glDeleteTextures(1, &handle);
+    for (auto& entry : m_TextureTable) {
+        if (entry.glHandle != 0) {
+            glDeleteTextures(1, &entry.glHandle);
+        }
+    }
+    m_TextureTable.clear();
+    m_FreeTextureSlots.clear();
+    m_TextureIds.clear();
+    m_TextureMemory = 0;
+
+    if (m_PlaceholderTexture != 0) {
+        glDeleteTextures(1, &m_PlaceholderTexture);
+        m_PlaceholderTexture = 0;
+    }
+
+    if (m_FrameUniformBuffer) {
+        m_FrameUniformBuffer->Shutdown();
+        m_FrameUniformBuffer.reset();
+    }
+
+    // Liberar batches estáticos y el batch (antes que el quad VBO que comparten)
+    for (auto& staticBatch : m_StaticBatches) {
+        SpriteBatch::ReleaseStatic(staticBatch.geometry);
+    }
+    m_StaticBatches.clear();
+    m_FreeStaticBatches.clear();
+
+    if (m_SpriteBatch) {
+        m_SpriteBatch->Shutdown();
+        m_SpriteBatch.reset();
     }
-    m_Textures.clear();
 
     // Liberar buffers
     if (m_QuadVBO != 0) {
@@ -99,42 +219,372 @@ void OpenGLRenderer::Shutdown() {
 
     // Shader se libera automáticamente (unique_ptr)
     m_SpriteShader.reset();
+    m_ShaderCache.reset();
 }
 
 void OpenGLRenderer::Clear(const glm::vec4& color) {
+    // Clear abre el frame: desde aquí se mide el envío de la CPU
+    m_FrameSubmitStart = std::chrono::steady_clock::now();
+    m_FrameSubmitStarted = true;
+    m_GpuTimer.BeginPass("scene");
+
+    // La escala se fija al abrir el frame: un frame nunca mezcla dos
+    m_ResolutionScale = m_PendingResolutionScale;
+    m_ScenePassActive = false;
+    if (m_ResolutionScale < 1.0f) {
+        // El framebuffer sigue el tamaño de la ventana, no la escala: cambiar
+        // de escala no reasigna
+        const uint64_t previousBytes = m_SceneTarget.GetMemoryBytes();
+        const bool ready = m_SceneTarget.Resize(static_cast<uint32_t>(m_Width), static_cast<uint32_t>(m_Height));
+        m_TextureMemory = m_TextureMemory - previousBytes + m_SceneTarget.GetMemoryBytes();
+
+        if (ready) {
+            m_SceneTarget.Bind();
+            glViewport(0, 0, ScaleExtent(m_Width, m_ResolutionScale), ScaleExtent(m_Height, m_ResolutionScale));
+            m_ScenePassActive = true;
+        } else {
+            m_ResolutionScale = 1.0f;
+        }
+    }
+
     glClearColor(color.r, color.g, color.b, color.a);
     glClear(GL_COLOR_BUFFER_BIT);
 }
 
 void OpenGLRenderer::Present() {
-    // El swap de buffers se hace en GameWindow (SDL_GL_SwapWindow)
-    // Aquí solo reseteamos stats
+    // Sin BeginOverlay: el mundo se escala aquí
+    RestoreScreenView();
+    ResolveScenePass();
+
+    // Dibujar todo lo acumulado en el frame y cerrar su sección del anillo
+    m_GpuTimer.BeginPass("sprites");
+    FlushSpriteBatch();
+    if (m_SpriteBatch) {
+        m_SpriteBatch->EndFrame();
+    }
+
+    // Leer el frame terminado para la captura (antes del swap)
+    if (m_FrameCapture.IsActive()) {
+        m_GpuTimer.BeginPass("capture");
+        m_FrameCapture.Capture(static_cast<uint32_t>(m_Width), static_cast<uint32_t>(m_Height));
+    }
+
+    // Subir a la GPU una porción acotada de las texturas en carga
+    m_GpuTimer.BeginPass("texture_upload");
+    ProcessTextureLoads(m_TextureUploadBudget);
+    m_GpuTimer.EndFrame();
+
+    // Tiempo del frame siguiente (se sube al UBO con el primer draw)
+    const auto now = std::chrono::steady_clock::now();
+
+    // Sin Clear() el frame empieza en el Present anterior
+    const auto submitStart = m_FrameSubmitStarted ? m_FrameSubmitStart : m_LastPresentTime;
+    m_Stats.cpuSubmitTime = std::chrono::duration<float, std::milli>(now - submitStart).count();
+    m_Stats.frameTime = m_GpuTimer.GetFrameTime();
+    m_Stats.textureMemory = m_TextureMemory;
+    m_Stats.resolutionScale = m_ResolutionScale;
+    m_FrameSubmitStarted = false;
+
+    m_FrameUniforms.time.x = std::chrono::duration<float>(now - m_StartTime).count();
+    m_FrameUniforms.time.y = std::chrono::duration<float>(now - m_LastPresentTime).count();
+    m_LastPresentTime = now;
+    m_FrameUniformsDirty = true;
+
+    // Las estadísticas del frame quedan consultables hasta el siguiente Present
+    m_LastFrameStats = m_Stats;
     ResetStats();
+
+    // El swap de buffers se hace en GameWindow (SDL_GL_SwapWindow)
 }
 
 void OpenGLRenderer::SetViewport(int x, int y, int width, int height) {
-    glViewport(x, y, width, height);
+    // Lo acumulado se dibuja con la proyección anterior
+    FlushSpriteBatch();
+
+    // Dentro de la pasada reducida el viewport se escala con ella
+    if (m_ScenePassActive) {
+        glViewport(ScaleOffset(x, m_ResolutionScale), ScaleOffset(y, m_ResolutionScale),
+                   ScaleExtent(width, m_ResolutionScale), ScaleExtent(height, m_ResolutionScale));
+    } else {
+        glViewport(x, y, width, height);
+    }
     m_Width = width;
     m_Height = height;
 
     // Actualizar projection matrix
-    m_ProjectionMatrix = glm::ortho(
+    m_FrameUniforms.projection = glm::ortho(
         0.0f, static_cast<float>(width),
         static_cast<float>(height), 0.0f,
         -1.0f, 1.0f
     );
+    m_FrameUniformsDirty = true;
+}
+
+void OpenGLRenderer::SetView(const glm::mat4& viewProjection, const glm::ivec4& viewport) {
+    // Lo acumulado se dibuja con la vista anterior
+    FlushSpriteBatch();
+
+    ApplyViewport(viewport.x, viewport.y, viewport.z, viewport.w);
+    m_FrameUniforms.projection = viewProjection;
+    m_FrameUniformsDirty = true;
+    m_ViewActive = true;
+}
+
+void OpenGLRenderer::ResetView() {
+    RestoreScreenView();
+}
+
+void OpenGLRenderer::RestoreScreenView() {
+    if (!m_ViewActive) {
+        return;
+    }
+
+    FlushSpriteBatch();
+    m_ViewActive = false;
+
+    ApplyViewport(0, 0, m_Width, m_Height);
+    m_FrameUniforms.projection = glm::ortho(
+        0.0f, static_cast<float>(m_Width),
+        static_cast<float>(m_Height), 0.0f,
+        -1.0f, 1.0f
+    );
+    m_FrameUniformsDirty = true;
+}
+
+void OpenGLRenderer::ApplyViewport(int x, int y, int width, int height) {
+    // GL cuenta y desde abajo
+    const int glY = m_Height - (y + height);
+    if (m_ScenePassActive) {
+        glViewport(ScaleOffset(x, m_ResolutionScale), ScaleOffset(glY, m_ResolutionScale),
+                   ScaleExtent(width, m_ResolutionScale), ScaleExtent(height, m_ResolutionScale));
+    } else {
+        glViewport(x, glY, width, height);
+    }
+}
+
+void OpenGLRenderer::SetResolutionScale(float scale) {
+    m_PendingResolutionScale = std::clamp(scale, MIN_RESOLUTION_SCALE, 1.0f);
+}
+
+void OpenGLRenderer::BeginOverlay() {
+    RestoreScreenView();
+    ResolveScenePass();
+}
+
+void OpenGLRenderer::ResolveScenePass() {
+    if (!m_ScenePassActive) {
+        return;
+    }
+
+    // Lo acumulado pertenece al mundo: se dibuja en el framebuffer reducido
+    FlushSpriteBatch();
+    m_ScenePassActive = false;
+
+    m_GpuTimer.BeginPass("upscale");
+    RenderTarget::BindDefault();
+    glViewport(0, 0, m_Width, m_Height);
+
+    // Región usada del framebuffer; la v se invierte porque GL guarda las
+    // filas de abajo arriba y la proyección tiene y = 0 arriba
+    const float u = static_cast<float>(ScaleExtent(m_Width, m_ResolutionScale)) /
+                    static_cast<float>(m_SceneTarget.GetWidth());
+    const float v = static_cast<float>(ScaleExtent(m_Height, m_ResolutionScale)) /
+                    static_cast<float>(m_SceneTarget.GetHeight());
+
+    UploadFrameUniforms();
+    m_SpriteShader->Use();
+    m_SpriteShader->Set(m_SpriteUniforms.model,
+                        glm::scale(glm::mat4(1.0f), glm::vec3(static_cast<float>(m_Width),
+                                                              static_cast<float>(m_Height), 1.0f)));
+    m_SpriteShader->Set(m_SpriteUniforms.color, glm::vec4{1.0f});
+    m_SpriteShader->Set(m_SpriteUniforms.uvRect, glm::vec4{0.0f, v, u, 0.0f});
+
+    glActiveTexture(GL_TEXTURE0);
+    glBindTexture(GL_TEXTURE_2D, m_SceneTarget.GetTexture());
+
+    // Copia opaca (bilineal): el alfa acumulado no se mezcla con la ventana
+    glDisable(GL_BLEND);
+    glBindVertexArray(m_QuadVAO);
+    glDrawArrays(GL_TRIANGLES, 0, 6);
+    glBindVertexArray(0);
+    glEnable(GL_BLEND);
+
+    // No es un sprite del juego: cuenta como draw, no como sprite/batch
+    m_Stats.drawCalls++;
+    m_Stats.triangles += 2;
+    m_Stats.vertices += 6;
+
+    m_GpuTimer.BeginPass("overlay");
 }
 
 void OpenGLRenderer::DrawSprite(
-    const std::string& textureId,
+    TextureHandle texture,
+    const glm::vec2& position,
+    const glm::vec2& size,
+    float rotation,
+    const glm::vec4& color
+) {
+    // Indexación directa en la tabla (sin hashing de strings).
+    // Las regiones de atlas resuelven a la textura de su página.
+    glm::vec4 uvRect;
+    GLuint textureHandle = ResolveTexture(texture, uvRect);
+
+    if (m_BatchingEnabled) {
+        SpriteInstance instance;
+        instance.position = position;
+        instance.size = size;
+        instance.color = color;
+        instance.uvRect = uvRect;
+        instance.rotation = rotation;
+        m_SpriteBatch->Submit(textureHandle, instance);
+        return;
+    }
+
+    DrawSpriteImmediate(textureHandle, uvRect, position, size, rotation, color);
+}
+
+void OpenGLRenderer::DrawSprites(TextureHandle texture, const SpriteDraw* sprites, size_t count) {
+    if (count == 0) {
+        return;
+    }
+
+    // Una sola resolución de textura para todo el bloque
+    glm::vec4 uvRect;
+    GLuint textureHandle = ResolveTexture(texture, uvRect);
+
+    if (m_BatchingEnabled) {
+        m_SpriteBatch->SubmitRange(textureHandle, uvRect, sprites, count);
+        return;
+    }
+
+    for (size_t i = 0; i < count; ++i) {
+        DrawSpriteImmediate(textureHandle, uvRect, sprites[i].position, sprites[i].size,
+                            sprites[i].rotation, sprites[i].color);
+    }
+}
+
+// ============================================================================
+// Batches estáticos
+// ============================================================================
+
+OpenGLRenderer::StaticBatchId OpenGLRenderer::CreateStaticBatch() {
+    StaticBatchId id;
+    if (!m_FreeStaticBatches.empty()) {
+        id = m_FreeStaticBatches.back();
+        m_FreeStaticBatches.pop_back();
+    } else {
+        id = static_cast<StaticBatchId>(m_StaticBatches.size());
+        m_StaticBatches.emplace_back();
+    }
+
+    m_StaticBatches[id].used = true;
+    return id;
+}
+
+/**
+ * @brief Reemplaza el contenido de un batch estático
+ *
+ * Los sprites se ordenan (estable) por la textura con la que se enlazan
+ * (la página, para regiones de atlas) y se cortan en rangos de como mucho
+ * MAX_TEXTURE_SLOTS texturas: cada rango será un draw call.
+ */
+bool OpenGLRenderer::UpdateStaticBatch(StaticBatchId batch, const StaticSprite* sprites, size_t count) {
+    if (batch >= m_StaticBatches.size() || !m_StaticBatches[batch].used || !m_SpriteBatch) {
+        spdlog::error("UpdateStaticBatch: batch {} inválido", batch);
+        return false;
+    }
+
+    m_StaticOrder.resize(count);
+    for (size_t i = 0; i < count; ++i) {
+        m_StaticOrder[i] = static_cast<uint32_t>(i);
+    }
+    std::stable_sort(m_StaticOrder.begin(), m_StaticOrder.end(), [&](uint32_t a, uint32_t b) {
+        return GetBindTexture(sprites[a].texture).index < GetBindTexture(sprites[b].texture).index;
+    });
+
+    StaticBatch& staticBatch = m_StaticBatches[batch];
+    staticBatch.ranges.clear();
+    m_StaticScratch.resize(count);
+
+    for (size_t i = 0; i < count; ++i) {
+        const StaticSprite& sprite = sprites[m_StaticOrder[i]];
+        const TextureHandle bindTexture = GetBindTexture(sprite.texture);
+
+        // Las texturas llegan ordenadas: basta mirar el último slot del rango
+        if (staticBatch.ranges.empty() ||
+            staticBatch.ranges.back().textures[staticBatch.ranges.back().textureCount - 1].index != bindTexture.index) {
+            if (staticBatch.ranges.empty() || staticBatch.ranges.back().textureCount == SpriteBatch::MAX_TEXTURE_SLOTS) {
+                StaticRange range;
+                range.firstInstance = static_cast<uint32_t>(i);
+                staticBatch.ranges.push_back(range);
+            }
+            StaticRange& range = staticBatch.ranges.back();
+            range.textures[range.textureCount++] = bindTexture;
+        }
+
+        StaticRange& range = staticBatch.ranges.back();
+        SpriteInstance& instance = m_StaticScratch[i];
+        instance.position = sprite.sprite.position;
+        instance.size = sprite.sprite.size;
+        instance.color = sprite.sprite.color;
+        // Solo se hornea la región: la textura OpenGL se resuelve al dibujar
+        instance.uvRect = GetUVRect(sprite.texture);
+        instance.rotation = sprite.sprite.rotation;
+        instance.textureSlot = range.textureCount - 1;
+        range.instanceCount++;
+    }
+
+    if (!m_SpriteBatch->UploadStatic(staticBatch.geometry, m_StaticScratch.data(), count)) {
+        staticBatch.ranges.clear();
+        return false;
+    }
+
+    m_Stats.uploadBytes += count * sizeof(SpriteInstance);
+    return true;
+}
+
+void OpenGLRenderer::DrawStaticBatch(StaticBatchId batch) {
+    if (batch >= m_StaticBatches.size() || !m_StaticBatches[batch].used) {
+        return;
+    }
+
+    // Lo pendiente va debajo: respetar el orden de envío
+    FlushSpriteBatch();
+    UploadFrameUniforms();
+
+    const StaticBatch& staticBatch = m_StaticBatches[batch];
+    std::array<GLuint, SpriteBatch::MAX_TEXTURE_SLOTS> textures{};
+    for (const StaticRange& range : staticBatch.ranges) {
+        glm::vec4 uvRect;
+        for (uint32_t slot = 0; slot < range.textureCount; ++slot) {
+            textures[slot] = ResolveTexture(range.textures[slot], uvRect);
+        }
+        m_SpriteBatch->DrawStatic(staticBatch.geometry, range.firstInstance, range.instanceCount,
+                                  textures.data(), range.textureCount, m_Stats);
+    }
+}
+
+void OpenGLRenderer::DestroyStaticBatch(StaticBatchId batch) {
+    if (batch >= m_StaticBatches.size() || !m_StaticBatches[batch].used) {
+        return;
+    }
+
+    StaticBatch& staticBatch = m_StaticBatches[batch];
+    SpriteBatch::ReleaseStatic(staticBatch.geometry);
+    staticBatch.ranges.clear();
+    staticBatch.used = false;
+    m_FreeStaticBatches.push_back(batch);
+}
+
+void OpenGLRenderer::DrawSpriteImmediate(
+    GLuint textureHandle,
+    const glm::vec4& uvRect,
     const glm::vec2& position,
     const glm::vec2& size,
     float rotation,
     const glm::vec4& color
 ) {
-    // Buscar textura
-    auto it = m_Textures.find(textureId);
-    GLuint textureHandle = (it != m_Textures.end()) ? it->second : 0;
+    UploadFrameUniforms();
 
     // Activar shader
     m_SpriteShader->Use();
@@ -147,58 +597,482 @@ void OpenGLRenderer::DrawSprite(
     model = glm::translate(model, glm::vec3(-0.5f * size.x, -0.5f * size.y, 0.0f));
     model = glm::scale(model, glm::vec3(size, 1.0f));
 
-    // Enviar uniforms al shader
-    m_SpriteShader->SetMatrix4("uProjection", m_ProjectionMatrix);
-    m_SpriteShader->SetMatrix4("uModel", model);
-    m_SpriteShader->SetVector4f("uColor", color);
+    // Enviar uniforms al shader (handles resueltos al linkar; la
+    // proyección ya está en el UBO del frame)
+    m_SpriteShader->Set(m_SpriteUniforms.model, model);
+    m_SpriteShader->Set(m_SpriteUniforms.color, color);
+    m_SpriteShader->Set(m_SpriteUniforms.uvRect, uvRect);
 
-    // Bind texture
+    // Bind texture (uTexture apunta siempre a la unidad 0)
     glActiveTexture(GL_TEXTURE0);
     glBindTexture(GL_TEXTURE_2D, textureHandle);
-    m_SpriteShader->SetInteger("uTexture", 0);
 
     // Dibujar quad
     glBindVertexArray(m_QuadVAO);
     glDrawArrays(GL_TRIANGLES, 0, 6);
     glBindVertexArray(0);
 
-    // Actualizar stats
+    // Actualizar stats (en modo inmediato cada sprite es su propio batch)
     m_Stats.drawCalls++;
+    m_Stats.batches++;
+    m_Stats.sprites++;
     m_Stats.triangles += 2;
     m_Stats.vertices += 6;
 }
 
-bool OpenGLRenderer::LoadTexture(const std::string& id, const std::string& filepath) {
-    // TODO: Implementar carga de imágenes con stb_image
-    // Por ahora, crear textura dummy blanca
+void OpenGLRenderer::FlushSpriteBatch() {
+    if (m_SpriteBatch && m_SpriteBatch->GetPendingCount() > 0) {
+        UploadFrameUniforms();
+        m_SpriteBatch->Flush(m_Stats);
+    }
+}
 
-    GLuint texture;
-    glGenTextures(1, &texture);
-    glBindTexture(GL_TEXTURE_2D, texture);
+void OpenGLRenderer::UploadFrameUniforms() {
+    if (!m_FrameUniformsDirty) {
+        return;
+    }
 
-    // Textura blanca 1x1
-    unsigned char whitePixel[] = {255, 255, 255, 255};
-    glTexImage2D(GL_TEXTURE_2D, 0, GL_RGBA, 1, 1, 0, GL_RGBA, GL_UNSIGNED_BYTE, whitePixel);
+    m_FrameUniformBuffer->Update(m_FrameUniforms);
+    m_FrameUniformsDirty = false;
+}
 
-    // Configurar parámetros de textura
-    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_NEAREST);
-    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_NEAREST);
-    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);
-    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);
+void OpenGLRenderer::SetBatchingEnabled(bool enabled) {
+    if (m_BatchingEnabled == enabled) {
+        return;
+    }
+
+    // Vaciar lo pendiente para no perder sprites al cambiar de modo
+    FlushSpriteBatch();
+    m_BatchingEnabled = enabled;
+    spdlog::info("Batching de sprites {}", enabled ? "activado" : "desactivado");
+}
 
-    m_Textures[id] = texture;
+bool OpenGLRenderer::SetMultiDrawEnabled(bool enabled) {
+    if (!m_SpriteBatch) {
+        return false;
+    }
+    if (m_SpriteBatch->IsMultiDrawEnabled() == enabled) {
+        return true;
+    }
 
-    spdlog::info("Textura cargada (dummy): {} → {}", id, filepath);
+    // Lo pendiente se dibuja con el modo con el que se acumuló
+    FlushSpriteBatch();
+    if (!m_SpriteBatch->SetMultiDrawEnabled(enabled)) {
+        spdlog::warn("Multi-draw indirect no disponible en este driver");
+        return false;
+    }
+    spdlog::info("Multi-draw indirect {}", enabled ? "activado" : "desactivado");
     return true;
 }
 
-void OpenGLRenderer::UnloadTexture(const std::string& id) {
-    auto it = m_Textures.find(id);
-    if (it != m_Textures.end()) {
-        glDeleteTextures(1, &it->second);
-        m_Textures.erase(it);
-        spdlog::info("Textura descargada: {}", id);
+bool OpenGLRenderer::IsMultiDrawEnabled() const {
+    return m_SpriteBatch && m_SpriteBatch->IsMultiDrawEnabled();
+}
+
+TextureHandle OpenGLRenderer::LoadTexture(const std::string& id, const std::string& filepath) {
+    return LoadTextureAsync(id, filepath, {});
+}
+
+/**
+ * @brief Encola la carga de una textura
+ * @return Handle utilizable de inmediato (dibuja el placeholder hasta que
+ *         la textura esté residente)
+ *
+ * La decodificación ocurre en los workers del TextureStreamer y la subida
+ * se reparte entre frames en Present(), así que cargar un nivel no
+ * produce picos de frame time.
+ */
+TextureHandle OpenGLRenderer::LoadTextureAsync(const std::string& id, const std::string& filepath,
+                                               TextureLoadCallback onLoaded) {
+    // Si ya está cargada (o cargando), reutilizar el handle
+    auto existing = m_TextureIds.find(id);
+    if (existing != m_TextureIds.end()) {
+        const TextureHandle handle = existing->second;
+        const uint32_t ticket = m_TextureTable[handle.index].loadTicket;
+
+        if (ticket != 0) {
+            if (onLoaded) {
+                m_PendingLoads[ticket].callbacks.push_back(std::move(onLoaded));
+            }
+        } else if (onLoaded) {
+            onLoaded(handle, IsTextureResident(handle));
+        }
+        return handle;
+    }
+
+    const uint32_t ticket = m_NextLoadTicket++;
+
+    TextureEntry entry;
+    entry.id = id;
+    entry.loadTicket = ticket;
+    const TextureHandle handle = AddTextureEntry(std::move(entry));
+
+    PendingLoad pending{handle.index, {}};
+    if (onLoaded) {
+        pending.callbacks.push_back(std::move(onLoaded));
+    }
+    m_PendingLoads.emplace(ticket, std::move(pending));
+
+    m_TextureStreamer->Enqueue(ticket, filepath);
+
+    spdlog::debug("Textura en cola: {} → {} (handle {})", id, filepath, handle.index);
+    return handle;
+}
+
+bool OpenGLRenderer::IsTextureResident(TextureHandle texture) const {
+    if (texture.index >= m_TextureTable.size()) {
+        return false;
+    }
+
+    const TextureEntry& entry = m_TextureTable[texture.index];
+    if (entry.page != TextureHandle::INVALID_INDEX) {
+        return m_TextureTable[entry.page].glHandle != 0;
     }
+    return entry.glHandle != 0;
+}
+
+void OpenGLRenderer::ProcessTextureLoads(size_t byteBudget) {
+    if (!m_TextureStreamer) {
+        return;
+    }
+
+    std::vector<TextureStreamer::Completed> completed;
+    m_Stats.uploadBytes += m_TextureStreamer->Update(byteBudget, completed);
+
+    for (auto& done : completed) {
+        auto it = m_PendingLoads.find(done.ticket);
+        if (it == m_PendingLoads.end()) {
+            // Descargada mientras se cargaba
+            if (done.texture != 0) {
+                glDeleteTextures(1, &done.texture);
+            }
+            continue;
+        }
+
+        PendingLoad pending = std::move(it->second);
+        m_PendingLoads.erase(it);
+
+        TextureEntry& entry = m_TextureTable[pending.index];
+        entry.loadTicket = 0;
+
+        const bool success = done.texture != 0;
+        if (success) {
+            entry.glHandle = done.texture;
+            entry.width = done.width;
+            entry.height = done.height;
+            m_TextureMemory += uint64_t{done.width} * done.height * 4;
+            spdlog::info("Textura cargada: {} ({}x{}, handle {})",
+                         entry.id, done.width, done.height, pending.index);
+        } else {
+            // Se queda con el placeholder
+            spdlog::error("Fallo al cargar textura '{}': {}", entry.id, done.error);
+        }
+
+        // Los callbacks pueden cargar más texturas (y mover la tabla)
+        const TextureHandle handle(pending.index);
+        for (auto& callback : pending.callbacks) {
+            callback(handle, success);
+        }
+    }
+}
+
+void OpenGLRenderer::WaitForTextureLoads() {
+    using namespace std::chrono_literals;
+
+    while (!m_PendingLoads.empty()) {
+        ProcessTextureLoads(std::numeric_limits<size_t>::max());
+        if (!m_PendingLoads.empty()) {
+            std::this_thread::sleep_for(1ms);
+        }
+    }
+}
+
+/**
+ * @brief Carga un atlas generado offline por atlas_packer
+ *
+ * No empaqueta nada en runtime: las páginas se cargan como texturas y
+ * cada región del manifest se registra como una entrada más de la tabla
+ * que apunta a su página con su rectángulo UV.
+ */
+bool OpenGLRenderer::LoadTextureAtlas(const std::string& manifestPath) {
+    AtlasManifest manifest;
+    if (!AtlasManifest::Load(manifestPath, manifest)) {
+        return false;
+    }
+
+    // Las imágenes de página son relativas al manifest
+    const std::filesystem::path baseDir = std::filesystem::path(manifestPath).parent_path();
+
+    std::vector<uint32_t> pages;
+    pages.reserve(manifest.pageImages.size());
+    for (const auto& image : manifest.pageImages) {
+        const std::string pagePath = (baseDir / image).string();
+        TextureHandle page = LoadTexture(pagePath, pagePath);
+        if (!page.IsValid()) {
+            spdlog::error("No se pudo cargar la página de atlas: {}", pagePath);
+            return false;
+        }
+        m_TextureTable[page.index].isAtlasPage = true;
+        pages.push_back(page.index);
+    }
+
+    for (const auto& region : manifest.regions) {
+        if (m_TextureIds.contains(region.id)) {
+            spdlog::warn("Textura '{}' ya cargada, se ignora su región en {}", region.id, manifestPath);
+            continue;
+        }
+
+        TextureEntry entry;
+        entry.id = region.id;
+        entry.page = pages[region.page];
+        entry.uvRect = manifest.GetUVRect(region);
+        entry.width = region.width;
+        entry.height = region.height;
+        AddTextureEntry(std::move(entry));
+    }
+
+    spdlog::info("Atlas cargado: {} ({} regiones en {} página(s))",
+                 manifestPath, manifest.regions.size(), pages.size());
+    return true;
+}
+
+/**
+ * @brief Empaqueta las texturas sueltas en páginas de atlas
+ * @param pageSize Lado de cada página (se limita a GL_MAX_TEXTURE_SIZE)
+ * @return true si exitoso
+ *
+ * Proceso:
+ * 1. Empaquetar los tamaños de todas las texturas sueltas (AtlasPacker)
+ * 2. Crear las páginas y copiar cada textura a su región
+ *    (glCopyImageSubData si hay ARB_copy_image, si no lectura + subida)
+ * 3. Redirigir cada entrada a su página y liberar la textura original
+ */
+bool OpenGLRenderer::BuildTextureAtlas(uint32_t pageSize) {
+    GLint maxTextureSize = 0;
+    glGetIntegerv(GL_MAX_TEXTURE_SIZE, &maxTextureSize);
+    pageSize = std::min(pageSize, static_cast<uint32_t>(maxTextureSize));
+
+    AtlasPacker packer(pageSize);
+    std::vector<uint32_t> sources;  // Índice en la tabla de cada región (orden de Add)
+    for (uint32_t i = 0; i < m_TextureTable.size(); ++i) {
+        const TextureEntry& entry = m_TextureTable[i];
+        if (entry.glHandle != 0 && !entry.isAtlasPage) {
+            packer.Add(entry.id, entry.width, entry.height);
+            sources.push_back(i);
+        }
+    }
+
+    // Solo se empaqueta lo residente; lo que siga en carga queda suelto
+    if (!m_PendingLoads.empty()) {
+        spdlog::warn("BuildTextureAtlas: {} textura(s) aún en carga quedan fuera del atlas",
+                     m_PendingLoads.size());
+    }
+
+    if (sources.size() < 2) {
+        spdlog::debug("BuildTextureAtlas: nada que empaquetar");
+        return true;
+    }
+
+    AtlasManifest layout;
+    if (!packer.Pack(layout)) {
+        return false;
+    }
+
+    // Los sprites pendientes usan las texturas que vamos a borrar
+    FlushSpriteBatch();
+
+    std::vector<uint32_t> pages;
+    for (uint32_t p = 0; p < layout.GetPageCount(); ++p) {
+        TextureEntry page;
+        page.glHandle = CreateTexture2D(pageSize, pageSize, nullptr);
+        page.id = "__atlas_page_" + std::to_string(page.glHandle);
+        page.width = pageSize;
+        page.height = pageSize;
+        page.isAtlasPage = true;
+        pages.push_back(AddTextureEntry(std::move(page)).index);
+        m_TextureMemory += uint64_t{pageSize} * pageSize * 4;
+    }
+
+    std::vector<uint8_t> pixels;
+    for (size_t r = 0; r < layout.regions.size(); ++r) {
+        const AtlasRegion& region = layout.regions[r];
+        TextureEntry& entry = m_TextureTable[sources[r]];
+        const GLuint pageTexture = m_TextureTable[pages[region.page]].glHandle;
+
+        if (GLEW_ARB_copy_image) {
+            glCopyImageSubData(
+                entry.glHandle, GL_TEXTURE_2D, 0, 0, 0, 0,
+                pageTexture, GL_TEXTURE_2D, 0,
+                static_cast<GLint>(region.x), static_cast<GLint>(region.y), 0,
+                static_cast<GLsizei>(region.width), static_cast<GLsizei>(region.height), 1);
+        } else {
+            pixels.resize(size_t{region.width} * region.height * 4);
+            glBindTexture(GL_TEXTURE_2D, entry.glHandle);
+            glGetTexImage(GL_TEXTURE_2D, 0, GL_RGBA, GL_UNSIGNED_BYTE, pixels.data());
+            glBindTexture(GL_TEXTURE_2D, pageTexture);
+            glTexSubImage2D(GL_TEXTURE_2D, 0,
+                            static_cast<GLint>(region.x), static_cast<GLint>(region.y),
+                            static_cast<GLsizei>(region.width), static_cast<GLsizei>(region.height),
+                            GL_RGBA, GL_UNSIGNED_BYTE, pixels.data());
+        }
+
+        glDeleteTextures(1, &entry.glHandle);
+        m_TextureMemory -= uint64_t{entry.width} * entry.height * 4;
+        entry.glHandle = 0;
+        entry.page = pages[region.page];
+        entry.uvRect = layout.GetUVRect(region);
+    }
+
+    spdlog::info("Atlas construido en runtime: {} texturas en {} página(s) de {}px",
+                 sources.size(), pages.size(), pageSize);
+    return true;
+}
+
+TextureHandle OpenGLRenderer::CreateTexture(const std::string& id, uint32_t width, uint32_t height,
+                                            const uint8_t* pixels) {
+    if (m_TextureIds.contains(id)) {
+        spdlog::error("CreateTexture: el ID '{}' ya existe", id);
+        return {};
+    }
+    if (width == 0 || height == 0 || pixels == nullptr) {
+        spdlog::error("CreateTexture: textura '{}' vacía ({}x{})", id, width, height);
+        return {};
+    }
+
+    const uint64_t bytes = uint64_t{width} * height * 4;
+
+    TextureEntry entry;
+    entry.id = id;
+    entry.glHandle = CreateTexture2D(width, height, pixels);
+    entry.width = width;
+    entry.height = height;
+
+    m_TextureMemory += bytes;
+    m_Stats.uploadBytes += bytes;
+
+    spdlog::info("Textura creada en memoria: {} ({}x{})", id, width, height);
+    return AddTextureEntry(std::move(entry));
+}
+
+TextureHandle OpenGLRenderer::CreateTextureRegion(const std::string& id, TextureHandle page,
+                                                  uint32_t x, uint32_t y,
+                                                  uint32_t width, uint32_t height) {
+    if (m_TextureIds.contains(id)) {
+        spdlog::error("CreateTextureRegion: el ID '{}' ya existe", id);
+        return {};
+    }
+    if (page.index >= m_TextureTable.size() || m_TextureTable[page.index].glHandle == 0) {
+        spdlog::error("CreateTextureRegion: página inválida para '{}'", id);
+        return {};
+    }
+
+    TextureEntry& pageEntry = m_TextureTable[page.index];
+    if (x + width > pageEntry.width || y + height > pageEntry.height) {
+        spdlog::error("CreateTextureRegion: región '{}' fuera de la página", id);
+        return {};
+    }
+    pageEntry.isAtlasPage = true;
+
+    const float pageWidth = static_cast<float>(pageEntry.width);
+    const float pageHeight = static_cast<float>(pageEntry.height);
+
+    TextureEntry entry;
+    entry.id = id;
+    entry.page = page.index;
+    entry.uvRect = {
+        static_cast<float>(x) / pageWidth,
+        static_cast<float>(y) / pageHeight,
+        static_cast<float>(x + width) / pageWidth,
+        static_cast<float>(y + height) / pageHeight
+    };
+    entry.width = width;
+    entry.height = height;
+    return AddTextureEntry(std::move(entry));
+}
+
+TextureHandle OpenGLRenderer::FindTexture(const std::string& id) const {
+    auto it = m_TextureIds.find(id);
+    return (it != m_TextureIds.end()) ? it->second : TextureHandle{};
+}
+
+void OpenGLRenderer::UnloadTexture(TextureHandle texture) {
+    if (texture.index >= m_TextureTable.size() || m_TextureTable[texture.index].IsFree()) {
+        return;
+    }
+
+    // Los sprites pendientes podrían usar esta textura
+    FlushSpriteBatch();
+
+    // Cancelar la carga en curso (el resultado se descartará al llegar)
+    const uint32_t ticket = m_TextureTable[texture.index].loadTicket;
+    if (ticket != 0) {
+        m_PendingLoads.erase(ticket);
+    }
+
+    // Los batches estáticos tienen el slot y las UVs horneados: si siguieran
+    // dibujando, pintarían la textura que ocupe el slot después
+    ClearStaticBatchesUsing(texture.index);
+
+    // Una página arrastra a todas sus regiones
+    if (m_TextureTable[texture.index].isAtlasPage) {
+        for (uint32_t i = 0; i < m_TextureTable.size(); ++i) {
+            if (m_TextureTable[i].page == texture.index) {
+                ReleaseTextureEntry(i);
+            }
+        }
+    }
+
+    TextureEntry& entry = m_TextureTable[texture.index];
+    if (entry.glHandle != 0) {
+        glDeleteTextures(1, &entry.glHandle);
+        m_TextureMemory -= uint64_t{entry.width} * entry.height * 4;
+    }
+    spdlog::info("Textura descargada: {} (handle {})", entry.id, texture.index);
+    ReleaseTextureEntry(texture.index);
+}
+
+void OpenGLRenderer::ClearStaticBatchesUsing(uint32_t index) {
+    // Los rangos guardan la textura enlazada (la página, en las regiones):
+    // descargar una región suelta no toca a los batches
+    for (StaticBatchId id = 0; id < m_StaticBatches.size(); ++id) {
+        StaticBatch& staticBatch = m_StaticBatches[id];
+        if (!staticBatch.used) {
+            continue;
+        }
+
+        const bool uses = std::any_of(staticBatch.ranges.begin(), staticBatch.ranges.end(),
+            [index](const StaticRange& range) {
+                return std::any_of(range.textures.begin(), range.textures.begin() + range.textureCount,
+                                   [index](TextureHandle texture) { return texture.index == index; });
+            });
+        if (uses) {
+            spdlog::warn("Batch estático {} vaciado: usaba la textura descargada (handle {})", id, index);
+            staticBatch.ranges.clear();
+        }
+    }
+}
+
+TextureHandle OpenGLRenderer::AddTextureEntry(TextureEntry entry) {
+    // Asignar slot en la tabla (reutilizando huecos de texturas descargadas)
+    uint32_t index;
+    if (!m_FreeTextureSlots.empty()) {
+        index = m_FreeTextureSlots.back();
+        m_FreeTextureSlots.pop_back();
+    } else {
+        index = static_cast<uint32_t>(m_TextureTable.size());
+        m_TextureTable.emplace_back();
+    }
+
+    TextureHandle handle(index);
+    m_TextureIds.emplace(entry.id, handle);
+    m_TextureTable[index] = std::move(entry);
+    return handle;
+}
+
+void OpenGLRenderer::ReleaseTextureEntry(uint32_t index) {
+    m_TextureIds.erase(m_TextureTable[index].id);
+    m_TextureTable[index] = TextureEntry{};
+    m_FreeTextureSlots.push_back(index);
 }
 
 std::string OpenGLRenderer::GetName() const {
@@ -207,7 +1081,7 @@ std::string OpenGLRenderer::GetName() const {
 }
 
 IRenderer::RenderStats OpenGLRenderer::GetStats() const {
-    return m_Stats;
+    return m_LastFrameStats;
 }
 
 void OpenGLRenderer::ResetStats() {
@@ -223,11 +1097,17 @@ bool OpenGLRenderer::InitializeShaders() {
 
         out vec2 vTexCoord;
 
-        uniform mat4 uProjection;
+        // Datos por frame (UBO compartido, ver FrameUniforms)
+        layout (std140) uniform FrameData {
+            mat4 uProjection;
+            vec4 uTime;
+        };
+
         uniform mat4 uModel;
+        uniform vec4 uUVRect;  // Región de atlas {u0, v0, u1, v1}
 
         void main() {
-            vTexCoord = aTexCoord;
+            vTexCoord = mix(uUVRect.xy, uUVRect.zw, aTexCoord);
             gl_Position = uProjection * uModel * vec4(aPosition, 0.0, 1.0);
         }
     )";
@@ -246,13 +1126,45 @@ bool OpenGLRenderer::InitializeShaders() {
         }
     )";
 
+    // Sin soporte de program binaries la cache queda inactiva (todo misses)
+    m_ShaderCache = std::make_unique<ShaderCache>();
+    m_ShaderCache->Initialize();
+
     m_SpriteShader = std::make_unique<ShaderProgram>();
-    return m_SpriteShader->CompileFromSource(vertexShaderSrc, fragmentShaderSrc);
+    if (!m_SpriteShader->CompileFromSource(vertexShaderSrc, fragmentShaderSrc, m_ShaderCache.get())) {
+        return false;
+    }
+
+    // Resolver uniforms una sola vez
+    m_SpriteShader->BindUniformBlock(FRAME_UNIFORMS_BLOCK, FRAME_UNIFORMS_BINDING);
+    m_SpriteUniforms.model = m_SpriteShader->GetUniform<glm::mat4>("uModel");
+    m_SpriteUniforms.color = m_SpriteShader->GetUniform<glm::vec4>("uColor");
+    m_SpriteUniforms.uvRect = m_SpriteShader->GetUniform<glm::vec4>("uUVRect");
+
+    m_SpriteShader->Use();
+    m_SpriteShader->Set(m_SpriteShader->GetUniform<int>("uTexture"), 0);
+    return true;
 }
 
 bool OpenGLRenderer::InitializeBuffers() {
     CreateQuadGeometry();
-    return true;
+
+    m_FrameUniformBuffer = std::make_unique<UniformBuffer>();
+    if (!m_FrameUniformBuffer->Initialize(sizeof(FrameUniforms), FRAME_UNIFORMS_BINDING)) {
+        return false;
+    }
+
+    m_SpriteBatch = std::make_unique<SpriteBatch>();
+    return m_SpriteBatch->Initialize(m_QuadVBO, m_ShaderCache.get());
+}
+
+bool OpenGLRenderer::InitializeTextureStreaming() {
+    // Placeholder blanco: mismo aspecto que un handle inválido
+    unsigned char whitePixel[] = {255, 255, 255, 255};
+    m_PlaceholderTexture = CreateTexture2D(1, 1, whitePixel);
+
+    m_TextureStreamer = std::make_unique<TextureStreamer>();
+    return m_TextureStreamer->Initialize();
 }
 
 void OpenGLRenderer::CreateQuadGeometry() {
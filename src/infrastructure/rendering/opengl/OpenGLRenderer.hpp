@@ -7,14 +7,24 @@
 #pragma once
 
 #include "../IRenderer.hpp"
+#include "FrameCapture.hpp"
+#include "GpuTimer.hpp"
+#include "RenderTarget.hpp"
+#include "ShaderProgram.hpp"
+#include "SpriteBatch.hpp"
+#include "UniformBuffer.hpp"
 #include <GL/glew.h>
+#include <array>
+#include <chrono>
 #include <unordered_map>
 #include <memory>
+#include <vector>
 
 namespace MultiNinjaEspacial::Infrastructure::Rendering {
 
 // Forward declaration
-class ShaderProgram;
+class ShaderCache;
+class TextureStreamer;
 class VertexBuffer;
 
 /**
@@ -22,20 +32,29 @@ class VertexBuffer;
  *
  * Características:
  * - OpenGL 3.3 Core Profile (compatible con macOS/Windows/Linux)
- * - Batch rendering para sprites
+ * - Batch rendering para sprites (instancing, activo por defecto)
  * - Sistema de shaders modular
- * - Gestión de texturas
+ * - Gestión de texturas (con atlas: varias texturas comparten página)
+ * - Carga de texturas asíncrona (decodificación en workers + subida por PBO)
+ * - Tiempo de GPU por pasada (timer queries, sin bloquear)
+ * - Resolución dinámica: el mundo se dibuja en un framebuffer reducido y
+ *   se escala a la ventana; la interfaz (tras BeginOverlay) va a nativa
+ * - Batches estáticos en buffers GL_STATIC_DRAW (un draw call por cada 8
+ *   texturas/páginas, sin subidas por frame)
+ * - Captura de frames para streaming (lectura por PBO, sin bloquear)
+ * - Multi-draw indirect en drivers GL 4.3+ (un draw call por pasada de
+ *   hasta 16 texturas); sin soporte se usa el path 3.3
  *
  * Ejemplo de uso:
  * ```cpp
  * OpenGLRenderer renderer;
  * renderer.Initialize(800, 600);
  *
- * renderer.LoadTexture("player", "assets/sprites/player.png");
+ * TextureHandle player = renderer.LoadTexture("player", "assets/sprites/player.png");
  *
  * // En game loop:
  * renderer.Clear({0.1f, 0.1f, 0.15f, 1.0f});
- * renderer.DrawSprite("player", {400, 300}, {64, 64}, 0.0f, {1,1,1,1});
+ * renderer.DrawSprite(player, {400, 300}, {64, 64}, 0.0f, {1,1,1,1});
  * renderer.Present();
  * ```
  */
@@ -50,22 +69,131 @@ public:
     void Clear(const glm::vec4& color) override;
     void Present() override;
     void SetViewport(int x, int y, int width, int height) override;
+    void SetView(const glm::mat4& viewProjection, const glm::ivec4& viewport) override;
+    void ResetView() override;
+    void SetResolutionScale(float scale) override;
+    void BeginOverlay() override;
 
     void DrawSprite(
-        const std::string& textureId,
+        TextureHandle texture,
         const glm::vec2& position,
         const glm::vec2& size,
         float rotation,
         const glm::vec4& color
     ) override;
 
-    bool LoadTexture(const std::string& id, const std::string& filepath) override;
-    void UnloadTexture(const std::string& id) override;
+    void DrawSprites(TextureHandle texture, const SpriteDraw* sprites, size_t count) override;
+
+    StaticBatchId CreateStaticBatch() override;
+    bool UpdateStaticBatch(StaticBatchId batch, const StaticSprite* sprites, size_t count) override;
+    void DrawStaticBatch(StaticBatchId batch) override;
+    void DestroyStaticBatch(StaticBatchId batch) override;
+
+    TextureHandle LoadTexture(const std::string& id, const std::string& filepath) override;
+    TextureHandle LoadTextureAsync(const std::string& id, const std::string& filepath,
+                                   TextureLoadCallback onLoaded) override;
+    [[nodiscard]] bool IsTextureResident(TextureHandle texture) const override;
+    bool LoadTextureAtlas(const std::string& manifestPath) override;
+    TextureHandle CreateTexture(const std::string& id, uint32_t width, uint32_t height,
+                                const uint8_t* pixels) override;
+    TextureHandle CreateTextureRegion(const std::string& id, TextureHandle page,
+                                      uint32_t x, uint32_t y, uint32_t width, uint32_t height) override;
+    [[nodiscard]] TextureHandle FindTexture(const std::string& id) const override;
+    void UnloadTexture(TextureHandle texture) override;
 
     [[nodiscard]] std::string GetName() const override;
     [[nodiscard]] RenderStats GetStats() const override;
     void ResetStats() override;
 
+    /**
+     * @brief Activa/desactiva el batching de sprites
+     * @param enabled true = DrawSprite acumula instancias y se dibujan en Present();
+     *                false = un draw call por sprite (modo inmediato, para comparar)
+     */
+    void SetBatchingEnabled(bool enabled);
+
+    /**
+     * @brief Indica si el batching de sprites está activo
+     */
+    [[nodiscard]] bool IsBatchingEnabled() const { return m_BatchingEnabled; }
+
+    /**
+     * @brief Activa/desactiva el envío del batch con multi-draw indirect
+     * @param enabled true = un glMultiDrawArraysIndirect por pasada;
+     *                false = un glDrawArraysInstanced por batch (path 3.3)
+     * @return true si el modo pedido quedó activo (false si el driver no
+     *         soporta GL 4.3 + ARB_shader_draw_parameters)
+     *
+     * Se activa por defecto en Initialize() si hay soporte.
+     */
+    bool SetMultiDrawEnabled(bool enabled);
+
+    /**
+     * @brief Indica si el batch se envía con multi-draw indirect
+     */
+    [[nodiscard]] bool IsMultiDrawEnabled() const;
+
+    /**
+     * @brief Empaqueta en runtime las texturas cargadas en páginas de atlas
+     * @param pageSize Lado de cada página en píxeles
+     * @return true si exitoso
+     *
+     * Copia cada textura suelta a una página compartida y redirige su handle
+     * (los handles existentes siguen siendo válidos). Útil en desarrollo;
+     * en release se prefiere LoadTextureAtlas() con un atlas pre-empaquetado.
+     */
+    bool BuildTextureAtlas(uint32_t pageSize = 2048);
+
+    /**
+     * @brief Bytes de textura que se suben a la GPU por frame
+     * @param bytes Presupuesto (las texturas grandes se reparten entre frames)
+     */
+    void SetTextureUploadBudget(size_t bytes) { m_TextureUploadBudget = bytes; }
+
+    /**
+     * @brief Bloquea hasta que todas las texturas en carga estén residentes
+     *
+     * Solo para pantallas de carga / herramientas: ignora el presupuesto
+     * por frame.
+     */
+    void WaitForTextureLoads();
+
+    /**
+     * @brief Tiempo de GPU por pasada del último frame resuelto
+     *
+     * Pasadas: "scene" (Clear → Present), "upscale" y "overlay" (escalado
+     * del mundo a la ventana e interfaz, solo con escala < 1), "sprites"
+     * (flush final del batch), "capture" (lectura para la captura, si está
+     * activa) y "texture_upload" (subidas del TextureStreamer).
+     */
+    [[nodiscard]] const std::vector<GpuTimer::PassTiming>& GetGpuPassTimings() const {
+        return m_GpuTimer.GetPassTimings();
+    }
+
+    /**
+     * @brief Empieza a capturar los frames presentados
+     * @param sink Destino (archivo, pipe a un encoder...)
+     *
+     * Cada Present lee la ventana a un PBO (pasada "capture") y entrega los
+     * frames que la GPU ya terminó. Llamar desde el hilo que tiene el
+     * contexto o antes de arrancar el hilo de render.
+     */
+    void StartCapture(std::unique_ptr<IFrameSink> sink) { m_FrameCapture.Start(std::move(sink)); }
+
+    /**
+     * @brief Termina la captura (espera a los frames en vuelo)
+     *
+     * Requiere el contexto: Shutdown() la detiene si sigue activa.
+     */
+    void StopCapture() { m_FrameCapture.Stop(); }
+
+    [[nodiscard]] bool IsCapturing() const { return m_FrameCapture.IsActive(); }
+
+    /**
+     * @brief Métricas de captura (frames escritos, descartados y latencia)
+     */
+    [[nodiscard]] FrameCapture::Stats GetCaptureStats() const { return m_FrameCapture.GetStats(); }
+
 private:
     /**
      * @brief Inicializa shaders por defecto
@@ -79,30 +207,244 @@ private:
      */
     bool InitializeBuffers();
 
+    /**
+     * @brief Crea la textura placeholder y arranca el TextureStreamer
+     * @return true si exitoso
+     */
+    bool InitializeTextureStreaming();
+
     /**
      * @brief Crea la geometría de un quad (2 triángulos para sprite)
      */
     void CreateQuadGeometry();
 
+    /**
+     * @brief Entrada de la tabla de texturas (indexada por TextureHandle)
+     */
+    struct TextureEntry {
+        GLuint glHandle{0};     // Textura propia (0 si es región de atlas, en carga o fallida)
+        std::string id;         // Vacío = slot libre
+        uint32_t page{TextureHandle::INVALID_INDEX};  // Entrada de la página de atlas
+        glm::vec4 uvRect{0.0f, 0.0f, 1.0f, 1.0f};     // Región dentro de la página
+        uint32_t width{0};
+        uint32_t height{0};
+        uint32_t loadTicket{0};                       // Carga en curso (0 = ninguna)
+        bool isAtlasPage{false};
+
+        [[nodiscard]] bool IsFree() const { return id.empty(); }
+    };
+
+    /**
+     * @brief Carga en curso y quién espera su resultado
+     */
+    struct PendingLoad {
+        uint32_t index;
+        std::vector<TextureLoadCallback> callbacks;
+    };
+
+    /**
+     * @brief Rango de un batch estático que comparte slots de textura
+     *
+     * Guarda handles y no texturas OpenGL: se resuelven al dibujar, así una
+     * textura que termina de cargar después del horneado se ve sin rehacerlo.
+     */
+    struct StaticRange {
+        uint32_t firstInstance{0};
+        uint32_t instanceCount{0};
+        uint32_t textureCount{0};
+        std::array<TextureHandle, SpriteBatch::MAX_TEXTURE_SLOTS> textures{};
+    };
+
+    /**
+     * @brief Batch estático (ver IRenderer::CreateStaticBatch)
+     */
+    struct StaticBatch {
+        SpriteBatch::StaticGeometry geometry;
+        std::vector<StaticRange> ranges;
+        bool used{false};
+    };
+
+    /**
+     * @brief Handle con el que se enlaza una textura (su página si es región)
+     */
+    [[nodiscard]] TextureHandle GetBindTexture(TextureHandle texture) const {
+        if (texture.index < m_TextureTable.size() &&
+            m_TextureTable[texture.index].page != TextureHandle::INVALID_INDEX) {
+            return TextureHandle{m_TextureTable[texture.index].page};
+        }
+        return texture;
+    }
+
+    /**
+     * @brief Región UV de un handle (la textura entera salvo en regiones)
+     */
+    [[nodiscard]] glm::vec4 GetUVRect(TextureHandle texture) const {
+        if (texture.index < m_TextureTable.size() &&
+            m_TextureTable[texture.index].page != TextureHandle::INVALID_INDEX) {
+            return m_TextureTable[texture.index].uvRect;
+        }
+        return {0.0f, 0.0f, 1.0f, 1.0f};
+    }
+
+    /**
+     * @brief Traduce un handle a textura OpenGL + región UV
+     * @return Textura OpenGL (placeholder si inválido o aún no residente)
+     */
+    [[nodiscard]] GLuint ResolveTexture(TextureHandle texture, glm::vec4& uvRect) const {
+        uvRect = {0.0f, 0.0f, 1.0f, 1.0f};
+        if (texture.index >= m_TextureTable.size()) {
+            return m_PlaceholderTexture;
+        }
+
+        const TextureEntry& entry = m_TextureTable[texture.index];
+        GLuint glHandle = entry.glHandle;
+        if (entry.page != TextureHandle::INVALID_INDEX) {
+            uvRect = entry.uvRect;
+            glHandle = m_TextureTable[entry.page].glHandle;
+        }
+
+        return glHandle != 0 ? glHandle : m_PlaceholderTexture;
+    }
+
+    /**
+     * @brief Inserta una entrada en la tabla (reutilizando huecos)
+     * @return Handle de la nueva entrada
+     */
+    TextureHandle AddTextureEntry(TextureEntry entry);
+
+    /**
+     * @brief Libera un slot de la tabla
+     */
+    void ReleaseTextureEntry(uint32_t index);
+
+    /**
+     * @brief Vacía los batches estáticos que enlazan una textura
+     * @param index Slot de la textura (o página) que se descarga
+     */
+    void ClearStaticBatchesUsing(uint32_t index);
+
+    /**
+     * @brief Dibuja un sprite con su propio draw call (modo inmediato)
+     */
+    void DrawSpriteImmediate(GLuint textureHandle, const glm::vec4& uvRect,
+                             const glm::vec2& position, const glm::vec2& size,
+                             float rotation, const glm::vec4& color);
+
+    /**
+     * @brief Dibuja los sprites acumulados en el batch
+     */
+    void FlushSpriteBatch();
+
+    /**
+     * @brief Vuelve a la vista de pantalla si había una cámara activa
+     */
+    void RestoreScreenView();
+
+    /**
+     * @brief Aplica un viewport en píxeles de la ventana (y desde arriba)
+     *
+     * Dentro de la pasada reducida se escala con ella.
+     */
+    void ApplyViewport(int x, int y, int width, int height);
+
+    /**
+     * @brief Cierra la pasada del mundo reducida y la escala a la ventana
+     *
+     * No hace nada si el frame se dibuja a resolución nativa.
+     */
+    void ResolveScenePass();
+
+    /**
+     * @brief Sube FrameUniforms al UBO si cambiaron (una vez por frame)
+     */
+    void UploadFrameUniforms();
+
+    /**
+     * @brief Avanza las cargas de texturas y notifica las terminadas
+     * @param byteBudget Bytes máximos a subir a la GPU
+     */
+    void ProcessTextureLoads(size_t byteBudget);
+
     // Dimensiones del framebuffer
     int m_Width{0};
     int m_Height{0};
 
-    // Shader program para sprites
+    // Cache de program binaries (evita recompilar GLSL en cada arranque)
+    std::unique_ptr<ShaderCache> m_ShaderCache;
+
+    // Shader program para sprites (modo inmediato)
     std::unique_ptr<ShaderProgram> m_SpriteShader;
 
+    // Handles de uniforms del shader inmediato (resueltos al linkar)
+    struct SpriteUniforms {
+        Uniform<glm::mat4> model;
+        Uniform<glm::vec4> color;
+        Uniform<glm::vec4> uvRect;
+    } m_SpriteUniforms;
+
+    // Datos por frame compartidos por todos los shaders (UBO)
+    std::unique_ptr<UniformBuffer> m_FrameUniformBuffer;
+    FrameUniforms m_FrameUniforms;
+    bool m_FrameUniformsDirty{true};
+    std::chrono::steady_clock::time_point m_StartTime;
+    std::chrono::steady_clock::time_point m_LastPresentTime;
+
     // VAO y VBO para quad de sprite
     GLuint m_QuadVAO{0};
     GLuint m_QuadVBO{0};
 
-    // Texturas cargadas (ID → OpenGL texture handle)
-    std::unordered_map<std::string, GLuint> m_Textures;
+    // Batch de sprites instanciados
+    std::unique_ptr<SpriteBatch> m_SpriteBatch;
+    bool m_BatchingEnabled{true};
 
-    // Estadísticas de renderizado
-    RenderStats m_Stats;
+    // Batches estáticos (StaticBatchId → entrada; huecos reutilizables)
+    std::vector<StaticBatch> m_StaticBatches;
+    std::vector<StaticBatchId> m_FreeStaticBatches;
+    std::vector<SpriteInstance> m_StaticScratch;
+    std::vector<uint32_t> m_StaticOrder;
+
+    // Tabla densa de texturas (TextureHandle::index → entrada)
+    std::vector<TextureEntry> m_TextureTable;
+
+    // Slots de la tabla liberados por UnloadTexture (se reutilizan)
+    std::vector<uint32_t> m_FreeTextureSlots;
+
+    // ID string → handle (solo se consulta al cargar, nunca al dibujar)
+    std::unordered_map<std::string, TextureHandle> m_TextureIds;
+
+    // Carga asíncrona de texturas
+    std::unique_ptr<TextureStreamer> m_TextureStreamer;
+    std::unordered_map<uint32_t, PendingLoad> m_PendingLoads;  // ticket → carga
+    uint32_t m_NextLoadTicket{1};
+    size_t m_TextureUploadBudget;
+
+    // Textura blanca 1x1 que se dibuja mientras la real no está residente
+    GLuint m_PlaceholderTexture{0};
 
-    // Projection matrix (ortográfica 2D)
-    glm::mat4 m_ProjectionMatrix;
+    // Bytes de todas las texturas propias residentes (RGBA8)
+    uint64_t m_TextureMemory{0};
+
+    // Resolución dinámica: framebuffer del mundo (tamaño de ventana, se
+    // usa la esquina de la escala del frame)
+    RenderTarget m_SceneTarget;
+    float m_PendingResolutionScale{1.0f};   // Se aplica en Clear
+    float m_ResolutionScale{1.0f};
+    bool m_ScenePassActive{false};
+
+    // Vista de cámara activa (SetView): al volver se restaura la de pantalla
+    bool m_ViewActive{false};
+
+    // Captura de frames (streaming)
+    FrameCapture m_FrameCapture;
+
+    // Medición de tiempos
+    GpuTimer m_GpuTimer;
+    std::chrono::steady_clock::time_point m_FrameSubmitStart;
+    bool m_FrameSubmitStarted{false};
+
+    // Estadísticas de renderizado (frame en curso / último frame presentado)
+    RenderStats m_Stats;
+    RenderStats m_LastFrameStats;
 };
 
 } // namespace MultiNinjaEspacial::Infrastructure::Rendering
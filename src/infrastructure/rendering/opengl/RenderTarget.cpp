@@ -0,0 +1,75 @@
+// ============================================================================
+// Render Target - Implementación
+// ============================================================================
+
+#include "RenderTarget.hpp"
+#include <spdlog/spdlog.h>
+
+namespace MultiNinjaEspacial::Infrastructure::Rendering {
+
+RenderTarget::~RenderTarget() {
+    Shutdown();
+}
+
+bool RenderTarget::Resize(uint32_t width, uint32_t height) {
+    if (IsValid() && width == m_Width && height == m_Height) {
+        return true;
+    }
+
+    Shutdown();
+    if (width == 0 || height == 0) {
+        return false;
+    }
+
+    // Filtrado lineal: el escalado a la ventana es un bilineal de un tap
+    glGenTextures(1, &m_Texture);
+    glBindTexture(GL_TEXTURE_2D, m_Texture);
+    glTexImage2D(GL_TEXTURE_2D, 0, GL_RGBA8,
+                 static_cast<GLsizei>(width), static_cast<GLsizei>(height),
+                 0, GL_RGBA, GL_UNSIGNED_BYTE, nullptr);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);
+
+    glGenFramebuffers(1, &m_Framebuffer);
+    glBindFramebuffer(GL_FRAMEBUFFER, m_Framebuffer);
+    glFramebufferTexture2D(GL_FRAMEBUFFER, GL_COLOR_ATTACHMENT0, GL_TEXTURE_2D, m_Texture, 0);
+
+    const GLenum status = glCheckFramebufferStatus(GL_FRAMEBUFFER);
+    glBindFramebuffer(GL_FRAMEBUFFER, 0);
+
+    if (status != GL_FRAMEBUFFER_COMPLETE) {
+        spdlog::error("RenderTarget: framebuffer incompleto (0x{:x})", status);
+        Shutdown();
+        return false;
+    }
+
+    m_Width = width;
+    m_Height = height;
+    spdlog::debug("RenderTarget creado ({}x{})", width, height);
+    return true;
+}
+
+void RenderTarget::Shutdown() {
+    if (m_Framebuffer != 0) {
+        glDeleteFramebuffers(1, &m_Framebuffer);
+        m_Framebuffer = 0;
+    }
+    if (m_Texture != 0) {
+        glDeleteTextures(1, &m_Texture);
+        m_Texture = 0;
+    }
+    m_Width = 0;
+    m_Height = 0;
+}
+
+void RenderTarget::Bind() const {
+    glBindFramebuffer(GL_FRAMEBUFFER, m_Framebuffer);
+}
+
+void RenderTarget::BindDefault() {
+    glBindFramebuffer(GL_FRAMEBUFFER, 0);
+}
+
+} // namespace MultiNinjaEspacial::Infrastructure::Rendering
@@ -0,0 +1,84 @@
+// ============================================================================
+// Render Target - Framebuffer offscreen con una textura de color
+// ============================================================================
+// Destino de la pasada del mundo cuando se renderiza a resolución reducida
+// (ver OpenGLRenderer::SetResolutionScale)
+// ============================================================================
+
+#pragma once
+
+#include <GL/glew.h>
+#include <cstdint>
+
+namespace MultiNinjaEspacial::Infrastructure::Rendering {
+
+/**
+ * @brief FBO + textura RGBA8 con filtrado lineal
+ *
+ * Se reserva al tamaño máximo (la ventana) y se dibuja solo en la esquina
+ * inferior izquierda que corresponda a la escala del frame: cambiar de
+ * escala no reasigna memoria.
+ *
+ * Ejemplo de uso:
+ * ```cpp
+ * RenderTarget target;
+ * target.Resize(1920, 1080);
+ *
+ * target.Bind();
+ * glViewport(0, 0, 1440, 810);   // Escala 0.75
+ * // ... draws ...
+ * RenderTarget::BindDefault();
+ * // ... muestrear target.GetTexture() con UVs {0, 0.75, 0.75, 0} ...
+ * ```
+ */
+class RenderTarget {
+public:
+    RenderTarget() = default;
+    ~RenderTarget();
+
+    RenderTarget(const RenderTarget&) = delete;
+    RenderTarget& operator=(const RenderTarget&) = delete;
+
+    /**
+     * @brief Crea (o recrea) el framebuffer con un tamaño
+     * @param width Ancho en píxeles
+     * @param height Alto en píxeles
+     * @return true si el framebuffer está completo
+     *
+     * No hace nada si el tamaño no cambia.
+     */
+    bool Resize(uint32_t width, uint32_t height);
+
+    /**
+     * @brief Libera el framebuffer y su textura
+     */
+    void Shutdown();
+
+    /**
+     * @brief Dibuja en este framebuffer
+     */
+    void Bind() const;
+
+    /**
+     * @brief Vuelve a dibujar en el framebuffer de la ventana
+     */
+    static void BindDefault();
+
+    [[nodiscard]] GLuint GetTexture() const { return m_Texture; }
+    [[nodiscard]] uint32_t GetWidth() const { return m_Width; }
+    [[nodiscard]] uint32_t GetHeight() const { return m_Height; }
+    [[nodiscard]] bool IsValid() const { return m_Framebuffer != 0; }
+
+    /**
+     * @brief Memoria de la textura de color (RGBA8)
+     */
+    [[nodiscard]] uint64_t GetMemoryBytes() const { return uint64_t{m_Width} * m_Height * 4; }
+
+private:
+    GLuint m_Framebuffer{0};
+    GLuint m_Texture{0};
+    uint32_t m_Width{0};
+    uint32_t m_Height{0};
+};
+
+} // namespace MultiNinjaEspacial::Infrastructure::Rendering
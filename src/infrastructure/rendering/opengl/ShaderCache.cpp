@@ -0,0 +1,215 @@
+// ============================================================================
+// Shader Cache - Implementación
+// ============================================================================
+
+#include "ShaderCache.hpp"
+#include <spdlog/spdlog.h>
+#include <algorithm>
+#include <chrono>
+#include <cstring>
+#include <fstream>
+#include <vector>
+
+namespace MultiNinjaEspacial::Infrastructure::Rendering {
+
+namespace {
+
+constexpr uint32_t CACHE_MAGIC = 0x4353454Eu;  // "NESC"
+constexpr uint32_t CACHE_VERSION = 1;
+
+/**
+ * @brief Cabecera de cada archivo de la cache
+ */
+struct EntryHeader {
+    uint32_t magic;
+    uint32_t version;
+    uint64_t driverHash;
+    uint32_t binaryFormat;
+    uint32_t binaryLength;
+    double compileMs;       // Para calcular el tiempo ahorrado en cada hit
+};
+
+// FNV-1a 64 bits
+constexpr uint64_t FNV_OFFSET = 14695981039346656037ull;
+constexpr uint64_t FNV_PRIME = 1099511628211ull;
+
+uint64_t HashBytes(uint64_t hash, const void* data, size_t size) {
+    const auto* bytes = static_cast<const uint8_t*>(data);
+    for (size_t i = 0; i < size; ++i) {
+        hash ^= bytes[i];
+        hash *= FNV_PRIME;
+    }
+    return hash;
+}
+
+uint64_t HashString(uint64_t hash, const char* text) {
+    // El terminador separa campos ("ab"+"c" != "a"+"bc")
+    return HashBytes(hash, text, std::strlen(text) + 1);
+}
+
+const char* GetGLString(GLenum name) {
+    const GLubyte* value = glGetString(name);
+    return value != nullptr ? reinterpret_cast<const char*>(value) : "";
+}
+
+} // namespace
+
+ShaderCache::ShaderCache(std::filesystem::path directory)
+    : m_Directory(std::move(directory)) {
+}
+
+bool ShaderCache::Initialize() {
+    GLint formatCount = 0;
+    if (GLEW_ARB_get_program_binary) {
+        glGetIntegerv(GL_NUM_PROGRAM_BINARY_FORMATS, &formatCount);
+    }
+
+    if (formatCount <= 0) {
+        spdlog::info("Shader cache desactivada: el driver no soporta program binaries");
+        return false;
+    }
+
+    std::error_code error;
+    std::filesystem::create_directories(m_Directory, error);
+    if (error) {
+        spdlog::warn("Shader cache desactivada: no se pudo crear {} ({})",
+                     m_Directory.string(), error.message());
+        return false;
+    }
+
+    // Binarios de otro driver/GPU no sirven: la identidad entra en la clave
+    m_DriverHash = FNV_OFFSET;
+    m_DriverHash = HashString(m_DriverHash, GetGLString(GL_VENDOR));
+    m_DriverHash = HashString(m_DriverHash, GetGLString(GL_RENDERER));
+    m_DriverHash = HashString(m_DriverHash, GetGLString(GL_VERSION));
+
+    m_Enabled = true;
+    spdlog::debug("Shader cache activa en {}", m_Directory.string());
+    return true;
+}
+
+uint64_t ShaderCache::MakeKey(const char* vertexSrc, const char* fragmentSrc) const {
+    uint64_t hash = HashBytes(FNV_OFFSET, &m_DriverHash, sizeof(m_DriverHash));
+    hash = HashString(hash, vertexSrc);
+    hash = HashString(hash, fragmentSrc);
+    return hash;
+}
+
+GLuint ShaderCache::Load(uint64_t key) {
+    if (!m_Enabled) {
+        m_Stats.misses++;
+        return 0;
+    }
+
+    const auto start = std::chrono::steady_clock::now();
+    const std::filesystem::path path = GetEntryPath(key);
+
+    std::ifstream file(path, std::ios::binary);
+    if (!file.is_open()) {
+        m_Stats.misses++;
+        return 0;
+    }
+
+    EntryHeader header{};
+    file.read(reinterpret_cast<char*>(&header), sizeof(header));
+
+    // La longitud viene del archivo: tiene que coincidir con lo que queda
+    // tras la cabecera antes de reservar nada (una entrada corrupta podría
+    // pedir hasta 4 GB)
+    std::error_code sizeError;
+    const uintmax_t fileSize = std::filesystem::file_size(path, sizeError);
+
+    std::vector<char> binary;
+    bool valid = file.good() &&
+                 header.magic == CACHE_MAGIC &&
+                 header.version == CACHE_VERSION &&
+                 header.driverHash == m_DriverHash &&
+                 !sizeError &&
+                 header.binaryLength > 0 &&
+                 fileSize - sizeof(header) == header.binaryLength;
+    if (valid) {
+        binary.resize(header.binaryLength);
+        file.read(binary.data(), static_cast<std::streamsize>(binary.size()));
+        valid = file.good();
+    }
+    file.close();
+
+    GLuint program = 0;
+    if (valid) {
+        program = glCreateProgram();
+        glProgramBinary(program, header.binaryFormat, binary.data(),
+                        static_cast<GLsizei>(binary.size()));
+
+        GLint linked = GL_FALSE;
+        glGetProgramiv(program, GL_LINK_STATUS, &linked);
+        if (!linked) {
+            glDeleteProgram(program);
+            program = 0;
+        }
+    }
+
+    if (program == 0) {
+        // Entrada corrupta o rechazada (p.ej. tras actualizar el driver)
+        spdlog::debug("Shader cache: binario rechazado ({})", path.filename().string());
+        std::error_code error;
+        std::filesystem::remove(path, error);
+        m_Stats.rejected++;
+        m_Stats.misses++;
+        return 0;
+    }
+
+    const double loadMs = std::chrono::duration<double, std::milli>(
+        std::chrono::steady_clock::now() - start).count();
+    m_Stats.hits++;
+    m_Stats.savedMs += std::max(0.0, header.compileMs - loadMs);
+    return program;
+}
+
+void ShaderCache::Store(uint64_t key, GLuint program, double compileMs) {
+    if (!m_Enabled) {
+        return;
+    }
+
+    GLint length = 0;
+    glGetProgramiv(program, GL_PROGRAM_BINARY_LENGTH, &length);
+    if (length <= 0) {
+        return;
+    }
+
+    std::vector<char> binary(static_cast<size_t>(length));
+    GLenum format = 0;
+    glGetProgramBinary(program, length, nullptr, &format, binary.data());
+
+    EntryHeader header{};
+    header.magic = CACHE_MAGIC;
+    header.version = CACHE_VERSION;
+    header.driverHash = m_DriverHash;
+    header.binaryFormat = format;
+    header.binaryLength = static_cast<uint32_t>(length);
+    header.compileMs = compileMs;
+
+    const std::filesystem::path path = GetEntryPath(key);
+    std::ofstream file(path, std::ios::binary | std::ios::trunc);
+    if (!file.is_open()) {
+        spdlog::warn("Shader cache: no se pudo escribir {}", path.string());
+        return;
+    }
+
+    file.write(reinterpret_cast<const char*>(&header), sizeof(header));
+    file.write(binary.data(), static_cast<std::streamsize>(binary.size()));
+}
+
+void ShaderCache::LogSummary() const {
+    if (!m_Enabled) {
+        return;
+    }
+
+    spdlog::info("Shader cache: {} hits, {} misses ({} rechazados), {:.1f} ms ahorrados",
+                 m_Stats.hits, m_Stats.misses, m_Stats.rejected, m_Stats.savedMs);
+}
+
+std::filesystem::path ShaderCache::GetEntryPath(uint64_t key) const {
+    return m_Directory / fmt::format("{:016x}.bin", key);
+}
+
+} // namespace MultiNinjaEspacial::Infrastructure::Rendering
@@ -0,0 +1,103 @@
+// ============================================================================
+// Shader Cache - Cache en disco de program binaries
+// ============================================================================
+// Guarda el resultado de glGetProgramBinary para no recompilar GLSL en
+// cada arranque (GL 4.1 / ARB_get_program_binary)
+// ============================================================================
+
+#pragma once
+
+#include <GL/glew.h>
+#include <cstdint>
+#include <filesystem>
+#include <string>
+
+namespace MultiNinjaEspacial::Infrastructure::Rendering {
+
+/**
+ * @brief Cache de programas enlazados, indexada por hash de fuentes + driver
+ *
+ * La clave combina el código de los shaders con vendor/renderer/versión de
+ * OpenGL: al cambiar el driver o la GPU las entradas viejas simplemente no
+ * se encuentran. Si el driver rechaza un binario (glProgramBinary falla),
+ * se borra y el llamador compila desde fuente.
+ *
+ * Ejemplo de uso:
+ * ```cpp
+ * ShaderCache cache("cache/shaders");
+ * cache.Initialize();
+ *
+ * ShaderProgram shader;
+ * shader.CompileFromSource(vertexSrc, fragmentSrc, &cache);
+ *
+ * cache.LogSummary();  // hits/misses y tiempo ahorrado
+ * ```
+ */
+class ShaderCache {
+public:
+    /**
+     * @brief Contadores de la sesión
+     */
+    struct Stats {
+        uint32_t hits{0};
+        uint32_t misses{0};
+        uint32_t rejected{0};       // Binarios que el driver no aceptó
+        double savedMs{0.0};        // Compilación evitada - tiempo de carga
+    };
+
+    static constexpr const char* DEFAULT_DIRECTORY = "cache/shaders";
+
+    explicit ShaderCache(std::filesystem::path directory = DEFAULT_DIRECTORY);
+
+    /**
+     * @brief Comprueba soporte del driver y prepara el directorio
+     * @return true si la cache está activa (si no, todo son misses)
+     *
+     * Requiere contexto OpenGL activo.
+     */
+    bool Initialize();
+
+    /**
+     * @brief Calcula la clave de un programa
+     * @param vertexSrc Código del vertex shader
+     * @param fragmentSrc Código del fragment shader
+     */
+    [[nodiscard]] uint64_t MakeKey(const char* vertexSrc, const char* fragmentSrc) const;
+
+    /**
+     * @brief Intenta crear un programa desde la cache
+     * @param key Clave de MakeKey()
+     * @return Program enlazado, o 0 si no está (o el driver lo rechaza)
+     */
+    GLuint Load(uint64_t key);
+
+    /**
+     * @brief Guarda el binario de un programa recién enlazado
+     * @param key Clave de MakeKey()
+     * @param program Program enlazado con GL_PROGRAM_BINARY_RETRIEVABLE_HINT
+     * @param compileMs Tiempo que costó compilar + enlazar
+     */
+    void Store(uint64_t key, GLuint program, double compileMs);
+
+    /**
+     * @brief Indica si el driver soporta program binaries
+     */
+    [[nodiscard]] bool IsEnabled() const { return m_Enabled; }
+
+    [[nodiscard]] const Stats& GetStats() const { return m_Stats; }
+
+    /**
+     * @brief Escribe en el log hits/misses y tiempo ahorrado
+     */
+    void LogSummary() const;
+
+private:
+    [[nodiscard]] std::filesystem::path GetEntryPath(uint64_t key) const;
+
+    std::filesystem::path m_Directory;
+    uint64_t m_DriverHash{0};
+    bool m_Enabled{false};
+    Stats m_Stats;
+};
+
+} // namespace MultiNinjaEspacial::Infrastructure::Rendering
@@ -3,13 +3,35 @@
 // ============================================================================
 
 #include "ShaderProgram.hpp"
+#include "ShaderCache.hpp"
 #include <spdlog/spdlog.h>
 #include <glm/gtc/type_ptr.hpp>
+#include <algorithm>
+#include <chrono>
 #include <fstream>
-#include <sstream>
 
 namespace MultiNinjaEspacial::Infrastructure::Rendering {
 
+namespace {
+
+/**
+ * @brief Lee un archivo completo con una sola lectura
+ * @return false si no se pudo abrir
+ */
+bool ReadFile(const std::string& path, std::string& out) {
+    std::ifstream file(path, std::ios::binary | std::ios::ate);
+    if (!file.is_open()) {
+        return false;
+    }
+
+    out.resize(static_cast<size_t>(file.tellg()));
+    file.seekg(0);
+    file.read(out.data(), static_cast<std::streamsize>(out.size()));
+    return file.good();
+}
+
+} // namespace
+
 ShaderProgram::ShaderProgram() = default;
 
 ShaderProgram::~ShaderProgram() {
@@ -18,7 +40,22 @@ ShaderProgram::~ShaderProgram() {
     }
 }
 
-bool ShaderProgram::CompileFromSource(const char* vertexSrc, const char* fragmentSrc) {
+bool ShaderProgram::CompileFromSource(const char* vertexSrc, const char* fragmentSrc,
+                                      ShaderCache* cache) {
+    // Intentar primero con el binario cacheado
+    uint64_t cacheKey = 0;
+    if (cache != nullptr) {
+        cacheKey = cache->MakeKey(vertexSrc, fragmentSrc);
+        m_ProgramID = cache->Load(cacheKey);
+        if (m_ProgramID != 0) {
+            ReflectUniforms();
+            spdlog::debug("Shader program cargado desde cache (ID: {})", m_ProgramID);
+            return true;
+        }
+    }
+
+    const auto start = std::chrono::steady_clock::now();
+
     // Compilar vertex shader
     GLuint vertexShader = CompileShader(GL_VERTEX_SHADER, vertexSrc);
     if (vertexShader == 0) {
@@ -36,6 +73,9 @@ bool ShaderProgram::CompileFromSource(const char* vertexSrc, const char* fragmen
     m_ProgramID = glCreateProgram();
     glAttachShader(m_ProgramID, vertexShader);
     glAttachShader(m_ProgramID, fragmentShader);
+    if (cache != nullptr && cache->IsEnabled()) {
+        glProgramParameteri(m_ProgramID, GL_PROGRAM_BINARY_RETRIEVABLE_HINT, GL_TRUE);
+    }
     glLinkProgram(m_ProgramID);
 
     // Verificar linkeo
@@ -57,38 +97,76 @@ bool ShaderProgram::CompileFromSource(const char* vertexSrc, const char* fragmen
     glDeleteShader(vertexShader);
     glDeleteShader(fragmentShader);
 
+    ReflectUniforms();
+
+    if (cache != nullptr) {
+        const double compileMs = std::chrono::duration<double, std::milli>(
+            std::chrono::steady_clock::now() - start).count();
+        cache->Store(cacheKey, m_ProgramID, compileMs);
+    }
+
     spdlog::info("Shader program compilado y linkeado (ID: {})", m_ProgramID);
     return true;
 }
 
-bool ShaderProgram::CompileFromFiles(const std::string& vertexPath, const std::string& fragmentPath) {
+bool ShaderProgram::CompileFromFiles(const std::string& vertexPath, const std::string& fragmentPath,
+                                     ShaderCache* cache) {
     // Leer vertex shader
-    std::ifstream vFile(vertexPath);
-    if (!vFile.is_open()) {
+    std::string vSrc;
+    if (!ReadFile(vertexPath, vSrc)) {
         spdlog::error("No se pudo abrir vertex shader: {}", vertexPath);
         return false;
     }
-    std::stringstream vStream;
-    vStream << vFile.rdbuf();
-    std::string vSrc = vStream.str();
 
     // Leer fragment shader
-    std::ifstream fFile(fragmentPath);
-    if (!fFile.is_open()) {
+    std::string fSrc;
+    if (!ReadFile(fragmentPath, fSrc)) {
         spdlog::error("No se pudo abrir fragment shader: {}", fragmentPath);
         return false;
     }
-    std::stringstream fStream;
-    fStream << fFile.rdbuf();
-    std::string fSrc = fStream.str();
 
-    return CompileFromSource(vSrc.c_str(), fSrc.c_str());
+    return CompileFromSource(vSrc.c_str(), fSrc.c_str(), cache);
 }
 
 void ShaderProgram::Use() const {
     glUseProgram(m_ProgramID);
 }
 
+void ShaderProgram::Set(Uniform<int> uniform, int value) {
+    glUniform1i(uniform.location, value);
+}
+
+void ShaderProgram::Set(Uniform<float> uniform, float value) {
+    glUniform1f(uniform.location, value);
+}
+
+void ShaderProgram::Set(Uniform<glm::vec2> uniform, const glm::vec2& value) {
+    glUniform2f(uniform.location, value.x, value.y);
+}
+
+void ShaderProgram::Set(Uniform<glm::vec3> uniform, const glm::vec3& value) {
+    glUniform3f(uniform.location, value.x, value.y, value.z);
+}
+
+void ShaderProgram::Set(Uniform<glm::vec4> uniform, const glm::vec4& value) {
+    glUniform4f(uniform.location, value.x, value.y, value.z, value.w);
+}
+
+void ShaderProgram::Set(Uniform<glm::mat4> uniform, const glm::mat4& value) {
+    glUniformMatrix4fv(uniform.location, 1, GL_FALSE, glm::value_ptr(value));
+}
+
+bool ShaderProgram::BindUniformBlock(const char* blockName, GLuint bindingPoint) {
+    const GLuint index = glGetUniformBlockIndex(m_ProgramID, blockName);
+    if (index == GL_INVALID_INDEX) {
+        spdlog::warn("Uniform block '{}' no encontrado en shader", blockName);
+        return false;
+    }
+
+    glUniformBlockBinding(m_ProgramID, index, bindingPoint);
+    return true;
+}
+
 void ShaderProgram::SetInteger(const std::string& name, int value) {
     glUniform1i(GetUniformLocation(name), value);
 }
@@ -131,6 +209,53 @@ GLint ShaderProgram::GetUniformLocation(const std::string& name) {
     return location;
 }
 
+GLint ShaderProgram::FindUniformLocation(const std::string& name) const {
+    auto it = m_UniformLocationCache.find(name);
+    if (it == m_UniformLocationCache.end()) {
+        spdlog::warn("Uniform '{}' no encontrado en shader", name);
+        return -1;
+    }
+    return it->second;
+}
+
+void ShaderProgram::ReflectUniforms() {
+    m_UniformLocationCache.clear();
+
+    GLint count = 0;
+    GLint maxNameLength = 0;
+    glGetProgramiv(m_ProgramID, GL_ACTIVE_UNIFORMS, &count);
+    glGetProgramiv(m_ProgramID, GL_ACTIVE_UNIFORM_MAX_LENGTH, &maxNameLength);
+
+    std::string name(static_cast<size_t>(std::max(maxNameLength, 1)), '\0');
+    for (GLint i = 0; i < count; ++i) {
+        GLsizei length = 0;
+        GLint size = 0;
+        GLenum type = 0;
+        glGetActiveUniform(m_ProgramID, static_cast<GLuint>(i), maxNameLength,
+                           &length, &size, &type, name.data());
+        std::string uniformName(name.data(), static_cast<size_t>(length));
+
+        // Los uniforms de bloques (UBO) no tienen location
+        const GLint location = glGetUniformLocation(m_ProgramID, uniformName.c_str());
+        if (location == -1) {
+            continue;
+        }
+
+        // Arrays: OpenGL devuelve "uTextures[0]"; registrar cada elemento
+        if (size > 1 && uniformName.ends_with("[0]")) {
+            const std::string base = uniformName.substr(0, uniformName.size() - 3);
+            for (GLint element = 0; element < size; ++element) {
+                const std::string elementName = base + "[" + std::to_string(element) + "]";
+                m_UniformLocationCache[elementName] =
+                    glGetUniformLocation(m_ProgramID, elementName.c_str());
+            }
+            m_UniformLocationCache[base] = location;
+        } else {
+            m_UniformLocationCache[uniformName] = location;
+        }
+    }
+}
+
 GLuint ShaderProgram::CompileShader(GLenum type, const char* source) {
     GLuint shader = glCreateShader(type);
     glShaderSource(shader, 1, &source, nullptr);
@@ -13,22 +13,43 @@
 
 namespace MultiNinjaEspacial::Infrastructure::Rendering {
 
+class ShaderCache;
+
+/**
+ * @brief Handle tipado de un uniform (location resuelta al linkar)
+ *
+ * El tipo evita mezclar setters: Set(Uniform<glm::vec4>, ...) solo acepta
+ * un vec4. Se obtiene una vez con ShaderProgram::GetUniform<T>() y se
+ * guarda; en el path de dibujo no hay búsquedas por nombre.
+ */
+template <typename T>
+struct Uniform {
+    GLint location{-1};
+
+    [[nodiscard]] bool IsValid() const { return location != -1; }
+};
+
 /**
  * @brief Wrapper sobre OpenGL shader program
  *
  * Facilita:
  * - Compilación de shaders
- * - Linkeo de program
- * - Seteo de uniforms con cache
+ * - Linkeo de program (o carga del binario desde ShaderCache)
+ * - Seteo de uniforms con handles resueltos al linkar
+ * - Uniform blocks (datos por frame compartidos en un UBO)
  *
  * Ejemplo de uso:
  * ```cpp
  * ShaderProgram shader;
  * shader.CompileFromSource(vertexSrc, fragmentSrc);
  *
+ * // Al inicializar
+ * auto uColor = shader.GetUniform<glm::vec4>("uColor");
+ * shader.BindUniformBlock(FRAME_UNIFORMS_BLOCK, FRAME_UNIFORMS_BINDING);
+ *
+ * // Por draw
  * shader.Use();
- * shader.SetMatrix4("uProjection", projMatrix);
- * shader.SetVector4f("uColor", {1, 0, 0, 1});
+ * shader.Set(uColor, {1, 0, 0, 1});
  * ```
  */
 class ShaderProgram {
@@ -40,17 +61,21 @@ public:
      * @brief Compila shaders desde source code
      * @param vertexSrc Código del vertex shader
      * @param fragmentSrc Código del fragment shader
+     * @param cache Cache de binarios (opcional): si tiene el programa no se compila
      * @return true si compilación exitosa
      */
-    bool CompileFromSource(const char* vertexSrc, const char* fragmentSrc);
+    bool CompileFromSource(const char* vertexSrc, const char* fragmentSrc,
+                           ShaderCache* cache = nullptr);
 
     /**
      * @brief Compila shaders desde archivos
      * @param vertexPath Path al vertex shader
      * @param fragmentPath Path al fragment shader
+     * @param cache Cache de binarios (opcional)
      * @return true si compilación exitosa
      */
-    bool CompileFromFiles(const std::string& vertexPath, const std::string& fragmentPath);
+    bool CompileFromFiles(const std::string& vertexPath, const std::string& fragmentPath,
+                          ShaderCache* cache = nullptr);
 
     /**
      * @brief Activa este shader program
@@ -64,7 +89,36 @@ public:
     [[nodiscard]] GLuint GetID() const { return m_ProgramID; }
 
     // ━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━
-    // Setters de Uniforms
+    // Uniforms por handle (path de dibujo)
+    // ━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━
+
+    /**
+     * @brief Resuelve el handle de un uniform (llamar al inicializar)
+     * @param name Nombre del uniform (arrays: "uTextures[3]")
+     * @return Handle (inválido si el uniform no existe o no está activo)
+     */
+    template <typename T>
+    [[nodiscard]] Uniform<T> GetUniform(const std::string& name) const {
+        return Uniform<T>{FindUniformLocation(name)};
+    }
+
+    void Set(Uniform<int> uniform, int value);
+    void Set(Uniform<float> uniform, float value);
+    void Set(Uniform<glm::vec2> uniform, const glm::vec2& value);
+    void Set(Uniform<glm::vec3> uniform, const glm::vec3& value);
+    void Set(Uniform<glm::vec4> uniform, const glm::vec4& value);
+    void Set(Uniform<glm::mat4> uniform, const glm::mat4& value);
+
+    /**
+     * @brief Asocia un uniform block a un binding point de UBO
+     * @param blockName Nombre del bloque en GLSL
+     * @param bindingPoint Binding point del UniformBuffer
+     * @return false si el bloque no existe en el programa
+     */
+    bool BindUniformBlock(const char* blockName, GLuint bindingPoint);
+
+    // ━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━
+    // Setters de Uniforms por nombre (inicialización / herramientas)
     // ━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━
 
     void SetInteger(const std::string& name, int value);
@@ -82,6 +136,20 @@ private:
      */
     GLint GetUniformLocation(const std::string& name);
 
+    /**
+     * @brief Busca un uniform en la tabla rellenada al linkar
+     * @return Location (-1 si no existe)
+     */
+    [[nodiscard]] GLint FindUniformLocation(const std::string& name) const;
+
+    /**
+     * @brief Rellena la cache con todos los uniforms activos del programa
+     *
+     * Se llama tras linkar (o cargar el binario), así que después no hace
+     * falta preguntar a OpenGL por locations.
+     */
+    void ReflectUniforms();
+
     /**
      * @brief Compila un shader individual
      * @param type GL_VERTEX_SHADER o GL_FRAGMENT_SHADER
@@ -101,7 +169,7 @@ private:
     // OpenGL program handle
     GLuint m_ProgramID{0};
 
-    // Cache de uniform locations
+    // Cache de uniform locations (completa tras ReflectUniforms)
     std::unordered_map<std::string, GLint> m_UniformLocationCache;
 };
 
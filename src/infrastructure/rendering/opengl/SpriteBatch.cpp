@@ -0,0 +1,609 @@
+// ============================================================================
+// Sprite Batch - Implementación
+// ============================================================================
+
+#include "SpriteBatch.hpp"
+#include "UniformBuffer.hpp"
+#include <spdlog/spdlog.h>
+#include <algorithm>
+#include <cstddef>
+#include <cstring>
+#include <string>
+
+namespace MultiNinjaEspacial::Infrastructure::Rendering {
+
+namespace {
+
+// Vertex shader instanciado: la transformación se calcula en GPU
+const char* BATCH_VERTEX_SRC = R"(
+    #version 330 core
+    layout (location = 0) in vec2 aPosition;
+    layout (location = 1) in vec2 aTexCoord;
+
+    // Atributos por instancia (divisor = 1)
+    layout (location = 2) in vec2 iPosition;
+    layout (location = 3) in vec2 iSize;
+    layout (location = 4) in vec4 iColor;
+    layout (location = 5) in vec4 iUVRect;
+    layout (location = 6) in float iRotation;
+    layout (location = 7) in uint iTextureSlot;
+
+    out vec2 vTexCoord;
+    out vec4 vColor;
+    flat out uint vTextureSlot;
+
+    // Datos por frame (UBO compartido, ver FrameUniforms)
+    layout (std140) uniform FrameData {
+        mat4 uProjection;
+        vec4 uTime;
+    };
+
+    void main() {
+        // Rotar alrededor del centro del sprite (igual que el path inmediato)
+        vec2 local = (aPosition - 0.5) * iSize;
+        float r = radians(iRotation);
+        float c = cos(r);
+        float s = sin(r);
+        vec2 rotated = vec2(c * local.x - s * local.y, s * local.x + c * local.y);
+        vec2 world = iPosition + 0.5 * iSize + rotated;
+
+        vTexCoord = mix(iUVRect.xy, iUVRect.zw, aTexCoord);
+        vColor = iColor;
+        vTextureSlot = iTextureSlot;
+        gl_Position = uProjection * vec4(world, 0.0, 1.0);
+    }
+)";
+
+// Fragment shader: GLSL 3.30 solo permite indexar samplers con constantes,
+// por eso se usa un switch sobre el slot
+const char* BATCH_FRAGMENT_SRC = R"(
+    #version 330 core
+    in vec2 vTexCoord;
+    in vec4 vColor;
+    flat in uint vTextureSlot;
+    out vec4 FragColor;
+
+    uniform sampler2D uTextures[8];
+
+    void main() {
+        vec4 texel;
+        switch (vTextureSlot) {
+            case 0u: texel = texture(uTextures[0], vTexCoord); break;
+            case 1u: texel = texture(uTextures[1], vTexCoord); break;
+            case 2u: texel = texture(uTextures[2], vTexCoord); break;
+            case 3u: texel = texture(uTextures[3], vTexCoord); break;
+            case 4u: texel = texture(uTextures[4], vTexCoord); break;
+            case 5u: texel = texture(uTextures[5], vTexCoord); break;
+            case 6u: texel = texture(uTextures[6], vTexCoord); break;
+            default: texel = texture(uTextures[7], vTexCoord); break;
+        }
+        FragColor = texel * vColor;
+    }
+)";
+
+// Vertex shader multi-draw: mismos atributos; la unidad de textura de cada
+// slot sale del SSBO con los datos por draw (gl_DrawIDARB = índice del
+// comando dentro del glMultiDrawArraysIndirect)
+const char* MULTI_DRAW_VERTEX_SRC = R"(
+    #version 430 core
+    #extension GL_ARB_shader_draw_parameters : require
+    layout (location = 0) in vec2 aPosition;
+    layout (location = 1) in vec2 aTexCoord;
+
+    layout (location = 2) in vec2 iPosition;
+    layout (location = 3) in vec2 iSize;
+    layout (location = 4) in vec4 iColor;
+    layout (location = 5) in vec4 iUVRect;
+    layout (location = 6) in float iRotation;
+    layout (location = 7) in uint iTextureSlot;
+
+    out vec2 vTexCoord;
+    out vec4 vColor;
+    flat out uint vTextureUnit;
+
+    layout (std140) uniform FrameData {
+        mat4 uProjection;
+        vec4 uTime;
+    };
+
+    // 8 unidades por draw (una por slot del batch)
+    layout (std430, binding = 0) readonly buffer DrawData {
+        uint uUnits[];
+    };
+
+    void main() {
+        vec2 local = (aPosition - 0.5) * iSize;
+        float r = radians(iRotation);
+        float c = cos(r);
+        float s = sin(r);
+        vec2 rotated = vec2(c * local.x - s * local.y, s * local.x + c * local.y);
+        vec2 world = iPosition + 0.5 * iSize + rotated;
+
+        vTexCoord = mix(iUVRect.xy, iUVRect.zw, aTexCoord);
+        vColor = iColor;
+        vTextureUnit = uUnits[gl_DrawIDARB * 8 + int(iTextureSlot)];
+        gl_Position = uProjection * vec4(world, 0.0, 1.0);
+    }
+)";
+
+// Fragment shader multi-draw: la unidad no es uniforme dentro del
+// multi-draw, así que sigue haciendo falta el switch
+const char* MULTI_DRAW_FRAGMENT_SRC = R"(
+    #version 430 core
+    in vec2 vTexCoord;
+    in vec4 vColor;
+    flat in uint vTextureUnit;
+    out vec4 FragColor;
+
+    uniform sampler2D uTextures[16];
+
+    void main() {
+        vec4 texel;
+        switch (vTextureUnit) {
+            case 0u: texel = texture(uTextures[0], vTexCoord); break;
+            case 1u: texel = texture(uTextures[1], vTexCoord); break;
+            case 2u: texel = texture(uTextures[2], vTexCoord); break;
+            case 3u: texel = texture(uTextures[3], vTexCoord); break;
+            case 4u: texel = texture(uTextures[4], vTexCoord); break;
+            case 5u: texel = texture(uTextures[5], vTexCoord); break;
+            case 6u: texel = texture(uTextures[6], vTexCoord); break;
+            case 7u: texel = texture(uTextures[7], vTexCoord); break;
+            case 8u: texel = texture(uTextures[8], vTexCoord); break;
+            case 9u: texel = texture(uTextures[9], vTexCoord); break;
+            case 10u: texel = texture(uTextures[10], vTexCoord); break;
+            case 11u: texel = texture(uTextures[11], vTexCoord); break;
+            case 12u: texel = texture(uTextures[12], vTexCoord); break;
+            case 13u: texel = texture(uTextures[13], vTexCoord); break;
+            case 14u: texel = texture(uTextures[14], vTexCoord); break;
+            default: texel = texture(uTextures[15], vTexCoord); break;
+        }
+        FragColor = texel * vColor;
+    }
+)";
+
+/**
+ * @brief Apunta los atributos de instancia (2..7) al buffer enlazado
+ * @param base Offset en bytes de la primera instancia
+ */
+void SetInstanceAttributePointers(size_t base) {
+    const GLsizei stride = sizeof(SpriteInstance);
+
+    glVertexAttribPointer(2, 2, GL_FLOAT, GL_FALSE, stride,
+                          (void*)(base + offsetof(SpriteInstance, position)));
+    glVertexAttribPointer(3, 2, GL_FLOAT, GL_FALSE, stride,
+                          (void*)(base + offsetof(SpriteInstance, size)));
+    glVertexAttribPointer(4, 4, GL_FLOAT, GL_FALSE, stride,
+                          (void*)(base + offsetof(SpriteInstance, color)));
+    glVertexAttribPointer(5, 4, GL_FLOAT, GL_FALSE, stride,
+                          (void*)(base + offsetof(SpriteInstance, uvRect)));
+    glVertexAttribPointer(6, 1, GL_FLOAT, GL_FALSE, stride,
+                          (void*)(base + offsetof(SpriteInstance, rotation)));
+    glVertexAttribIPointer(7, 1, GL_UNSIGNED_INT, stride,
+                           (void*)(base + offsetof(SpriteInstance, textureSlot)));
+}
+
+/**
+ * @brief Configura un VAO: quad por vértice + atributos de instancia
+ */
+void SetupSpriteVertexArray(GLuint quadVBO) {
+    glBindBuffer(GL_ARRAY_BUFFER, quadVBO);
+    glEnableVertexAttribArray(0);
+    glVertexAttribPointer(0, 2, GL_FLOAT, GL_FALSE, 4 * sizeof(float), (void*)0);
+    glEnableVertexAttribArray(1);
+    glVertexAttribPointer(1, 2, GL_FLOAT, GL_FALSE, 4 * sizeof(float), (void*)(2 * sizeof(float)));
+
+    for (GLuint location = 2; location <= 7; ++location) {
+        glEnableVertexAttribArray(location);
+        glVertexAttribDivisor(location, 1);
+    }
+}
+
+} // namespace
+
+SpriteBatch::SpriteBatch() = default;
+
+SpriteBatch::~SpriteBatch() {
+    Shutdown();
+}
+
+bool SpriteBatch::Initialize(GLuint quadVBO, ShaderCache* shaderCache) {
+    if (!m_Shader.CompileFromSource(BATCH_VERTEX_SRC, BATCH_FRAGMENT_SRC, shaderCache)) {
+        spdlog::error("SpriteBatch: fallo al compilar shader instanciado");
+        return false;
+    }
+
+    // Proyección y tiempo llegan por el UBO del frame
+    m_Shader.BindUniformBlock(FRAME_UNIFORMS_BLOCK, FRAME_UNIFORMS_BINDING);
+
+    // Los samplers apuntan siempre a las mismas unidades de textura
+    m_Shader.Use();
+    for (uint32_t slot = 0; slot < MAX_TEXTURE_SLOTS; ++slot) {
+        m_Shader.SetInteger("uTextures[" + std::to_string(slot) + "]", static_cast<int>(slot));
+    }
+
+    m_QuadVBO = quadVBO;
+    m_ShaderCache = shaderCache;
+
+    glGenVertexArrays(1, &m_VAO);
+
+    // Buffer de instancias en anillo (los punteros se fijan por batch en Flush)
+    if (!m_InstanceBuffer.Initialize(INITIAL_INSTANCE_CAPACITY * sizeof(SpriteInstance))) {
+        spdlog::error("SpriteBatch: fallo al crear el buffer de instancias");
+        return false;
+    }
+
+    glBindVertexArray(m_VAO);
+    SetupSpriteVertexArray(m_QuadVBO);
+    BindInstanceAttributes(0);
+
+    glBindVertexArray(0);
+
+    m_Instances.reserve(INITIAL_INSTANCE_CAPACITY);
+    Begin();
+
+    spdlog::debug("SpriteBatch inicializado (VAO: {}, instancias: {}, {})", m_VAO,
+                  INITIAL_INSTANCE_CAPACITY,
+                  m_InstanceBuffer.IsPersistent() ? "buffer persistente" : "buffer mapeado");
+    return true;
+}
+
+void SpriteBatch::Shutdown() {
+    m_InstanceBuffer.Shutdown();
+    m_DrawBuffer.Shutdown();
+    m_MultiDrawEnabled = false;
+    m_ShaderCache = nullptr;
+    if (m_VAO != 0) {
+        glDeleteVertexArrays(1, &m_VAO);
+        m_VAO = 0;
+    }
+    m_QuadVBO = 0;
+    m_Instances.clear();
+    m_Batches.clear();
+    m_IndirectCommands.clear();
+    m_DrawUnits.clear();
+}
+
+bool SpriteBatch::IsMultiDrawSupported() {
+    return GLEW_VERSION_4_3 && GLEW_ARB_shader_draw_parameters;
+}
+
+bool SpriteBatch::SetMultiDrawEnabled(bool enabled) {
+    if (!enabled) {
+        m_MultiDrawEnabled = false;
+        return true;
+    }
+    if (m_MultiDrawEnabled) {
+        return true;
+    }
+    if (!IsMultiDrawSupported()) {
+        spdlog::debug("SpriteBatch: multi-draw no soportado (requiere GL 4.3 + ARB_shader_draw_parameters)");
+        return false;
+    }
+
+    // Recursos del path multi-draw: se crean la primera vez que se activa
+    if (m_DrawBuffer.GetHandle() == 0) {
+        if (m_MultiDrawShader.GetID() == 0 &&
+            !m_MultiDrawShader.CompileFromSource(MULTI_DRAW_VERTEX_SRC, MULTI_DRAW_FRAGMENT_SRC, m_ShaderCache)) {
+            spdlog::error("SpriteBatch: fallo al compilar shader multi-draw");
+            return false;
+        }
+        m_MultiDrawShader.BindUniformBlock(FRAME_UNIFORMS_BLOCK, FRAME_UNIFORMS_BINDING);
+        m_MultiDrawShader.Use();
+        for (uint32_t unit = 0; unit < MULTI_DRAW_TEXTURE_UNITS; ++unit) {
+            m_MultiDrawShader.SetInteger("uTextures[" + std::to_string(unit) + "]", static_cast<int>(unit));
+        }
+
+        // Un comando + 8 unidades por batch; crece como el de instancias
+        const size_t bytesPerBatch = sizeof(DrawArraysIndirectCommand) + MAX_TEXTURE_SLOTS * sizeof(GLuint);
+        if (!m_DrawBuffer.Initialize(INITIAL_INSTANCE_CAPACITY / 16 * bytesPerBatch, GL_DRAW_INDIRECT_BUFFER)) {
+            spdlog::error("SpriteBatch: fallo al crear el buffer de comandos indirectos");
+            return false;
+        }
+    }
+
+    m_MultiDrawEnabled = true;
+    return true;
+}
+
+void SpriteBatch::Begin() {
+    m_Instances.clear();
+    m_Batches.clear();
+    m_Batches.push_back(Batch{});
+}
+
+void SpriteBatch::Submit(GLuint texture, SpriteInstance instance) {
+    instance.textureSlot = AcquireTextureSlot(texture);
+    m_Instances.push_back(instance);
+    m_Batches.back().instanceCount++;
+}
+
+void SpriteBatch::SubmitRange(GLuint texture, const glm::vec4& uvRect,
+                              const IRenderer::SpriteDraw* sprites, size_t count) {
+    const uint32_t slot = AcquireTextureSlot(texture);
+
+    const size_t first = m_Instances.size();
+    m_Instances.resize(first + count);
+    for (size_t i = 0; i < count; ++i) {
+        SpriteInstance& instance = m_Instances[first + i];
+        instance.position = sprites[i].position;
+        instance.size = sprites[i].size;
+        instance.color = sprites[i].color;
+        instance.uvRect = uvRect;
+        instance.rotation = sprites[i].rotation;
+        instance.textureSlot = slot;
+    }
+    m_Batches.back().instanceCount += static_cast<uint32_t>(count);
+}
+
+uint32_t SpriteBatch::AcquireTextureSlot(GLuint texture) {
+    Batch* batch = &m_Batches.back();
+
+    // Búsqueda lineal: como mucho MAX_TEXTURE_SLOTS comparaciones
+    for (uint32_t slot = 0; slot < batch->textureCount; ++slot) {
+        if (batch->textures[slot] == texture) {
+            return slot;
+        }
+    }
+
+    // Batch lleno: cerrar y abrir uno nuevo a continuación
+    if (batch->textureCount == MAX_TEXTURE_SLOTS) {
+        Batch next;
+        next.firstInstance = static_cast<uint32_t>(m_Instances.size());
+        m_Batches.push_back(next);
+        batch = &m_Batches.back();
+    }
+
+    batch->textures[batch->textureCount] = texture;
+    return batch->textureCount++;
+}
+
+void SpriteBatch::Flush(IRenderer::RenderStats& stats) {
+    if (m_Instances.empty()) {
+        Begin();
+        return;
+    }
+
+    // Reservar en la sección del frame; si no cabe, ampliar el anillo
+    // (potencia de 2, ver VertexBuffer::Reserve)
+    const auto instanceCount = static_cast<uint32_t>(m_Instances.size());
+    const size_t bytes = instanceCount * sizeof(SpriteInstance);
+
+    VertexBuffer::Allocation allocation = m_InstanceBuffer.Allocate(bytes);
+    if (!allocation) {
+        m_InstanceBuffer.Reserve(m_InstanceBuffer.GetBytesPerFrame() + bytes);
+        allocation = m_InstanceBuffer.Allocate(bytes);
+    }
+    if (!allocation) {
+        spdlog::error("SpriteBatch: no se pudo reservar memoria para {} instancias", instanceCount);
+        Begin();
+        return;
+    }
+
+    // Escritura directa en memoria mapeada: sin glBufferSubData ni orphaning
+    std::memcpy(allocation.data, m_Instances.data(), bytes);
+    m_InstanceBuffer.Commit(allocation);
+
+    glBindVertexArray(m_VAO);
+
+    if (m_MultiDrawEnabled) {
+        DrawBatchesIndirect(allocation.offset, stats);
+    } else {
+        DrawBatches(allocation.offset, stats);
+    }
+
+    glBindVertexArray(0);
+    glActiveTexture(GL_TEXTURE0);
+
+    stats.sprites += instanceCount;
+    stats.triangles += instanceCount * 2;
+    stats.vertices += instanceCount * 6;
+    stats.uploadBytes += bytes;
+
+    Begin();
+}
+
+void SpriteBatch::DrawBatches(size_t instanceOffset, IRenderer::RenderStats& stats) {
+    m_Shader.Use();
+
+    for (const Batch& batch : m_Batches) {
+        if (batch.instanceCount == 0) {
+            continue;
+        }
+
+        for (uint32_t slot = 0; slot < batch.textureCount; ++slot) {
+            glActiveTexture(GL_TEXTURE0 + slot);
+            glBindTexture(GL_TEXTURE_2D, batch.textures[slot]);
+        }
+
+        BindInstanceAttributes(instanceOffset + batch.firstInstance * sizeof(SpriteInstance));
+        glDrawArraysInstanced(GL_TRIANGLES, 0, 6, static_cast<GLsizei>(batch.instanceCount));
+
+        stats.drawCalls++;
+        stats.batches++;
+    }
+}
+
+void SpriteBatch::DrawBatchesIndirect(size_t instanceOffset, IRenderer::RenderStats& stats) {
+    m_MultiDrawShader.Use();
+
+    // Los atributos apuntan una sola vez al inicio del frame: cada comando
+    // elige su primera instancia con baseInstance
+    BindInstanceAttributes(instanceOffset);
+
+    // Pasadas de hasta MULTI_DRAW_TEXTURE_UNITS texturas distintas; los
+    // batches consecutivos suelen compartir texturas (atlas, mismo layer)
+    GLuint passTextures[MULTI_DRAW_TEXTURE_UNITS];
+    uint32_t passTextureCount = 0;
+    m_IndirectCommands.clear();
+    m_DrawUnits.clear();
+
+    for (const Batch& batch : m_Batches) {
+        if (batch.instanceCount == 0) {
+            continue;
+        }
+
+        // Si las texturas nuevas del batch no caben, la pasada se envía
+        uint32_t missing = 0;
+        for (uint32_t slot = 0; slot < batch.textureCount; ++slot) {
+            GLuint* end = passTextures + passTextureCount;
+            missing += std::find(passTextures, end, batch.textures[slot]) == end ? 1 : 0;
+        }
+        if (passTextureCount + missing > MULTI_DRAW_TEXTURE_UNITS) {
+            SubmitIndirectPass(passTextures, passTextureCount, stats);
+            passTextureCount = 0;
+        }
+
+        GLuint units[MAX_TEXTURE_SLOTS] = {};
+        for (uint32_t slot = 0; slot < batch.textureCount; ++slot) {
+            GLuint* end = passTextures + passTextureCount;
+            const GLuint* found = std::find(passTextures, end, batch.textures[slot]);
+            if (found == end) {
+                passTextures[passTextureCount++] = batch.textures[slot];
+            }
+            units[slot] = static_cast<GLuint>(found - passTextures);
+        }
+
+        m_IndirectCommands.push_back({6, batch.instanceCount, 0, batch.firstInstance});
+        m_DrawUnits.insert(m_DrawUnits.end(), units, units + MAX_TEXTURE_SLOTS);
+    }
+
+    SubmitIndirectPass(passTextures, passTextureCount, stats);
+}
+
+void SpriteBatch::SubmitIndirectPass(const GLuint* textures, uint32_t textureCount,
+                                     IRenderer::RenderStats& stats) {
+    if (m_IndirectCommands.empty()) {
+        return;
+    }
+
+    const size_t commandBytes = m_IndirectCommands.size() * sizeof(DrawArraysIndirectCommand);
+    const size_t unitBytes = m_DrawUnits.size() * sizeof(GLuint);
+
+    GLint ssboAlignment = 16;
+    glGetIntegerv(GL_SHADER_STORAGE_BUFFER_OFFSET_ALIGNMENT, &ssboAlignment);
+    const auto unitAlignment = static_cast<size_t>(std::max(ssboAlignment, 16));
+
+    // Una sola asignación por pasada (en el fallback sin mapeo persistente
+    // no puede haber dos rangos mapeados a la vez): comandos al principio y
+    // datos por draw detrás, alineados para el SSBO
+    const size_t unitOffset = (commandBytes + unitAlignment - 1) & ~(unitAlignment - 1);
+    const size_t bytes = unitOffset + unitBytes;
+
+    // Si no cabe, el anillo crece (las pasadas ya enviadas conservan el
+    // buffer anterior hasta que la GPU termina con él)
+    VertexBuffer::Allocation allocation = m_DrawBuffer.Allocate(bytes, unitAlignment);
+    if (!allocation) {
+        m_DrawBuffer.Reserve(m_DrawBuffer.GetBytesPerFrame() + bytes + unitAlignment);
+        allocation = m_DrawBuffer.Allocate(bytes, unitAlignment);
+    }
+    if (!allocation) {
+        spdlog::error("SpriteBatch: no se pudo reservar memoria para {} comandos indirectos",
+                      m_IndirectCommands.size());
+        m_IndirectCommands.clear();
+        m_DrawUnits.clear();
+        return;
+    }
+
+    auto* data = static_cast<uint8_t*>(allocation.data);
+    std::memcpy(data, m_IndirectCommands.data(), commandBytes);
+    std::memcpy(data + unitOffset, m_DrawUnits.data(), unitBytes);
+    m_DrawBuffer.Commit(allocation);
+
+    for (uint32_t unit = 0; unit < textureCount; ++unit) {
+        glActiveTexture(GL_TEXTURE0 + unit);
+        glBindTexture(GL_TEXTURE_2D, textures[unit]);
+    }
+
+    m_DrawBuffer.Bind();
+    glBindBufferRange(GL_SHADER_STORAGE_BUFFER, MULTI_DRAW_DATA_BINDING, m_DrawBuffer.GetHandle(),
+                      static_cast<GLintptr>(allocation.offset + unitOffset), static_cast<GLsizeiptr>(unitBytes));
+    glMultiDrawArraysIndirect(GL_TRIANGLES, reinterpret_cast<const void*>(allocation.offset),
+                              static_cast<GLsizei>(m_IndirectCommands.size()), 0);
+
+    stats.drawCalls++;
+    stats.batches += static_cast<uint32_t>(m_IndirectCommands.size());
+
+    m_IndirectCommands.clear();
+    m_DrawUnits.clear();
+}
+
+void SpriteBatch::EndFrame() {
+    m_InstanceBuffer.EndFrame();
+    if (m_DrawBuffer.GetHandle() != 0) {
+        m_DrawBuffer.EndFrame();
+    }
+}
+
+void SpriteBatch::BindInstanceAttributes(size_t base) {
+    m_InstanceBuffer.Bind();
+    SetInstanceAttributePointers(base);
+}
+
+// ============================================================================
+// Geometría estática
+// ============================================================================
+
+bool SpriteBatch::UploadStatic(StaticGeometry& geometry, const SpriteInstance* instances, size_t count) {
+    if (geometry.vao == 0) {
+        glGenVertexArrays(1, &geometry.vao);
+        glGenBuffers(1, &geometry.buffer);
+        if (geometry.vao == 0 || geometry.buffer == 0) {
+            spdlog::error("SpriteBatch: no se pudo crear la geometría estática");
+            ReleaseStatic(geometry);
+            return false;
+        }
+
+        glBindVertexArray(geometry.vao);
+        SetupSpriteVertexArray(m_QuadVBO);
+        glBindVertexArray(0);
+    }
+
+    // Reemplazo completo: se rehace poco y así el driver puede recolocarlo
+    glBindBuffer(GL_ARRAY_BUFFER, geometry.buffer);
+    glBufferData(GL_ARRAY_BUFFER, static_cast<GLsizeiptr>(count * sizeof(SpriteInstance)),
+                 count > 0 ? instances : nullptr, GL_STATIC_DRAW);
+    glBindBuffer(GL_ARRAY_BUFFER, 0);
+
+    geometry.instanceCount = static_cast<uint32_t>(count);
+    return true;
+}
+
+void SpriteBatch::DrawStatic(const StaticGeometry& geometry, uint32_t firstInstance, uint32_t instanceCount,
+                             const GLuint* textures, uint32_t textureCount, IRenderer::RenderStats& stats) {
+    if (geometry.vao == 0 || instanceCount == 0) {
+        return;
+    }
+
+    m_Shader.Use();
+
+    for (uint32_t slot = 0; slot < textureCount; ++slot) {
+        glActiveTexture(GL_TEXTURE0 + slot);
+        glBindTexture(GL_TEXTURE_2D, textures[slot]);
+    }
+
+    glBindVertexArray(geometry.vao);
+    glBindBuffer(GL_ARRAY_BUFFER, geometry.buffer);
+    SetInstanceAttributePointers(firstInstance * sizeof(SpriteInstance));
+    glDrawArraysInstanced(GL_TRIANGLES, 0, 6, static_cast<GLsizei>(instanceCount));
+    glBindVertexArray(0);
+    glActiveTexture(GL_TEXTURE0);
+
+    stats.drawCalls++;
+    stats.batches++;
+    stats.sprites += instanceCount;
+    stats.staticSprites += instanceCount;
+    stats.triangles += instanceCount * 2;
+    stats.vertices += instanceCount * 6;
+}
+
+void SpriteBatch::ReleaseStatic(StaticGeometry& geometry) {
+    if (geometry.buffer != 0) {
+        glDeleteBuffers(1, &geometry.buffer);
+    }
+    if (geometry.vao != 0) {
+        glDeleteVertexArrays(1, &geometry.vao);
+    }
+    geometry = StaticGeometry{};
+}
+
+} // namespace MultiNinjaEspacial::Infrastructure::Rendering
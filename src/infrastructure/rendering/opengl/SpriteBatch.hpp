@@ -0,0 +1,284 @@
+// ============================================================================
+// Sprite Batch - Renderizado instanciado de sprites
+// ============================================================================
+// Acumula las llamadas a DrawSprite del frame en un buffer de instancias y
+// las dibuja con unos pocos glDrawArraysInstanced en Present()
+// ============================================================================
+
+#pragma once
+
+#include "../IRenderer.hpp"
+#include "ShaderProgram.hpp"
+#include "VertexBuffer.hpp"
+#include <GL/glew.h>
+#include <glm/glm.hpp>
+#include <array>
+#include <cstdint>
+#include <vector>
+
+namespace MultiNinjaEspacial::Infrastructure::Rendering {
+
+/**
+ * @brief Datos por instancia de un sprite (layout idéntico al del VBO)
+ *
+ * Cada DrawSprite se convierte en una de estas estructuras. El vertex shader
+ * reconstruye la transformación (traslación + rotación desde el centro +
+ * escala) a partir de estos campos, así que no hay matrices por sprite.
+ */
+struct SpriteInstance {
+    glm::vec2 position{0.0f};                    // Esquina superior izquierda (px)
+    glm::vec2 size{1.0f};                        // Tamaño en píxeles
+    glm::vec4 color{1.0f};                       // Tint RGBA
+    glm::vec4 uvRect{0.0f, 0.0f, 1.0f, 1.0f};    // {u0, v0, u1, v1}
+    float rotation{0.0f};                        // Grados, alrededor del centro
+    uint32_t textureSlot{0};                     // Índice en los slots del batch
+};
+
+/**
+ * @brief Batcher de sprites con instancing (OpenGL 3.3)
+ *
+ * Funcionamiento:
+ * - Submit() añade una instancia al buffer del frame. Cada batch admite
+ *   hasta MAX_TEXTURE_SLOTS texturas distintas; al llenarse se abre otro.
+ * - Flush() copia todas las instancias a la sección del frame del
+ *   VertexBuffer en anillo (memoria mapeada) y emite un
+ *   glDrawArraysInstanced por batch.
+ * - EndFrame() cierra la sección del frame (fence) al final de Present().
+ *
+ * Con multi-draw (GL 4.3 + ARB_shader_draw_parameters, ver
+ * SetMultiDrawEnabled) Flush() no emite un draw por batch: escribe un
+ * comando indirecto por batch y los envía con un solo
+ * glMultiDrawArraysIndirect por pasada. Las texturas de toda la pasada
+ * (hasta MULTI_DRAW_TEXTURE_UNITS) se enlazan una vez y cada draw lee de un
+ * SSBO qué unidad corresponde a cada uno de sus slots (índice gl_DrawID).
+ *
+ * El orden de envío se conserva (los batches son consecutivos), por lo que
+ * el orden de capas que decida el llamador se respeta.
+ *
+ * La geometría estática (StaticGeometry) usa el mismo shader con un buffer
+ * GL_STATIC_DRAW propio: se sube una vez y se dibuja por rangos sin copiar
+ * nada por frame.
+ *
+ * Ejemplo de uso:
+ * ```cpp
+ * SpriteBatch batch;
+ * batch.Initialize(quadVBO);
+ *
+ * batch.Begin();
+ * batch.Submit(textureHandle, instance);
+ * batch.Flush(stats);
+ * batch.EndFrame();
+ * ```
+ */
+class SpriteBatch {
+public:
+    // Texturas simultáneas por batch (GL 3.3 garantiza 16 unidades en fragment)
+    static constexpr uint32_t MAX_TEXTURE_SLOTS = 8;
+
+    // Capacidad inicial por frame del buffer de instancias (crece si hace falta)
+    static constexpr uint32_t INITIAL_INSTANCE_CAPACITY = 4096;
+
+    // Texturas por pasada multi-draw (mínimo de GL_MAX_TEXTURE_IMAGE_UNITS)
+    static constexpr uint32_t MULTI_DRAW_TEXTURE_UNITS = 16;
+
+    // Binding del SSBO con los datos por draw
+    static constexpr GLuint MULTI_DRAW_DATA_BINDING = 0;
+
+    SpriteBatch();
+    ~SpriteBatch();
+
+    SpriteBatch(const SpriteBatch&) = delete;
+    SpriteBatch& operator=(const SpriteBatch&) = delete;
+
+    /**
+     * @brief Instancias residentes en GPU (batches estáticos)
+     */
+    struct StaticGeometry {
+        GLuint vao{0};
+        GLuint buffer{0};
+        uint32_t instanceCount{0};
+    };
+
+    /**
+     * @brief Crea shader, VAO y buffer de instancias
+     * @param quadVBO VBO del quad unitario (posición + UV) compartido con el renderer
+     * @param shaderCache Cache de program binaries (opcional)
+     * @return true si exitoso
+     */
+    bool Initialize(GLuint quadVBO, ShaderCache* shaderCache = nullptr);
+
+    /**
+     * @brief Libera los recursos de OpenGL
+     */
+    void Shutdown();
+
+    /**
+     * @brief Indica si el driver soporta el path multi-draw
+     *
+     * Requiere contexto actual: GL 4.3 (multi-draw indirect, SSBO,
+     * baseInstance) y ARB_shader_draw_parameters (gl_DrawID).
+     */
+    [[nodiscard]] static bool IsMultiDrawSupported();
+
+    /**
+     * @brief Activa/desactiva el envío con glMultiDrawArraysIndirect
+     * @param enabled true = un draw indirecto por pasada; false = path 3.3
+     * @return true si el modo pedido quedó activo (false si no hay soporte)
+     *
+     * Vaciar el batch antes de cambiar de modo.
+     */
+    bool SetMultiDrawEnabled(bool enabled);
+
+    [[nodiscard]] bool IsMultiDrawEnabled() const { return m_MultiDrawEnabled; }
+
+    /**
+     * @brief Descarta las instancias pendientes y empieza un frame nuevo
+     */
+    void Begin();
+
+    /**
+     * @brief Añade un sprite al batch actual
+     * @param texture Handle de textura OpenGL (0 = sin textura)
+     * @param instance Datos del sprite (textureSlot se rellena aquí)
+     */
+    void Submit(GLuint texture, SpriteInstance instance);
+
+    /**
+     * @brief Añade muchos sprites con la misma textura
+     * @param texture Handle de textura OpenGL
+     * @param uvRect Región UV común (atlas)
+     * @param sprites Sprites a añadir
+     * @param count Número de sprites
+     *
+     * Ocupa un único slot de textura, así que el bloque entero cae en un
+     * batch (salvo que ese slot abra uno nuevo).
+     */
+    void SubmitRange(GLuint texture, const glm::vec4& uvRect,
+                     const IRenderer::SpriteDraw* sprites, size_t count);
+
+    /**
+     * @brief Dibuja todas las instancias pendientes y vacía el batch
+     * @param stats Estadísticas a actualizar (draw calls, batches, sprites)
+     *
+     * La proyección se lee del UBO de FrameData (binding FRAME_UNIFORMS_BINDING),
+     * que el renderer debe haber subido antes.
+     */
+    void Flush(IRenderer::RenderStats& stats);
+
+    /**
+     * @brief Marca el final del frame en el buffer de instancias
+     *
+     * Llamar una vez por frame, después del último Flush().
+     */
+    void EndFrame();
+
+    /**
+     * @brief Sube instancias a una geometría estática (la crea si hace falta)
+     * @param geometry Geometría destino (se reemplaza su contenido)
+     * @param instances Instancias con textureSlot ya asignado
+     * @param count Número de instancias
+     * @return true si exitoso
+     */
+    bool UploadStatic(StaticGeometry& geometry, const SpriteInstance* instances, size_t count);
+
+    /**
+     * @brief Dibuja un rango de una geometría estática
+     * @param geometry Geometría subida con UploadStatic
+     * @param firstInstance Primera instancia del rango
+     * @param instanceCount Instancias del rango
+     * @param textures Texturas de los slots del rango
+     * @param textureCount Número de slots (≤ MAX_TEXTURE_SLOTS)
+     * @param stats Estadísticas a actualizar
+     *
+     * No toca las instancias pendientes: el llamador vacía el batch antes
+     * si quiere conservar el orden.
+     */
+    void DrawStatic(const StaticGeometry& geometry, uint32_t firstInstance, uint32_t instanceCount,
+                    const GLuint* textures, uint32_t textureCount, IRenderer::RenderStats& stats);
+
+    /**
+     * @brief Libera una geometría estática
+     */
+    static void ReleaseStatic(StaticGeometry& geometry);
+
+    /**
+     * @brief Número de sprites pendientes de dibujar
+     */
+    [[nodiscard]] size_t GetPendingCount() const { return m_Instances.size(); }
+
+private:
+    /**
+     * @brief Rango de instancias que comparte un conjunto de texturas
+     */
+    struct Batch {
+        uint32_t firstInstance{0};
+        uint32_t instanceCount{0};
+        uint32_t textureCount{0};
+        std::array<GLuint, MAX_TEXTURE_SLOTS> textures{};
+    };
+
+    /**
+     * @brief Busca (o asigna) el slot de una textura en el batch actual
+     * @return Índice de slot
+     */
+    uint32_t AcquireTextureSlot(GLuint texture);
+
+    /**
+     * @brief Comando de glMultiDrawArraysIndirect (layout fijado por GL)
+     */
+    struct DrawArraysIndirectCommand {
+        GLuint count;
+        GLuint instanceCount;
+        GLuint first;
+        GLuint baseInstance;
+    };
+
+    /**
+     * @brief Dibuja los batches con un draw por batch (path 3.3)
+     * @param instanceOffset Offset en bytes de la primera instancia del frame
+     */
+    void DrawBatches(size_t instanceOffset, IRenderer::RenderStats& stats);
+
+    /**
+     * @brief Dibuja los batches con un multi-draw indirecto por pasada
+     * @param instanceOffset Offset en bytes de la primera instancia del frame
+     */
+    void DrawBatchesIndirect(size_t instanceOffset, IRenderer::RenderStats& stats);
+
+    /**
+     * @brief Sube los comandos y datos por draw de una pasada y la dibuja
+     * @param textures Texturas de la pasada (unidad = índice)
+     */
+    void SubmitIndirectPass(const GLuint* textures, uint32_t textureCount, IRenderer::RenderStats& stats);
+
+    /**
+     * @brief Apunta los atributos de instancia al inicio de un batch
+     * @param base Offset en bytes de la primera instancia del batch
+     *
+     * OpenGL 3.3 no tiene baseInstance, así que desplazamos los punteros.
+     */
+    void BindInstanceAttributes(size_t base);
+
+    // Shader instanciado
+    ShaderProgram m_Shader;
+    ShaderCache* m_ShaderCache{nullptr};
+
+    // Path multi-draw (GL 4.3): shader propio y anillo con los comandos
+    // indirectos + datos por draw (SSBO) de cada frame
+    ShaderProgram m_MultiDrawShader;
+    VertexBuffer m_DrawBuffer;
+    bool m_MultiDrawEnabled{false};
+    std::vector<DrawArraysIndirectCommand> m_IndirectCommands;
+    std::vector<GLuint> m_DrawUnits;    // MAX_TEXTURE_SLOTS unidades por draw
+
+    // VAO propio (quad + atributos de instancia)
+    GLuint m_VAO{0};
+    GLuint m_QuadVBO{0};
+    VertexBuffer m_InstanceBuffer;
+
+    // Datos del frame actual
+    std::vector<SpriteInstance> m_Instances;
+    std::vector<Batch> m_Batches;
+};
+
+} // namespace MultiNinjaEspacial::Infrastructure::Rendering
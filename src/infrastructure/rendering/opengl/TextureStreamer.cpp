@@ -0,0 +1,189 @@
+// ============================================================================
+// Texture Streamer - Implementación
+// ============================================================================
+
+#include "TextureStreamer.hpp"
+#include <spdlog/spdlog.h>
+#include <algorithm>
+#include <cstring>
+
+namespace MultiNinjaEspacial::Infrastructure::Rendering {
+
+TextureStreamer::~TextureStreamer() {
+    Shutdown();
+}
+
+bool TextureStreamer::Initialize(uint32_t workerCount) {
+    if (workerCount == 0) {
+        // Dejar núcleos libres para el hilo principal y el driver
+        workerCount = std::clamp(std::thread::hardware_concurrency() / 2, 1u, 4u);
+    }
+
+    glGenBuffers(PBO_COUNT, m_PBOs.data());
+
+    m_Stop = false;
+    m_Workers.reserve(workerCount);
+    for (uint32_t i = 0; i < workerCount; ++i) {
+        m_Workers.emplace_back(&TextureStreamer::WorkerMain, this);
+    }
+
+    spdlog::debug("TextureStreamer inicializado ({} workers, {} PBOs)", workerCount, PBO_COUNT);
+    return true;
+}
+
+void TextureStreamer::Shutdown() {
+    {
+        std::lock_guard lock(m_Mutex);
+        m_Stop = true;
+        m_Requests.clear();
+    }
+    m_Condition.notify_all();
+
+    for (auto& worker : m_Workers) {
+        if (worker.joinable()) {
+            worker.join();
+        }
+    }
+    m_Workers.clear();
+    m_Decoded.clear();
+
+    for (auto& upload : m_Uploads) {
+        glDeleteTextures(1, &upload.texture);
+    }
+    m_Uploads.clear();
+
+    if (m_PBOs[0] != 0) {
+        glDeleteBuffers(PBO_COUNT, m_PBOs.data());
+        m_PBOs.fill(0);
+    }
+}
+
+void TextureStreamer::Enqueue(uint32_t ticket, std::string filepath) {
+    {
+        std::lock_guard lock(m_Mutex);
+        m_Requests.push_back(Request{ticket, std::move(filepath)});
+    }
+    m_Condition.notify_one();
+}
+
+void TextureStreamer::WorkerMain() {
+    for (;;) {
+        Request request;
+        {
+            std::unique_lock lock(m_Mutex);
+            m_Condition.wait(lock, [this] { return m_Stop || !m_Requests.empty(); });
+            if (m_Stop) {
+                return;
+            }
+            request = std::move(m_Requests.front());
+            m_Requests.pop_front();
+        }
+
+        // Decodificación (lo caro) fuera del lock y del hilo de render
+        Decoded decoded{request.ticket, {}, {}};
+        if (!DecodeImageFile(request.filepath, decoded.image, decoded.error)) {
+            decoded.error = request.filepath + ": " + decoded.error;
+        }
+
+        {
+            std::lock_guard lock(m_Mutex);
+            m_Decoded.push_back(std::move(decoded));
+        }
+    }
+}
+
+/**
+ * @brief Avanza el pipeline en el hilo de render
+ * @param byteBudget Bytes máximos a subir en este frame
+ * @param completed Texturas terminadas en este frame
+ *
+ * Proceso:
+ * 1. Recoger lo que los workers hayan decodificado
+ * 2. Reservar el storage de cada textura nueva (sin datos)
+ * 3. Subir filas en orden FIFO hasta agotar el presupuesto
+ */
+size_t TextureStreamer::Update(size_t byteBudget, std::vector<Completed>& completed) {
+    std::deque<Decoded> decoded;
+    {
+        std::lock_guard lock(m_Mutex);
+        decoded.swap(m_Decoded);
+    }
+
+    for (auto& item : decoded) {
+        if (!item.error.empty()) {
+            completed.push_back(Completed{item.ticket, 0, 0, 0, std::move(item.error)});
+            continue;
+        }
+
+        GLuint texture;
+        glGenTextures(1, &texture);
+        glBindTexture(GL_TEXTURE_2D, texture);
+        glTexImage2D(GL_TEXTURE_2D, 0, GL_RGBA,
+                     static_cast<GLsizei>(item.image.width), static_cast<GLsizei>(item.image.height),
+                     0, GL_RGBA, GL_UNSIGNED_BYTE, nullptr);
+        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_NEAREST);
+        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_NEAREST);
+        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);
+        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);
+
+        m_Uploads.push_back(Upload{item.ticket, std::move(item.image), texture, 0});
+    }
+
+    size_t remaining = byteBudget;
+    while (!m_Uploads.empty() && remaining > 0) {
+        Upload& upload = m_Uploads.front();
+        const size_t rowBytes = size_t{upload.image.width} * 4;
+
+        // Al menos una fila por frame para garantizar progreso
+        const uint32_t rowsLeft = upload.image.height - upload.rowsUploaded;
+        const auto rowsInBudget = static_cast<uint32_t>(std::min<size_t>(rowsLeft, remaining / rowBytes));
+        const uint32_t rows = std::max(rowsInBudget, 1u);
+
+        const size_t bytes = UploadRows(upload, rows);
+        remaining -= std::min(remaining, bytes);
+
+        if (upload.rowsUploaded == upload.image.height) {
+            completed.push_back(Completed{upload.ticket, upload.texture,
+                                          upload.image.width, upload.image.height, {}});
+            m_Uploads.pop_front();
+        }
+    }
+
+    glBindBuffer(GL_PIXEL_UNPACK_BUFFER, 0);
+    return byteBudget - remaining;
+}
+
+size_t TextureStreamer::UploadRows(Upload& upload, uint32_t rows) {
+    const size_t rowBytes = size_t{upload.image.width} * 4;
+    const size_t bytes = rowBytes * rows;
+    const uint8_t* source = upload.image.pixels.data() + rowBytes * upload.rowsUploaded;
+
+    // Orphaning: el driver nos da memoria nueva si la GPU aún lee la anterior
+    const GLuint pbo = m_PBOs[m_NextPBO];
+    m_NextPBO = (m_NextPBO + 1) % PBO_COUNT;
+
+    glBindBuffer(GL_PIXEL_UNPACK_BUFFER, pbo);
+    glBufferData(GL_PIXEL_UNPACK_BUFFER, static_cast<GLsizeiptr>(bytes), nullptr, GL_STREAM_DRAW);
+
+    void* mapped = glMapBufferRange(GL_PIXEL_UNPACK_BUFFER, 0, static_cast<GLsizeiptr>(bytes),
+                                    GL_MAP_WRITE_BIT | GL_MAP_INVALIDATE_BUFFER_BIT);
+    if (mapped != nullptr) {
+        std::memcpy(mapped, source, bytes);
+        glUnmapBuffer(GL_PIXEL_UNPACK_BUFFER);
+        source = nullptr;  // Con PBO enlazado, el puntero es un offset (0)
+    } else {
+        // Sin mapeo: subida directa desde memoria del cliente
+        glBindBuffer(GL_PIXEL_UNPACK_BUFFER, 0);
+    }
+
+    glBindTexture(GL_TEXTURE_2D, upload.texture);
+    glTexSubImage2D(GL_TEXTURE_2D, 0,
+                    0, static_cast<GLint>(upload.rowsUploaded),
+                    static_cast<GLsizei>(upload.image.width), static_cast<GLsizei>(rows),
+                    GL_RGBA, GL_UNSIGNED_BYTE, source);
+
+    upload.rowsUploaded += rows;
+    return bytes;
+}
+
+} // namespace MultiNinjaEspacial::Infrastructure::Rendering
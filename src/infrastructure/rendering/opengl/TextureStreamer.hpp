@@ -0,0 +1,147 @@
+// ============================================================================
+// Texture Streamer - Carga asíncrona de texturas
+// ============================================================================
+// Decodifica imágenes en hilos worker y las sube a la GPU a través de
+// pixel buffer objects, repartiendo la subida entre frames
+// ============================================================================
+
+#pragma once
+
+#include "../ImageDecoder.hpp"
+#include <GL/glew.h>
+#include <array>
+#include <condition_variable>
+#include <cstdint>
+#include <deque>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace MultiNinjaEspacial::Infrastructure::Rendering {
+
+/**
+ * @brief Cargador de texturas en segundo plano
+ *
+ * Pipeline:
+ * 1. Enqueue() (hilo de render) encola el path con un ticket
+ * 2. Un worker decodifica la imagen (stb_image) fuera del hilo de render
+ * 3. Update() (hilo de render, una vez por frame) sube filas de las imágenes
+ *    decodificadas vía PBO sin pasar de un presupuesto de bytes por frame.
+ *    Una textura grande se completa a lo largo de varios frames.
+ * 4. Las texturas terminadas se devuelven en la lista de Completed
+ *
+ * Todas las llamadas OpenGL ocurren en Update(), en el hilo del contexto.
+ *
+ * Ejemplo de uso:
+ * ```cpp
+ * TextureStreamer streamer;
+ * streamer.Initialize();
+ * streamer.Enqueue(ticket, "assets/sprites/player.png");
+ *
+ * // Cada frame:
+ * std::vector<TextureStreamer::Completed> done;
+ * streamer.Update(TextureStreamer::DEFAULT_UPLOAD_BUDGET, done);
+ * ```
+ */
+class TextureStreamer {
+public:
+    // Bytes subidos por frame por defecto (~4 texturas de 512x512)
+    static constexpr size_t DEFAULT_UPLOAD_BUDGET = 4 * 1024 * 1024;
+
+    // PBOs en rotación (mientras la GPU lee uno, escribimos en el otro)
+    static constexpr uint32_t PBO_COUNT = 2;
+
+    /**
+     * @brief Textura terminada (o fallida)
+     */
+    struct Completed {
+        uint32_t ticket{0};
+        GLuint texture{0};     // 0 si falló
+        uint32_t width{0};
+        uint32_t height{0};
+        std::string error;     // Motivo del fallo
+    };
+
+    TextureStreamer() = default;
+    ~TextureStreamer();
+
+    TextureStreamer(const TextureStreamer&) = delete;
+    TextureStreamer& operator=(const TextureStreamer&) = delete;
+
+    /**
+     * @brief Crea los PBOs y arranca los workers
+     * @param workerCount Hilos de decodificación (0 = automático)
+     * @return true si exitoso
+     */
+    bool Initialize(uint32_t workerCount = 0);
+
+    /**
+     * @brief Detiene los workers y libera los PBOs
+     *
+     * Las texturas a medio subir se destruyen; las peticiones pendientes
+     * se descartan sin notificar.
+     */
+    void Shutdown();
+
+    /**
+     * @brief Encola la carga de una imagen
+     * @param ticket Identificador que vuelve en Completed
+     * @param filepath Path al archivo de imagen
+     */
+    void Enqueue(uint32_t ticket, std::string filepath);
+
+    /**
+     * @brief Avanza las subidas pendientes (llamar una vez por frame)
+     * @param byteBudget Máximo de bytes a subir en esta llamada
+     * @param completed Se añaden aquí las texturas terminadas
+     * @return Bytes subidos en esta llamada
+     */
+    size_t Update(size_t byteBudget, std::vector<Completed>& completed);
+
+private:
+    struct Request {
+        uint32_t ticket;
+        std::string filepath;
+    };
+
+    struct Decoded {
+        uint32_t ticket;
+        DecodedImage image;
+        std::string error;  // Vacío si la decodificación fue bien
+    };
+
+    struct Upload {
+        uint32_t ticket;
+        DecodedImage image;
+        GLuint texture;
+        uint32_t rowsUploaded;
+    };
+
+    /**
+     * @brief Bucle de los hilos worker
+     */
+    void WorkerMain();
+
+    /**
+     * @brief Sube un tramo de filas de una textura a través de un PBO
+     * @return Bytes subidos
+     */
+    size_t UploadRows(Upload& upload, uint32_t rows);
+
+    // Compartido con los workers (protegido por m_Mutex)
+    std::mutex m_Mutex;
+    std::condition_variable m_Condition;
+    std::deque<Request> m_Requests;
+    std::deque<Decoded> m_Decoded;
+    bool m_Stop{false};
+
+    std::vector<std::thread> m_Workers;
+
+    // Solo hilo de render
+    std::deque<Upload> m_Uploads;
+    std::array<GLuint, PBO_COUNT> m_PBOs{};
+    uint32_t m_NextPBO{0};
+};
+
+} // namespace MultiNinjaEspacial::Infrastructure::Rendering
@@ -0,0 +1,46 @@
+// ============================================================================
+// Uniform Buffer - Implementación
+// ============================================================================
+
+#include "UniformBuffer.hpp"
+#include <spdlog/spdlog.h>
+
+namespace MultiNinjaEspacial::Infrastructure::Rendering {
+
+UniformBuffer::~UniformBuffer() {
+    Shutdown();
+}
+
+bool UniformBuffer::Initialize(size_t size, GLuint bindingPoint) {
+    m_Size = size;
+    m_BindingPoint = bindingPoint;
+
+    glGenBuffers(1, &m_Buffer);
+    glBindBuffer(GL_UNIFORM_BUFFER, m_Buffer);
+    glBufferData(GL_UNIFORM_BUFFER, static_cast<GLsizeiptr>(size), nullptr, GL_DYNAMIC_DRAW);
+    glBindBufferBase(GL_UNIFORM_BUFFER, bindingPoint, m_Buffer);
+    glBindBuffer(GL_UNIFORM_BUFFER, 0);
+
+    spdlog::debug("UniformBuffer creado ({} bytes, binding {})", size, bindingPoint);
+    return m_Buffer != 0;
+}
+
+void UniformBuffer::Shutdown() {
+    if (m_Buffer != 0) {
+        glDeleteBuffers(1, &m_Buffer);
+        m_Buffer = 0;
+    }
+}
+
+void UniformBuffer::Update(const void* data) {
+    glBindBuffer(GL_UNIFORM_BUFFER, m_Buffer);
+
+    // Orphaning + subida en una llamada: no esperamos a draws anteriores
+    glBufferData(GL_UNIFORM_BUFFER, static_cast<GLsizeiptr>(m_Size), data, GL_DYNAMIC_DRAW);
+
+    // El binding sobrevive al orphaning, pero otro código podría haberlo cambiado
+    glBindBufferBase(GL_UNIFORM_BUFFER, m_BindingPoint, m_Buffer);
+    glBindBuffer(GL_UNIFORM_BUFFER, 0);
+}
+
+} // namespace MultiNinjaEspacial::Infrastructure::Rendering
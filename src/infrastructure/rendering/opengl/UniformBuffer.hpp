@@ -0,0 +1,91 @@
+// ============================================================================
+// Uniform Buffer - Wrapper sobre OpenGL Uniform Buffer Objects
+// ============================================================================
+// Datos compartidos por todos los shaders (proyección, tiempo...) que se
+// suben una vez por frame en lugar de una vez por draw call
+// ============================================================================
+
+#pragma once
+
+#include <GL/glew.h>
+#include <glm/glm.hpp>
+#include <cstddef>
+#include <type_traits>
+
+namespace MultiNinjaEspacial::Infrastructure::Rendering {
+
+/**
+ * @brief Datos por frame (layout std140)
+ *
+ * Debe coincidir con el bloque declarado en los shaders:
+ * ```glsl
+ * layout (std140) uniform FrameData {
+ *     mat4 uProjection;
+ *     vec4 uTime;
+ * };
+ * ```
+ */
+struct FrameUniforms {
+    glm::mat4 projection{1.0f};
+    glm::vec4 time{0.0f};  // x = segundos desde el inicio, y = delta del frame
+};
+
+static_assert(sizeof(FrameUniforms) == 80, "FrameUniforms debe respetar el layout std140");
+
+// Binding point del bloque FrameData (GLSL 3.30 no admite layout(binding))
+inline constexpr GLuint FRAME_UNIFORMS_BINDING = 0;
+inline constexpr const char* FRAME_UNIFORMS_BLOCK = "FrameData";
+
+/**
+ * @brief Uniform buffer enlazado a un binding point fijo
+ *
+ * Ejemplo de uso:
+ * ```cpp
+ * UniformBuffer frameBuffer;
+ * frameBuffer.Initialize(sizeof(FrameUniforms), FRAME_UNIFORMS_BINDING);
+ * shader.BindUniformBlock(FRAME_UNIFORMS_BLOCK, FRAME_UNIFORMS_BINDING);
+ *
+ * // Una vez por frame:
+ * frameBuffer.Update(frameUniforms);
+ * ```
+ */
+class UniformBuffer {
+public:
+    UniformBuffer() = default;
+    ~UniformBuffer();
+
+    UniformBuffer(const UniformBuffer&) = delete;
+    UniformBuffer& operator=(const UniformBuffer&) = delete;
+
+    /**
+     * @brief Crea el buffer y lo enlaza a su binding point
+     * @param size Tamaño en bytes
+     * @param bindingPoint Índice de GL_UNIFORM_BUFFER
+     * @return true si exitoso
+     */
+    bool Initialize(size_t size, GLuint bindingPoint);
+
+    /**
+     * @brief Libera el buffer
+     */
+    void Shutdown();
+
+    /**
+     * @brief Reemplaza el contenido completo del buffer
+     * @param data Datos (size bytes del Initialize)
+     */
+    void Update(const void* data);
+
+    template <typename T>
+    void Update(const T& data) {
+        static_assert(std::is_trivially_copyable_v<T>);
+        Update(static_cast<const void*>(&data));
+    }
+
+private:
+    GLuint m_Buffer{0};
+    GLuint m_BindingPoint{0};
+    size_t m_Size{0};
+};
+
+} // namespace MultiNinjaEspacial::Infrastructure::Rendering
@@ -1,12 +1,200 @@
 // ============================================================================
-// Vertex Buffer - Implementación (STUB)
+// Vertex Buffer - Implementación
 // ============================================================================
 
 #include "VertexBuffer.hpp"
+#include <spdlog/spdlog.h>
 
 namespace MultiNinjaEspacial::Infrastructure::Rendering {
 
-// STUB: Implementación vacía por ahora
-// TODO: Implementar en Fase 1.1
+namespace {
+
+// Timeout de cada espera de fence (1 ms); se reintenta hasta que señalice
+constexpr GLuint64 FENCE_TIMEOUT_NS = 1'000'000;
+
+size_t AlignUp(size_t value, size_t alignment) {
+    return (value + alignment - 1) & ~(alignment - 1);
+}
+
+} // namespace
+
+VertexBuffer::~VertexBuffer() {
+    Shutdown();
+}
+
+bool VertexBuffer::Initialize(size_t bytesPerFrame, GLenum target) {
+    m_Target = target;
+    m_BytesPerFrame = AlignUp(bytesPerFrame, DEFAULT_ALIGNMENT);
+    m_Section = 0;
+    m_SectionOffset = 0;
+    m_SectionReady = false;
+
+    const auto totalBytes = static_cast<GLsizeiptr>(m_BytesPerFrame * FRAME_COUNT);
+
+    glGenBuffers(1, &m_Buffer);
+    glBindBuffer(m_Target, m_Buffer);
+
+    if (GLEW_VERSION_4_4 || GLEW_ARB_buffer_storage) {
+        // Storage inmutable mapeado una sola vez: la CPU escribe directamente
+        // en memoria visible por la GPU
+        const GLbitfield flags = GL_MAP_WRITE_BIT | GL_MAP_PERSISTENT_BIT | GL_MAP_COHERENT_BIT;
+        glBufferStorage(m_Target, totalBytes, nullptr, flags);
+        m_PersistentData = static_cast<unsigned char*>(
+            glMapBufferRange(m_Target, 0, totalBytes, flags));
+
+        if (m_PersistentData == nullptr) {
+            // Algunos drivers anuncian la extensión pero no el mapeo: recrear
+            // el buffer (el storage inmutable no admite glBufferData)
+            spdlog::warn("VertexBuffer: mapeo persistente no disponible, usando fallback");
+            glDeleteBuffers(1, &m_Buffer);
+            glGenBuffers(1, &m_Buffer);
+            glBindBuffer(m_Target, m_Buffer);
+            glBufferData(m_Target, totalBytes, nullptr, GL_STREAM_DRAW);
+        }
+    } else {
+        glBufferData(m_Target, totalBytes, nullptr, GL_STREAM_DRAW);
+    }
+
+    glBindBuffer(m_Target, 0);
+
+    spdlog::debug("VertexBuffer creado ({} x {} bytes, {})",
+                  FRAME_COUNT, m_BytesPerFrame, IsPersistent() ? "persistente" : "map unsynchronized");
+    return m_Buffer != 0;
+}
+
+void VertexBuffer::Shutdown() {
+    DeleteFences();
+
+    if (m_Buffer != 0) {
+        if (m_PersistentData != nullptr) {
+            glBindBuffer(m_Target, m_Buffer);
+            glUnmapBuffer(m_Target);
+            glBindBuffer(m_Target, 0);
+            m_PersistentData = nullptr;
+        }
+        glDeleteBuffers(1, &m_Buffer);
+        m_Buffer = 0;
+    }
+
+    m_BytesPerFrame = 0;
+    m_SectionOffset = 0;
+}
+
+bool VertexBuffer::Reserve(size_t bytesPerFrame) {
+    if (bytesPerFrame <= m_BytesPerFrame) {
+        return true;
+    }
+
+    // Potencia de 2 para amortizar crecimientos sucesivos
+    size_t newSize = m_BytesPerFrame > 0 ? m_BytesPerFrame : DEFAULT_ALIGNMENT;
+    while (newSize < bytesPerFrame) {
+        newSize *= 2;
+    }
+
+    // El driver retrasa el borrado real hasta que la GPU deja de usar el
+    // buffer viejo, así que no hace falta esperar a los fences
+    const GLenum target = m_Target;
+    Shutdown();
+    spdlog::debug("VertexBuffer ampliado a {} bytes por frame", newSize);
+    return Initialize(newSize, target);
+}
+
+VertexBuffer::Allocation VertexBuffer::Allocate(size_t bytes, size_t alignment) {
+    const size_t offset = AlignUp(m_SectionOffset, alignment);
+    if (m_Buffer == 0 || bytes == 0 || offset + bytes > m_BytesPerFrame) {
+        return {};
+    }
+
+    WaitForSection();
+
+    Allocation allocation;
+    allocation.offset = m_Section * m_BytesPerFrame + offset;
+    allocation.size = bytes;
+
+    if (m_PersistentData != nullptr) {
+        allocation.data = m_PersistentData + allocation.offset;
+    } else {
+        // El fence de la sección ya garantiza que la GPU no lee este rango
+        glBindBuffer(m_Target, m_Buffer);
+        allocation.data = glMapBufferRange(
+            m_Target,
+            static_cast<GLintptr>(allocation.offset),
+            static_cast<GLsizeiptr>(bytes),
+            GL_MAP_WRITE_BIT | GL_MAP_UNSYNCHRONIZED_BIT | GL_MAP_INVALIDATE_RANGE_BIT);
+
+        if (allocation.data == nullptr) {
+            glBindBuffer(m_Target, 0);
+            return {};
+        }
+    }
+
+    m_SectionOffset = offset + bytes;
+    return allocation;
+}
+
+void VertexBuffer::Commit(const Allocation& allocation) {
+    if (!allocation || m_PersistentData != nullptr) {
+        return;
+    }
+
+    glBindBuffer(m_Target, m_Buffer);
+    glUnmapBuffer(m_Target);
+    glBindBuffer(m_Target, 0);
+}
+
+void VertexBuffer::EndFrame() {
+    if (m_Buffer == 0 || !m_SectionReady) {
+        // Sección sin usar: no hay nada que proteger
+        return;
+    }
+
+    m_Fences[m_Section] = glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+    m_Section = (m_Section + 1) % FRAME_COUNT;
+    m_SectionOffset = 0;
+    m_SectionReady = false;
+}
+
+void VertexBuffer::Bind() const {
+    glBindBuffer(m_Target, m_Buffer);
+}
+
+void VertexBuffer::Unbind() const {
+    glBindBuffer(m_Target, 0);
+}
+
+void VertexBuffer::WaitForSection() {
+    if (m_SectionReady) {
+        return;
+    }
+    m_SectionReady = true;
+
+    GLsync& fence = m_Fences[m_Section];
+    if (fence == nullptr) {
+        return;
+    }
+
+    // Normalmente ya está señalizado; si no, la CPU va demasiado adelantada
+    GLenum result = glClientWaitSync(fence, 0, 0);
+    if (result == GL_TIMEOUT_EXPIRED) {
+        spdlog::trace("VertexBuffer: esperando a la GPU (sección {})", m_Section);
+        do {
+            result = glClientWaitSync(fence, GL_SYNC_FLUSH_COMMANDS_BIT, FENCE_TIMEOUT_NS);
+        } while (result == GL_TIMEOUT_EXPIRED);
+    }
+
+    glDeleteSync(fence);
+    fence = nullptr;
+}
+
+void VertexBuffer::DeleteFences() {
+    for (GLsync& fence : m_Fences) {
+        if (fence != nullptr) {
+            glDeleteSync(fence);
+            fence = nullptr;
+        }
+    }
+    m_Section = 0;
+    m_SectionReady = false;
+}
 
 } // namespace MultiNinjaEspacial::Infrastructure::Rendering
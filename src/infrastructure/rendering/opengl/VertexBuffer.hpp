@@ -1,28 +1,151 @@
 // ============================================================================
-// Vertex Buffer - Gestión de VBO/VAO (STUB)
+// Vertex Buffer - Buffer de streaming en anillo
 // ============================================================================
-// TODO: Implementar en Fase 1.1
+// Geometría dinámica (instancias de sprites, partículas, debug) escrita por
+// la CPU directamente en memoria mapeada, sin copias intermedias del driver
+// ni sincronizaciones implícitas
 // ============================================================================
 
 #pragma once
 
 #include <GL/glew.h>
+#include <array>
+#include <cstddef>
+#include <cstdint>
 
 namespace MultiNinjaEspacial::Infrastructure::Rendering {
 
 /**
- * @brief Wrapper sobre VBO/VAO de OpenGL
+ * @brief Buffer de vértices triple-buffered con fences
  *
- * STUB: Implementación mínima para compilar
- * TODO: Implementar completamente en Fase 1.1
+ * El buffer se divide en FRAME_COUNT secciones de bytesPerFrame. Cada frame
+ * escribe solo en su sección; al cerrarlo (EndFrame) se coloca un fence y
+ * se pasa a la siguiente. Antes de reutilizar una sección se espera su fence,
+ * que normalmente ya está señalizado (la GPU va como mucho 2 frames detrás).
+ *
+ * Dos modos según el driver:
+ * - Persistente (GL 4.4 / ARB_buffer_storage): glBufferStorage + un único
+ *   mapeo PERSISTENT | COHERENT que dura toda la vida del buffer.
+ * - Fallback (GL 3.3): glMapBufferRange UNSYNCHRONIZED por asignación; los
+ *   fences hacen el trabajo que el driver ya no hace.
+ *
+ * Ejemplo de uso:
+ * ```cpp
+ * VertexBuffer buffer;
+ * buffer.Initialize(64 * 1024);
+ *
+ * // Cada frame:
+ * auto allocation = buffer.Allocate(bytes);
+ * if (allocation) {
+ *     std::memcpy(allocation.data, vertices, bytes);
+ *     buffer.Commit(allocation);
+ *     // glVertexAttribPointer(..., (void*)allocation.offset) + draw
+ * }
+ * buffer.EndFrame();
+ * ```
  */
 class VertexBuffer {
 public:
+    // Secciones del anillo (frames que la CPU puede ir por delante de la GPU)
+    static constexpr uint32_t FRAME_COUNT = 3;
+
+    // Alineación por defecto de cada asignación (suficiente para vec4)
+    static constexpr size_t DEFAULT_ALIGNMENT = 16;
+
+    /**
+     * @brief Rango reservado dentro de la sección del frame actual
+     */
+    struct Allocation {
+        void* data{nullptr};    // Puntero de escritura (nullptr = no cabe)
+        size_t offset{0};       // Offset en bytes dentro del buffer de GL
+        size_t size{0};
+
+        explicit operator bool() const { return data != nullptr; }
+    };
+
     VertexBuffer() = default;
-    ~VertexBuffer() = default;
+    ~VertexBuffer();
+
+    VertexBuffer(const VertexBuffer&) = delete;
+    VertexBuffer& operator=(const VertexBuffer&) = delete;
+
+    /**
+     * @brief Crea el buffer (FRAME_COUNT * bytesPerFrame bytes)
+     * @param bytesPerFrame Capacidad de cada sección
+     * @param target Target de binding (GL_ARRAY_BUFFER por defecto)
+     * @return true si exitoso
+     *
+     * Requiere contexto OpenGL activo.
+     */
+    bool Initialize(size_t bytesPerFrame, GLenum target = GL_ARRAY_BUFFER);
+
+    /**
+     * @brief Libera buffer, mapeo y fences
+     */
+    void Shutdown();
+
+    /**
+     * @brief Recrea el buffer si bytesPerFrame supera la capacidad actual
+     * @return true si el buffer tiene al menos esa capacidad
+     *
+     * Las asignaciones del frame en curso dejan de ser válidas si crece.
+     */
+    bool Reserve(size_t bytesPerFrame);
+
+    /**
+     * @brief Reserva bytes en la sección del frame actual
+     * @param bytes Tamaño a escribir
+     * @param alignment Alineación del offset (potencia de 2)
+     * @return Rango mapeado, o vacío si la sección no tiene espacio
+     *
+     * La primera asignación de cada frame espera el fence de la sección.
+     */
+    [[nodiscard]] Allocation Allocate(size_t bytes, size_t alignment = DEFAULT_ALIGNMENT);
+
+    /**
+     * @brief Termina la escritura de una asignación
+     *
+     * No-op en modo persistente (mapeo coherente); en el fallback desmapea.
+     * Debe llamarse antes de dibujar con los datos.
+     */
+    void Commit(const Allocation& allocation);
+
+    /**
+     * @brief Coloca el fence de la sección actual y avanza el anillo
+     */
+    void EndFrame();
+
+    void Bind() const;
+    void Unbind() const;
+
+    [[nodiscard]] GLuint GetHandle() const { return m_Buffer; }
+    [[nodiscard]] size_t GetBytesPerFrame() const { return m_BytesPerFrame; }
+
+    /**
+     * @brief Indica si se usa el mapeo persistente (GL 4.4)
+     */
+    [[nodiscard]] bool IsPersistent() const { return m_PersistentData != nullptr; }
+
+private:
+    /**
+     * @brief Espera (si hace falta) a que la GPU termine con la sección actual
+     */
+    void WaitForSection();
+
+    void DeleteFences();
+
+    GLuint m_Buffer{0};
+    GLenum m_Target{GL_ARRAY_BUFFER};
+    size_t m_BytesPerFrame{0};
+
+    // Mapeo persistente (nullptr en el fallback)
+    unsigned char* m_PersistentData{nullptr};
 
-    void Bind() const {}
-    void Unbind() const {}
+    // Estado del anillo
+    uint32_t m_Section{0};
+    size_t m_SectionOffset{0};
+    bool m_SectionReady{false};
+    std::array<GLsync, FRAME_COUNT> m_Fences{};
 };
 
 } // namespace MultiNinjaEspacial::Infrastructure::Rendering
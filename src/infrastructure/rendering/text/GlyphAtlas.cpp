@@ -0,0 +1,121 @@
+// ============================================================================
+// Glyph Atlas - Implementación
+// ============================================================================
+
+// Única unidad de traducción con la implementación de stb_truetype
+#define STB_TRUETYPE_IMPLEMENTATION
+#include <stb_truetype.h>
+
+#include "GlyphAtlas.hpp"
+#include <spdlog/spdlog.h>
+#include <algorithm>
+#include <fstream>
+#include <iterator>
+
+namespace MultiNinjaEspacial::Infrastructure::Rendering {
+
+bool GlyphAtlas::Rasterize(const uint8_t* fontData, size_t fontSize, float pixelHeight, GlyphAtlas& out,
+                           uint32_t firstCodepoint, uint32_t lastCodepoint) {
+    // stb_truetype no conoce el tamaño: lee la tabla de offsets del sfnt sin
+    // comprobar nada, así que un archivo vacío o truncado se rechaza antes
+    if (fontData == nullptr || fontSize < SFNT_HEADER_SIZE) {
+        spdlog::error("GlyphAtlas: datos de fuente inválidos ({} bytes)", fontSize);
+        return false;
+    }
+
+    stbtt_fontinfo font;
+    const int fontOffset = stbtt_GetFontOffsetForIndex(fontData, 0);
+    if (fontOffset < 0 || !stbtt_InitFont(&font, fontData, fontOffset)) {
+        spdlog::error("GlyphAtlas: datos de fuente inválidos");
+        return false;
+    }
+    if (lastCodepoint < firstCodepoint) {
+        spdlog::error("GlyphAtlas: rango de caracteres vacío");
+        return false;
+    }
+
+    const int glyphCount = static_cast<int>(lastCodepoint - firstCodepoint + 1);
+    std::vector<stbtt_packedchar> packed(static_cast<size_t>(glyphCount));
+    std::vector<uint8_t> coverage;
+
+    // Probar tamaños crecientes hasta que quepan todos los glyphs
+    uint32_t size = 128;
+    bool fits = false;
+    for (; size <= MAX_ATLAS_SIZE && !fits; size *= 2) {
+        coverage.assign(size_t{size} * size, 0);
+
+        stbtt_pack_context context;
+        if (!stbtt_PackBegin(&context, coverage.data(), static_cast<int>(size), static_cast<int>(size),
+                             0, 1, nullptr)) {
+            break;
+        }
+        fits = stbtt_PackFontRange(&context, fontData, 0, pixelHeight,
+                                   static_cast<int>(firstCodepoint), glyphCount, packed.data()) != 0;
+        stbtt_PackEnd(&context);
+    }
+    if (!fits) {
+        spdlog::error("GlyphAtlas: los glyphs no caben en {}x{}", MAX_ATLAS_SIZE, MAX_ATLAS_SIZE);
+        return false;
+    }
+    size /= 2;  // El bucle avanza una vez tras el tamaño que funcionó
+
+    out = GlyphAtlas{};
+    out.width = size;
+    out.height = size;
+
+    // Blanco + cobertura en alfa: el color lo pone el tint del sprite
+    out.pixels.resize(coverage.size() * 4);
+    for (size_t i = 0; i < coverage.size(); ++i) {
+        out.pixels[i * 4 + 0] = 255;
+        out.pixels[i * 4 + 1] = 255;
+        out.pixels[i * 4 + 2] = 255;
+        out.pixels[i * 4 + 3] = coverage[i];
+    }
+
+    int ascent = 0;
+    int descent = 0;
+    int lineGap = 0;
+    stbtt_GetFontVMetrics(&font, &ascent, &descent, &lineGap);
+    const float scale = stbtt_ScaleForPixelHeight(&font, pixelHeight);
+    out.ascent = static_cast<float>(ascent) * scale;
+    out.lineHeight = static_cast<float>(ascent - descent + lineGap) * scale;
+
+    out.glyphs.reserve(packed.size());
+    for (int i = 0; i < glyphCount; ++i) {
+        const stbtt_packedchar& source = packed[static_cast<size_t>(i)];
+
+        GlyphInfo glyph;
+        glyph.codepoint = firstCodepoint + static_cast<uint32_t>(i);
+        glyph.x = source.x0;
+        glyph.y = source.y0;
+        glyph.width = static_cast<uint32_t>(source.x1 - source.x0);
+        glyph.height = static_cast<uint32_t>(source.y1 - source.y0);
+        glyph.offsetX = source.xoff;
+        glyph.offsetY = source.yoff;
+        glyph.advance = source.xadvance;
+        out.glyphs.push_back(glyph);
+    }
+
+    spdlog::info("GlyphAtlas: {} glyphs a {}px en {}x{} ({} KB)",
+                 glyphCount, pixelHeight, size, size, out.pixels.size() / 1024);
+    return true;
+}
+
+bool GlyphAtlas::LoadFile(const std::string& path, float pixelHeight, GlyphAtlas& out) {
+    std::ifstream file(path, std::ios::binary);
+    if (!file.is_open()) {
+        spdlog::error("No se pudo abrir la fuente: {}", path);
+        return false;
+    }
+
+    const std::vector<uint8_t> data((std::istreambuf_iterator<char>(file)), std::istreambuf_iterator<char>());
+    return Rasterize(data.data(), data.size(), pixelHeight, out);
+}
+
+const GlyphInfo* GlyphAtlas::FindGlyph(uint32_t codepoint) const {
+    auto it = std::lower_bound(glyphs.begin(), glyphs.end(), codepoint,
+                               [](const GlyphInfo& glyph, uint32_t value) { return glyph.codepoint < value; });
+    return (it != glyphs.end() && it->codepoint == codepoint) ? &*it : nullptr;
+}
+
+} // namespace MultiNinjaEspacial::Infrastructure::Rendering
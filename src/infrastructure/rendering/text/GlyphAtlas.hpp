@@ -0,0 +1,96 @@
+// ============================================================================
+// Glyph Atlas - Rasterización de fuentes en un atlas
+// ============================================================================
+// Convierte una fuente TrueType en una imagen RGBA con todos sus glyphs y
+// las métricas para colocarlos. Independiente de la API gráfica: la subida
+// a la GPU la hace TextRenderer a través de IRenderer
+// ============================================================================
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace MultiNinjaEspacial::Infrastructure::Rendering {
+
+/**
+ * @brief Un glyph dentro del atlas
+ */
+struct GlyphInfo {
+    uint32_t codepoint{0};
+    uint32_t x{0};              // Rectángulo en la imagen del atlas (px)
+    uint32_t y{0};
+    uint32_t width{0};          // 0 = glyph sin píxeles (espacio)
+    uint32_t height{0};
+    float offsetX{0.0f};        // Desde la pluma (en la baseline) a la esquina superior izquierda
+    float offsetY{0.0f};
+    float advance{0.0f};        // Avance horizontal de la pluma
+};
+
+/**
+ * @brief Imagen + métricas de una fuente rasterizada a un tamaño
+ *
+ * Los glyphs se rasterizan una sola vez (al cargar). Los píxeles son
+ * blancos con la cobertura en el alfa, así que el color del texto es el
+ * tint del sprite.
+ *
+ * Ejemplo de uso:
+ * ```cpp
+ * GlyphAtlas atlas;
+ * if (GlyphAtlas::LoadFile("assets/fonts/hud.ttf", 24.0f, atlas)) {
+ *     textRenderer.AddFont(renderer, "hud", std::move(atlas));
+ * }
+ * ```
+ */
+struct GlyphAtlas {
+    // Rango por defecto: ASCII imprimible + Latin-1 (á, é, ñ, ¿, ¡...)
+    static constexpr uint32_t DEFAULT_FIRST_CODEPOINT = 32;
+    static constexpr uint32_t DEFAULT_LAST_CODEPOINT = 255;
+
+    // Lado máximo de la imagen al buscar un tamaño en el que quepan los glyphs
+    static constexpr uint32_t MAX_ATLAS_SIZE = 4096;
+
+    // Tabla de offsets del sfnt: lo mínimo que lee stb_truetype de un .ttf
+    static constexpr size_t SFNT_HEADER_SIZE = 12;
+
+    uint32_t width{0};
+    uint32_t height{0};
+    std::vector<uint8_t> pixels;    // RGBA8
+    std::vector<GlyphInfo> glyphs;  // Ordenados por codepoint
+
+    float ascent{0.0f};             // Baseline respecto a la parte superior de la línea
+    float lineHeight{0.0f};         // Avance vertical entre líneas
+
+    /**
+     * @brief Rasteriza una fuente TrueType en memoria
+     * @param fontData Contenido del .ttf
+     * @param fontSize Tamaño en bytes
+     * @param pixelHeight Altura de la fuente en píxeles
+     * @param out Atlas resultante
+     * @param firstCodepoint Primer carácter a incluir
+     * @param lastCodepoint Último carácter a incluir
+     * @return true si exitoso (false si los datos están vacíos o truncados)
+     */
+    static bool Rasterize(const uint8_t* fontData, size_t fontSize, float pixelHeight, GlyphAtlas& out,
+                          uint32_t firstCodepoint = DEFAULT_FIRST_CODEPOINT,
+                          uint32_t lastCodepoint = DEFAULT_LAST_CODEPOINT);
+
+    /**
+     * @brief Lee y rasteriza un archivo .ttf
+     * @param path Ruta del archivo
+     * @param pixelHeight Altura de la fuente en píxeles
+     * @param out Atlas resultante
+     * @return true si exitoso
+     */
+    static bool LoadFile(const std::string& path, float pixelHeight, GlyphAtlas& out);
+
+    /**
+     * @brief Busca un glyph (búsqueda binaria; solo en tiempo de carga)
+     * @return nullptr si el codepoint no está en el atlas
+     */
+    [[nodiscard]] const GlyphInfo* FindGlyph(uint32_t codepoint) const;
+};
+
+} // namespace MultiNinjaEspacial::Infrastructure::Rendering
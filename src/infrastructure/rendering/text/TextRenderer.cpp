@@ -0,0 +1,200 @@
+// ============================================================================
+// Text Renderer - Implementación
+// ============================================================================
+
+#include "TextRenderer.hpp"
+#include <spdlog/spdlog.h>
+#include <algorithm>
+
+namespace MultiNinjaEspacial::Infrastructure::Rendering {
+
+namespace {
+
+constexpr uint32_t REPLACEMENT_CODEPOINT = '?';
+
+/**
+ * @brief Decodifica el siguiente codepoint UTF-8 y avanza el cursor
+ *
+ * Secuencias inválidas devuelven REPLACEMENT_CODEPOINT y avanzan un byte.
+ */
+uint32_t NextCodepoint(std::string_view text, size_t& cursor) {
+    const auto lead = static_cast<uint8_t>(text[cursor++]);
+    if (lead < 0x80) {
+        return lead;
+    }
+
+    size_t extra = 0;
+    uint32_t codepoint = 0;
+    if ((lead & 0xE0) == 0xC0) {
+        extra = 1;
+        codepoint = lead & 0x1F;
+    } else if ((lead & 0xF0) == 0xE0) {
+        extra = 2;
+        codepoint = lead & 0x0F;
+    } else if ((lead & 0xF8) == 0xF0) {
+        extra = 3;
+        codepoint = lead & 0x07;
+    } else {
+        return REPLACEMENT_CODEPOINT;
+    }
+
+    if (cursor + extra > text.size()) {
+        cursor = text.size();
+        return REPLACEMENT_CODEPOINT;
+    }
+    for (size_t i = 0; i < extra; ++i) {
+        const auto next = static_cast<uint8_t>(text[cursor]);
+        if ((next & 0xC0) != 0x80) {
+            return REPLACEMENT_CODEPOINT;
+        }
+        codepoint = (codepoint << 6) | (next & 0x3F);
+        cursor++;
+    }
+    return codepoint;
+}
+
+} // namespace
+
+TextRenderer::FontId TextRenderer::AddFont(IRenderer& renderer, const std::string& id, GlyphAtlas atlas) {
+    if (FindFont(id) != INVALID_FONT) {
+        spdlog::error("TextRenderer: la fuente '{}' ya existe", id);
+        return INVALID_FONT;
+    }
+    if (atlas.glyphs.empty()) {
+        spdlog::error("TextRenderer: la fuente '{}' no tiene glyphs", id);
+        return INVALID_FONT;
+    }
+
+    Font font;
+    font.id = id;
+    font.ascent = atlas.ascent;
+    font.lineHeight = atlas.lineHeight;
+    font.page = renderer.CreateTexture(id + "#atlas", atlas.width, atlas.height, atlas.pixels.data());
+    if (!font.page.IsValid()) {
+        spdlog::error("TextRenderer: no se pudo subir el atlas de '{}'", id);
+        return INVALID_FONT;
+    }
+
+    // Tabla densa por codepoint: sin búsquedas al maquetar
+    font.firstCodepoint = atlas.glyphs.front().codepoint;
+    font.glyphs.resize(atlas.glyphs.back().codepoint - font.firstCodepoint + 1);
+
+    for (const GlyphInfo& info : atlas.glyphs) {
+        Glyph& glyph = font.glyphs[info.codepoint - font.firstCodepoint];
+        glyph.offset = {info.offsetX, info.offsetY};
+        glyph.size = {static_cast<float>(info.width), static_cast<float>(info.height)};
+        glyph.advance = info.advance;
+
+        if (info.width > 0 && info.height > 0) {
+            glyph.texture = renderer.CreateTextureRegion(id + "#" + std::to_string(info.codepoint),
+                                                         font.page, info.x, info.y, info.width, info.height);
+        }
+    }
+
+    m_Stats.atlasBytes += atlas.pixels.size();
+    spdlog::info("TextRenderer: fuente '{}' ({} glyphs, atlas {}x{})",
+                 id, atlas.glyphs.size(), atlas.width, atlas.height);
+
+    m_Fonts.push_back(std::move(font));
+    return static_cast<FontId>(m_Fonts.size() - 1);
+}
+
+TextRenderer::FontId TextRenderer::FindFont(const std::string& id) const {
+    for (size_t i = 0; i < m_Fonts.size(); ++i) {
+        if (m_Fonts[i].id == id) {
+            return static_cast<FontId>(i);
+        }
+    }
+    return INVALID_FONT;
+}
+
+void TextRenderer::DrawString(IRenderer& renderer, FontId font, std::string_view text,
+                              const glm::vec2& position, const glm::vec4& color, float scale) {
+    if (font >= m_Fonts.size() || text.empty()) {
+        return;
+    }
+
+    const Run& run = GetRun(font, text);
+    for (const RunGlyph& glyph : run.glyphs) {
+        renderer.DrawSprite(glyph.texture, position + glyph.offset * scale, glyph.size * scale, 0.0f, color);
+    }
+    m_Stats.glyphsDrawn += run.glyphs.size();
+}
+
+glm::vec2 TextRenderer::MeasureString(FontId font, std::string_view text, float scale) {
+    if (font >= m_Fonts.size() || text.empty()) {
+        return glm::vec2{0.0f};
+    }
+    return GetRun(font, text).extent * scale;
+}
+
+void TextRenderer::ClearCache() {
+    m_Runs.clear();
+    m_Stats.cacheBytes = 0;
+}
+
+void TextRenderer::ResetStats() {
+    m_Stats.runHits = 0;
+    m_Stats.runMisses = 0;
+    m_Stats.glyphsDrawn = 0;
+}
+
+const TextRenderer::Run& TextRenderer::GetRun(FontId font, std::string_view text) {
+    // Clave = 4 bytes de FontId + texto (la string se reutiliza entre llamadas)
+    m_KeyScratch.assign(reinterpret_cast<const char*>(&font), sizeof(font));
+    m_KeyScratch.append(text);
+
+    auto it = m_Runs.find(m_KeyScratch);
+    if (it != m_Runs.end()) {
+        m_Stats.runHits++;
+        return it->second;
+    }
+
+    m_Stats.runMisses++;
+    if (m_Runs.size() >= MAX_CACHED_RUNS) {
+        ClearCache();
+    }
+
+    Run run;
+    LayoutRun(m_Fonts[font], text, run);
+    m_Stats.cacheBytes += m_KeyScratch.size() + run.glyphs.size() * sizeof(RunGlyph) + sizeof(Run);
+
+    return m_Runs.emplace(m_KeyScratch, std::move(run)).first->second;
+}
+
+void TextRenderer::LayoutRun(const Font& font, std::string_view text, Run& run) const {
+    // La pluma avanza por la baseline; la primera línea empieza a 'ascent'
+    glm::vec2 pen{0.0f, font.ascent};
+    float width = 0.0f;
+
+    size_t cursor = 0;
+    while (cursor < text.size()) {
+        uint32_t codepoint = NextCodepoint(text, cursor);
+
+        if (codepoint == '\n') {
+            width = std::max(width, pen.x);
+            pen.x = 0.0f;
+            pen.y += font.lineHeight;
+            continue;
+        }
+
+        // Fuera del atlas: '?' si existe, si no se ignora
+        if (codepoint < font.firstCodepoint || codepoint - font.firstCodepoint >= font.glyphs.size()) {
+            codepoint = REPLACEMENT_CODEPOINT;
+            if (codepoint < font.firstCodepoint || codepoint - font.firstCodepoint >= font.glyphs.size()) {
+                continue;
+            }
+        }
+
+        const Glyph& glyph = font.glyphs[codepoint - font.firstCodepoint];
+        if (glyph.texture.IsValid()) {
+            run.glyphs.push_back({glyph.texture, pen + glyph.offset, glyph.size});
+        }
+        pen.x += glyph.advance;
+    }
+
+    width = std::max(width, pen.x);
+    run.extent = {width, pen.y - font.ascent + font.lineHeight};
+}
+
+} // namespace MultiNinjaEspacial::Infrastructure::Rendering
@@ -0,0 +1,162 @@
+// ============================================================================
+// Text Renderer - Texto con atlas de glyphs y batching de sprites
+// ============================================================================
+// Dibuja texto (números de daño, HUD) como sprites de glyph sobre
+// cualquier IRenderer. Todos los glyphs de una fuente comparten textura,
+// así que el texto de todo el frame cae en el mismo batch
+// ============================================================================
+
+#pragma once
+
+#include "../IRenderer.hpp"
+#include "GlyphAtlas.hpp"
+#include <glm/glm.hpp>
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+namespace MultiNinjaEspacial::Infrastructure::Rendering {
+
+/**
+ * @brief Renderer de texto sobre IRenderer
+ *
+ * Funcionamiento:
+ * - AddFont() sube la imagen del GlyphAtlas una vez (CreateTexture) y
+ *   registra cada glyph como región de esa textura (CreateTextureRegion).
+ * - DrawString() coloca los glyphs de la cadena (un "run") y los envía como
+ *   sprites. Los runs se cachean por (fuente, texto): un "125" que flota
+ *   durante 60 frames se maqueta una sola vez.
+ * - Como todas las regiones comparten página, cientos de textos con la
+ *   misma fuente cuestan un draw call.
+ *
+ * El texto admite UTF-8 (rango del atlas, por defecto Latin-1) y '\n'.
+ *
+ * Ejemplo de uso:
+ * ```cpp
+ * TextRenderer text;
+ * GlyphAtlas atlas;
+ * GlyphAtlas::LoadFile("assets/fonts/hud.ttf", 24.0f, atlas);
+ * auto font = text.AddFont(renderer, "hud", std::move(atlas));
+ *
+ * // Cada frame
+ * text.DrawString(renderer, font, "125", {400, 300}, {1, 0.2f, 0.2f, 1});
+ * ```
+ */
+class TextRenderer {
+public:
+    using FontId = uint32_t;
+    static constexpr FontId INVALID_FONT = 0xFFFFFFFFu;
+
+    // Runs cacheados antes de vaciar la cache (los textos de combate cambian
+    // mucho; vaciar de golpe es más barato que mantener un LRU)
+    static constexpr size_t MAX_CACHED_RUNS = 2048;
+
+    /**
+     * @brief Métricas acumuladas (ver ResetStats)
+     */
+    struct Stats {
+        uint64_t runHits{0};        // DrawString servidos desde la cache
+        uint64_t runMisses{0};      // DrawString que tuvieron que maquetar
+        uint64_t glyphsDrawn{0};    // Sprites de glyph enviados
+        uint64_t atlasBytes{0};     // Memoria de las texturas de fuentes
+        uint64_t cacheBytes{0};     // Memoria aproximada de los runs cacheados
+    };
+
+    /**
+     * @brief Registra una fuente y sube su atlas
+     * @param renderer Renderer donde se crea la textura
+     * @param id ID de la fuente (prefijo de las texturas creadas)
+     * @param atlas Atlas rasterizado (los píxeles se liberan tras subirlo)
+     * @return FontId o INVALID_FONT
+     */
+    FontId AddFont(IRenderer& renderer, const std::string& id, GlyphAtlas atlas);
+
+    /**
+     * @brief Busca una fuente por ID (fuera del path de render)
+     */
+    [[nodiscard]] FontId FindFont(const std::string& id) const;
+
+    /**
+     * @brief Dibuja una cadena
+     * @param renderer Renderer destino
+     * @param font Fuente
+     * @param text Texto en UTF-8
+     * @param position Esquina superior izquierda del texto
+     * @param color Color (tint de los glyphs)
+     * @param scale Escala sobre el tamaño rasterizado
+     */
+    void DrawString(IRenderer& renderer, FontId font, std::string_view text,
+                    const glm::vec2& position, const glm::vec4& color, float scale = 1.0f);
+
+    /**
+     * @brief Tamaño que ocupará una cadena (usa la misma cache que DrawString)
+     */
+    [[nodiscard]] glm::vec2 MeasureString(FontId font, std::string_view text, float scale = 1.0f);
+
+    /**
+     * @brief Vacía la cache de runs
+     */
+    void ClearCache();
+
+    [[nodiscard]] const Stats& GetStats() const { return m_Stats; }
+
+    /**
+     * @brief Resetea hits/misses/glyphs (la memoria se mantiene)
+     */
+    void ResetStats();
+
+    [[nodiscard]] size_t GetCachedRunCount() const { return m_Runs.size(); }
+
+private:
+    /**
+     * @brief Glyph listo para dibujar (métricas del atlas + su región)
+     */
+    struct Glyph {
+        TextureHandle texture;      // Inválido = sin píxeles (espacio)
+        glm::vec2 offset{0.0f};
+        glm::vec2 size{0.0f};
+        float advance{0.0f};
+    };
+
+    struct Font {
+        std::string id;
+        TextureHandle page;
+        uint32_t firstCodepoint{0};
+        std::vector<Glyph> glyphs;  // Indexado por codepoint - firstCodepoint
+        float ascent{0.0f};
+        float lineHeight{0.0f};
+    };
+
+    /**
+     * @brief Glyph colocado dentro de un run (relativo a su origen, sin escala)
+     */
+    struct RunGlyph {
+        TextureHandle texture;
+        glm::vec2 offset;
+        glm::vec2 size;
+    };
+
+    struct Run {
+        std::vector<RunGlyph> glyphs;
+        glm::vec2 extent{0.0f};
+    };
+
+    /**
+     * @brief Devuelve el run de (fuente, texto), maquetándolo si no está cacheado
+     */
+    const Run& GetRun(FontId font, std::string_view text);
+
+    /**
+     * @brief Coloca los glyphs de una cadena
+     */
+    void LayoutRun(const Font& font, std::string_view text, Run& run) const;
+
+    std::vector<Font> m_Fonts;
+    std::unordered_map<std::string, Run> m_Runs;
+    std::string m_KeyScratch;   // Clave de búsqueda reutilizada (sin asignar por frame)
+    Stats m_Stats;
+};
+
+} // namespace MultiNinjaEspacial::Infrastructure::Rendering
@@ -4,8 +4,14 @@
 
 #include "GameLoop.hpp"
 #include "../core/systems/MovementSystem.hpp"
+#include "../core/systems/InterpolationSystem.hpp"
+#include "../core/components/Transform.hpp"
+#include "../core/components/Velocity.hpp"
+#include "../core/components/PreviousTransform.hpp"
+#include "../core/components/ParticleEmitter.hpp"
 #include <spdlog/spdlog.h>
-#include <thread>
+#include <cmath>
+#include <string>
 
 namespace MultiNinjaEspacial::Presentation {
 
@@ -29,8 +35,20 @@ bool GameLoop::Initialize(
 
     m_Window = window;
     m_Renderer = renderer;
+    m_FrameRenderer = renderer;
     m_Registry = registry;
 
+    // Sin definiciones el juego funciona igual, solo sin partículas
+    if (m_ParticleSystem.LoadDefinitions(PARTICLE_DEFINITIONS_PATH)) {
+        m_ParticleSystem.ResolveTextures(*m_Renderer);
+    } else {
+        spdlog::warn("GameLoop: sin definiciones de partículas");
+    }
+
+    if (m_Scheduler.GetSystemCount() == 0) {
+        RegisterSystems();
+    }
+
     m_LastFrameTime = Clock::now();
     m_LastFPSUpdate = Clock::now();
 
@@ -49,11 +67,21 @@ void GameLoop::Run() {
     spdlog::info("━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━");
     spdlog::info("Iniciando Game Loop");
     spdlog::info("Target FPS: {}", m_TargetFPS);
-    spdlog::info("Fixed Timestep: {:.6f}s ({} Hz)", FIXED_TIMESTEP, static_cast<int>(1.0f / FIXED_TIMESTEP));
+    spdlog::info("Fixed Timestep: {:.6f}s ({} Hz)", m_FixedTimestep, std::lround(1.0f / m_FixedTimestep));
+    spdlog::info("Render thread: {}", m_RenderThreadEnabled ? "sí" : "no");
     spdlog::info("━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━");
 
+    if (m_RenderThreadEnabled) {
+        StartRenderThread();
+    }
+
+    // Con VSync los frames se alinean a los vblank (el hilo de render hace
+    // el swap en otro hilo: ahí no hay estimación de fase)
+    m_FramePacer.SetRefreshRate(m_Window->IsVSyncEnabled() ? m_Window->GetRefreshRate() : 0.0f);
+
     m_Running = true;
     m_LastFrameTime = Clock::now();
+    m_FramePacer.Reset();
 
     // ━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━
     // MAIN GAME LOOP
@@ -86,48 +114,50 @@ void GameLoop::Run() {
 
         // Ejecutar updates a timestep fijo
         // Esto garantiza física determinista y estable
-        while (m_Accumulator >= FIXED_TIMESTEP) {
-            Update(FIXED_TIMESTEP);
-            m_Accumulator -= FIXED_TIMESTEP;
+        while (m_Accumulator >= m_FixedTimestep) {
+            Update(m_FixedTimestep);
+            m_Accumulator -= m_FixedTimestep;
         }
 
         // ─────────────────────────────────────────────────────────────────
-        // 4. Renderizar
+        // 4. Renderizar (con hilo de render: solo grabar y entregar)
         // ─────────────────────────────────────────────────────────────────
+        // Lo que sobra en el acumulador es la fracción del siguiente paso
+        // que ya ha pasado: se dibuja esa fracción entre el paso anterior y
+        // el actual (un paso de latencia a cambio de movimiento suave)
+        m_RenderSystem.SetInterpolationAlpha(m_Accumulator / m_FixedTimestep);
         Render();
 
         // ─────────────────────────────────────────────────────────────────
-        // 5. Swap Buffers y Present
+        // 5. Swap Buffers y Present (con hilo de render lo hace él)
         // ─────────────────────────────────────────────────────────────────
-        m_Window->SwapBuffers();
+        if (!m_RenderThread.IsRunning()) {
+            m_Window->SwapBuffers();
 
-        // ─────────────────────────────────────────────────────────────────
-        // 6. Frame Limiting (si no hay VSync)
-        // ─────────────────────────────────────────────────────────────────
-        if (m_TargetFPS > 0) {
-            TimePoint frameEnd = Clock::now();
-            Duration frameDuration = frameEnd - currentTime;
-            float frameTime = frameDuration.count();
-
-            // Si el frame terminó antes del target, esperar
-            if (frameTime < m_TargetFrameTime) {
-                float sleepTime = m_TargetFrameTime - frameTime;
-                std::this_thread::sleep_for(
-                    std::chrono::duration<float>(sleepTime)
-                );
+            // Con VSync el swap vuelve justo tras el vblank: afina su fase
+            if (m_Window->IsVSyncEnabled()) {
+                m_FramePacer.NotifyVBlank();
             }
         }
 
+        // ─────────────────────────────────────────────────────────────────
+        // 6. Frame Limiting (sleep grueso + espera activa hasta el deadline)
+        // ─────────────────────────────────────────────────────────────────
+        m_FramePacer.Wait();
+
         // ─────────────────────────────────────────────────────────────────
         // 7. Calcular FPS
         // ─────────────────────────────────────────────────────────────────
         CalculateFPS();
     }
 
+    StopRenderThread();
+
     spdlog::info("Game Loop terminado");
 }
 
 void GameLoop::Shutdown() {
+    StopRenderThread();
     m_Running = false;
     m_Initialized = false;
     spdlog::info("GameLoop cerrado");
@@ -135,12 +165,62 @@ void GameLoop::Shutdown() {
 
 void GameLoop::SetTargetFPS(int targetFPS) {
     m_TargetFPS = targetFPS;
-    if (targetFPS > 0) {
-        m_TargetFrameTime = 1.0f / static_cast<float>(targetFPS);
-    }
+    m_FramePacer.SetTargetFPS(targetFPS);
     spdlog::info("Target FPS configurado a {}", targetFPS);
 }
 
+void GameLoop::SetSimulationRate(int hz) {
+    if (hz <= 0) {
+        spdlog::error("GameLoop::SetSimulationRate - Frecuencia inválida: {}", hz);
+        return;
+    }
+
+    m_FixedTimestep = 1.0f / static_cast<float>(hz);
+    m_Accumulator = 0.0f;
+    spdlog::info("Simulación configurada a {} Hz", hz);
+}
+
+void GameLoop::SetDynamicResolution(bool enabled, float gpuBudget) {
+    m_DynamicResolutionEnabled = enabled;
+    m_DynamicResolution.SetGpuBudget(gpuBudget);
+    m_DynamicResolution.Reset();
+
+    if (m_FrameRenderer != nullptr) {
+        m_FrameRenderer->SetResolutionScale(1.0f);
+    }
+    spdlog::info("Resolución dinámica: {} (presupuesto GPU {:.2f}ms)", enabled ? "sí" : "no", gpuBudget);
+}
+
+void GameLoop::StartRenderThread() {
+    SDL_Window* window = m_Window->GetSDLWindow();
+    SDL_GLContext context = m_Window->GetGLContext();
+
+    Infrastructure::Rendering::RenderThread::Hooks hooks;
+    hooks.makeCurrent = [window, context] { SDL_GL_MakeCurrent(window, context); };
+    hooks.releaseCurrent = [window] { SDL_GL_MakeCurrent(window, nullptr); };
+    hooks.swapBuffers = [this] { m_Window->SwapBuffers(); };
+
+    // Un contexto solo puede estar activo en un hilo
+    SDL_GL_MakeCurrent(window, nullptr);
+
+    if (m_RenderThread.Start(*m_Renderer, std::move(hooks))) {
+        m_FrameRenderer = &m_RenderThread.GetRecorder();
+    } else {
+        SDL_GL_MakeCurrent(window, context);
+    }
+}
+
+void GameLoop::StopRenderThread() {
+    if (!m_RenderThread.IsRunning()) {
+        return;
+    }
+
+    m_RenderThread.Stop();
+    m_FrameRenderer = m_Renderer;
+
+    SDL_GL_MakeCurrent(m_Window->GetSDLWindow(), m_Window->GetGLContext());
+}
+
 void GameLoop::ProcessInput() {
     // Procesar eventos de SDL
     m_Window->PollEvents();
@@ -150,56 +230,106 @@ void GameLoop::ProcessInput() {
 }
 
 void GameLoop::Update(float deltaTime) {
-    // ━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━
-    // ACTUALIZACIÓN DE SISTEMAS (en orden de dependencias)
-    // ━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━
+    // Sistemas en paralelo según sus accesos (ver RegisterSystems). Run
+    // vuelve cuando han terminado todos: punto de sincronización antes
+    // del siguiente paso y del render
+    m_Scheduler.Run(m_Registry->GetNative(), deltaTime);
 
-    auto& registry = m_Registry->GetNative();
-
-    // 1. Sistema de Movimiento (actualiza Transform basándose en Velocity)
-    Core::Systems::MovementSystem::Update(registry, deltaTime);
-
-    // TODO: 2. Sistema de Colisiones
-    // TODO: 3. Sistema de IA
-    // TODO: 4. Sistema de Networking (sincronización)
-    // TODO: 5. Sistema de Audio
-    // TODO: 6. Sistema de Partículas
+    // Lo que los sistemas han creado o destruido (ver GetCommands)
+    m_Commands.Playback(m_Registry->GetNative());
 
     // NOTA: RenderSystem NO va aquí, va en Render()
 }
 
+/**
+ * @brief Registra los sistemas de simulación con sus accesos
+ *
+ * Entre sistemas que chocan manda el orden de registro, así que el orden
+ * de abajo es el orden lógico del paso. Los que no chocan (p. ej. audio o
+ * red frente a partículas) se ejecutan a la vez.
+ */
+void GameLoop::RegisterSystems() {
+    using namespace Core::Components;
+    using namespace Core::Systems;
+
+    // 1. Estado anterior de lo que se mueve, para interpolar en el render
+    //    (añade PreviousTransform a las entidades nuevas con Velocity; no
+    //    necesita Structural: solo toca el pool de PreviousTransform, que
+    //    Run crea antes de repartir)
+    m_Scheduler.AddSystem("Interpolation", [](entt::registry& registry, float) {
+        InterpolationSystem::Snapshot(registry);
+    })
+        .Reads<Transform, Velocity>()
+        .Writes<PreviousTransform>();
+
+    // 2. Sistema de Movimiento (actualiza Transform basándose en Velocity;
+    //    con muchas entidades, repartido en trozos entre los workers)
+    m_Scheduler.AddSystem("Movement", [this](entt::registry& registry, float deltaTime) {
+        MovementSystem::Update(registry, deltaTime, m_JobSystem);
+    })
+        .Reads<Velocity>()
+        .Writes<Transform>();
+
+    // TODO: 3. Sistema de Colisiones  (Reads<Transform, Collider>, Writes<Velocity>)
+    // TODO: 4. Sistema de IA          (Reads<Transform>, Writes<Velocity>)
+    // TODO: 5. Sistema de Networking  (Reads<Transform, NetworkEntity>; MainThread si usa ENet)
+    // TODO: 6. Sistema de Audio
+
+    // 7. Sistema de Partículas (emisores continuos + simulación SoA)
+    m_Scheduler.AddSystem("Particles", [this](entt::registry& registry, float deltaTime) {
+        m_ParticleSystem.Update(registry, deltaTime);
+    })
+        .Reads<Transform>()
+        .Writes<ParticleEmitter>();
+}
+
 void GameLoop::Render() {
     // Limpiar pantalla
-    m_Renderer->Clear(glm::vec4{0.1f, 0.1f, 0.15f, 1.0f});
+    m_FrameRenderer->Clear(glm::vec4{0.1f, 0.1f, 0.15f, 1.0f});
 
     // ━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━
     // RENDERIZADO DE ENTIDADES
     // ━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━
 
-    // TODO: Implementar RenderSystem
-    // TODO: Ordenar entidades por layer
-    // TODO: Frustum culling (solo dibujar lo visible)
-    // TODO: Batch rendering (agrupar draws)
-
-    // Por ahora, ejemplo básico:
-    // auto view = m_Registry->GetNative().view<Core::Components::Transform, Core::Components::Renderable>();
-    // for (auto entity : view) {
-    //     auto& transform = view.get<Core::Components::Transform>(entity);
-    //     auto& renderable = view.get<Core::Components::Renderable>(entity);
-    //
-    //     if (renderable.visible) {
-    //         m_Renderer->DrawSprite(
-    //             renderable.textureId,
-    //             transform.position,
-    //             {64, 64},  // size (hardcoded por ahora)
-    //             transform.rotation,
-    //             renderable.color
-    //         );
-    //     }
-    // }
-
-    // Presentar frame
-    m_Renderer->Present();
+    auto& registry = m_Registry->GetNative();
+    const glm::vec2 windowSize{static_cast<float>(m_Window->GetWidth()),
+                               static_cast<float>(m_Window->GetHeight())};
+
+    // Vistas de las entidades Camera (zona visible + matriz de cada una)
+    m_CameraSystem.Update(registry, windowSize);
+    const auto& views = m_CameraSystem.GetViews();
+
+    if (views.empty()) {
+        // Sin cámaras: el mundo en coordenadas de la ventana
+        Core::Systems::RenderSystem::ViewBounds bounds{{0.0f, 0.0f}, windowSize};
+        m_RenderSystem.Render(registry, *m_FrameRenderer, bounds);
+        m_ParticleSystem.Render(*m_FrameRenderer);
+    } else {
+        // Ordena por layer y textura, descarta lo que no ve ninguna cámara
+        // y envía al renderer lo de cada cámara con su vista
+        m_RenderSystem.Render(registry, *m_FrameRenderer, m_CameraSystem);
+
+        // Partículas encima de las entidades (un draw instanciado por emisor)
+        for (const auto& view : views) {
+            m_FrameRenderer->SetView(view.viewProjection, view.viewport);
+            m_ParticleSystem.Render(*m_FrameRenderer);
+        }
+        m_FrameRenderer->ResetView();
+    }
+
+    // Fin del mundo: con resolución reducida se escala aquí a la ventana.
+    // Lo que siga (HUD, texto) se dibuja a resolución nativa
+    m_FrameRenderer->BeginOverlay();
+
+    // Presentar frame (con hilo de render: entregar la lista grabada)
+    m_FrameRenderer->Present();
+
+    // Escala del siguiente frame según el tiempo de GPU medido (llega con
+    // unos frames de retraso; el controlador lo tiene en cuenta)
+    if (m_DynamicResolutionEnabled) {
+        const float scale = m_DynamicResolution.Update(m_FrameRenderer->GetStats().frameTime);
+        m_FrameRenderer->SetResolutionScale(scale);
+    }
 }
 
 void GameLoop::CalculateFPS() {
@@ -218,9 +348,24 @@ void GameLoop::CalculateFPS() {
         static int fpsLogCounter = 0;
         fpsLogCounter++;
         if (fpsLogCounter >= 5) {
-            auto stats = m_Renderer->GetStats();
-            spdlog::debug("FPS: {:.1f} | Draw Calls: {} | Tris: {} | DT: {:.3f}ms",
-                         m_FPS, stats.drawCalls, stats.triangles, m_DeltaTime * 1000.0f);
+            auto stats = m_FrameRenderer->GetStats();
+            const auto& pacing = m_FramePacer.GetStats();
+            spdlog::debug("FPS: {:.1f} | Draw Calls: {} | Batches: {} | Sprites: {} | Tris: {} | "
+                         "DT: {:.3f}ms | CPU: {:.3f}ms | GPU: {:.3f}ms | Escala: {:.2f} ({} cambios) | "
+                         "Pacing: error {:.3f}ms, jitter {:.3f}ms, {} tarde",
+                         m_FPS, stats.drawCalls, stats.batches, stats.sprites, stats.triangles,
+                         m_DeltaTime * 1000.0f, stats.cpuSubmitTime, stats.frameTime,
+                         stats.resolutionScale, m_DynamicResolution.GetStats().changes,
+                         pacing.meanError, pacing.jitter, pacing.missed);
+
+            // Tiempo de cada sistema en el último paso fijo (y en qué hilo)
+            std::string systems;
+            for (const auto& timing : m_Scheduler.GetTimings()) {
+                if (timing.ran) {
+                    systems += fmt::format(" | {}: {:.3f}ms (hilo {})", timing.name, timing.milliseconds, timing.thread);
+                }
+            }
+            spdlog::debug("Sistemas ({} workers){}", m_Scheduler.GetWorkerCount(), systems);
             fpsLogCounter = 0;
         }
     }
@@ -7,7 +7,16 @@
 #pragma once
 
 #include "../core/ecs/Registry.hpp"
+#include "../core/ecs/SystemScheduler.hpp"
+#include "../core/ecs/CommandBuffer.hpp"
+#include "../core/jobs/JobSystem.hpp"
+#include "../core/systems/ParticleSystem.hpp"
+#include "../core/systems/CameraSystem.hpp"
+#include "../core/systems/RenderSystem.hpp"
+#include "../infrastructure/rendering/DynamicResolution.hpp"
+#include "../infrastructure/rendering/FramePacer.hpp"
 #include "../infrastructure/rendering/IRenderer.hpp"
+#include "../infrastructure/rendering/RenderThread.hpp"
 #include "GameWindow.hpp"
 #include <memory>
 #include <chrono>
@@ -18,10 +27,17 @@ namespace MultiNinjaEspacial::Presentation {
  * @brief Game Loop principal del juego
  *
  * Implementa:
- * - Fixed timestep para física
- * - Variable timestep para rendering
- * - Frame limiting (60 FPS target)
+ * - Fixed timestep para física (frecuencia configurable, 60 Hz por defecto),
+ *   con los sistemas en paralelo según sus accesos (SystemScheduler)
+ * - Variable timestep para rendering, interpolando entre los dos últimos
+ *   pasos de simulación (sin tirones aunque la simulación vaya a 30 Hz)
+ * - Frame limiting (60 FPS target) con FramePacer: error sub-milisegundo y
+ *   alineado al vblank cuando hay VSync
  * - Delta time calculation
+ * - Hilo de render opcional (simulación del frame N+1 en paralelo con el
+ *   envío a la GPU del frame N)
+ * - Resolución dinámica opcional (el mundo baja de resolución si la GPU
+ *   pasa de su presupuesto; la interfaz siempre a nativa)
  *
  * Patrón usado: "Fix Your Timestep" de Glenn Fiedler
  * https://gafferongames.com/post/fix_your_timestep/
@@ -85,6 +101,70 @@ public:
      */
     void SetTargetFPS(int targetFPS);
 
+    /**
+     * @brief Precisión del limitador de frames (error, jitter, margen)
+     */
+    [[nodiscard]] const Infrastructure::Rendering::FramePacer::Stats& GetPacingStats() const {
+        return m_FramePacer.GetStats();
+    }
+
+    /**
+     * @brief Configura la frecuencia de la simulación (por defecto 60 Hz)
+     * @param hz Pasos fijos por segundo (> 0)
+     *
+     * Independiente de los FPS: el render interpola las entidades que se
+     * mueven entre los dos últimos pasos.
+     */
+    void SetSimulationRate(int hz);
+
+    /**
+     * @brief Duración del paso fijo de simulación (en segundos)
+     */
+    [[nodiscard]] float GetFixedTimestep() const { return m_FixedTimestep; }
+
+    /**
+     * @brief Activa el hilo de render dedicado (llamar antes de Run)
+     * @param enabled true = Render() graba comandos y un RenderThread con el
+     *                contexto OpenGL los reproduce y hace el swap
+     *
+     * Durante Run() el contexto pertenece al hilo de render; al salir vuelve
+     * al hilo principal (para Shutdown del renderer).
+     */
+    void SetRenderThreadEnabled(bool enabled) { m_RenderThreadEnabled = enabled; }
+
+    /**
+     * @brief Activa la resolución dinámica
+     * @param enabled false = el mundo vuelve a resolución nativa
+     * @param gpuBudget Tiempo de GPU objetivo por frame (ms)
+     */
+    void SetDynamicResolution(bool enabled,
+                              float gpuBudget = Infrastructure::Rendering::DynamicResolution::DEFAULT_GPU_BUDGET);
+
+    /**
+     * @brief Estado de la resolución dinámica (escala actual, cambios...)
+     */
+    [[nodiscard]] const Infrastructure::Rendering::DynamicResolution::Stats& GetResolutionStats() const {
+        return m_DynamicResolution.GetStats();
+    }
+
+    /**
+     * @brief Planificador de los sistemas de simulación (tiempos por sistema)
+     */
+    [[nodiscard]] Core::ECS::SystemScheduler& GetScheduler() { return m_Scheduler; }
+    [[nodiscard]] Core::Jobs::JobSystem& GetJobSystem() { return m_JobSystem; }
+
+    /**
+     * @brief Buffers para crear/destruir entidades desde los sistemas
+     *
+     * Se aplican al final de cada paso fijo, después de todos los sistemas.
+     */
+    [[nodiscard]] Core::ECS::CommandBuffers& GetCommands() { return m_Commands; }
+
+    /**
+     * @brief Sistema de partículas (para lanzar efectos desde gameplay)
+     */
+    [[nodiscard]] Core::Systems::ParticleSystem& GetParticleSystem() { return m_ParticleSystem; }
+
 private:
     /**
      * @brief Procesa input
@@ -97,6 +177,11 @@ private:
      */
     void Update(float deltaTime);
 
+    /**
+     * @brief Registra los sistemas de simulación en el scheduler
+     */
+    void RegisterSystems();
+
     /**
      * @brief Renderiza el frame actual
      */
@@ -107,11 +192,49 @@ private:
      */
     void CalculateFPS();
 
+    /**
+     * @brief Cede el contexto OpenGL y arranca el hilo de render
+     */
+    void StartRenderThread();
+
+    /**
+     * @brief Para el hilo de render y recupera el contexto OpenGL
+     */
+    void StopRenderThread();
+
     // Referencias a componentes del juego
     GameWindow* m_Window{nullptr};
     Infrastructure::Rendering::IRenderer* m_Renderer{nullptr};
     Core::ECS::Registry* m_Registry{nullptr};
 
+    // Cámaras (vistas del frame) y render (con estado: reutiliza buffers)
+    Core::Systems::CameraSystem m_CameraSystem;
+    Core::Systems::RenderSystem m_RenderSystem;
+
+    // Partículas (pools propios, fuera del registry)
+    Core::Systems::ParticleSystem m_ParticleSystem;
+
+    // Hilos de trabajo (sistemas y ParallelEach). Después de los sistemas
+    // que usan sus jobs: se destruye antes, con los workers ya parados
+    Core::Jobs::JobSystem m_JobSystem;
+
+    // Sistemas de simulación, sobre m_JobSystem
+    Core::ECS::SystemScheduler m_Scheduler{m_JobSystem};
+
+    // Cambios estructurales de los sistemas (uno por hilo), aplicados
+    // cuando termina el paso
+    Core::ECS::CommandBuffers m_Commands{m_JobSystem};
+
+    // Hilo de render (opcional). m_FrameRenderer es a quien se envía el
+    // frame: el renderer real o el grabador del hilo de render
+    Infrastructure::Rendering::RenderThread m_RenderThread;
+    Infrastructure::Rendering::IRenderer* m_FrameRenderer{nullptr};
+    bool m_RenderThreadEnabled{false};
+
+    // Resolución dinámica (escala del mundo según el tiempo de GPU)
+    Infrastructure::Rendering::DynamicResolution m_DynamicResolution;
+    bool m_DynamicResolutionEnabled{false};
+
     // Control del loop
     bool m_Running{false};
     bool m_Initialized{false};
@@ -125,8 +248,12 @@ private:
     float m_DeltaTime{0.0f};
     float m_Accumulator{0.0f};
 
-    // Fixed timestep (60 FPS = 0.016666... segundos)
-    static constexpr float FIXED_TIMESTEP = 1.0f / 60.0f;
+    // Fixed timestep (60 Hz = 0.016666... segundos, ver SetSimulationRate)
+    static constexpr int DEFAULT_SIMULATION_RATE = 60;
+    float m_FixedTimestep{1.0f / DEFAULT_SIMULATION_RATE};
+
+    // Definiciones de emisores de partículas
+    static constexpr const char* PARTICLE_DEFINITIONS_PATH = "assets/data/particles.emitters";
 
     // FPS tracking
     float m_FPS{0.0f};
@@ -135,7 +262,7 @@ private:
 
     // Target FPS (0 = sin límite)
     int m_TargetFPS{60};
-    float m_TargetFrameTime{1.0f / 60.0f};
+    Infrastructure::Rendering::FramePacer m_FramePacer;
 };
 
 } // namespace MultiNinjaEspacial::Presentation
@@ -151,6 +151,17 @@ void GameWindow::SetVSync(bool enabled) {
     }
 }
 
+float GameWindow::GetRefreshRate() const {
+    // Modo actual del monitor donde está la ventana (en ventana, el del escritorio)
+    SDL_DisplayMode mode;
+    const int display = SDL_GetWindowDisplayIndex(m_Window);
+    if (display < 0 || SDL_GetCurrentDisplayMode(display, &mode) != 0) {
+        spdlog::warn("No se pudo leer el modo de pantalla: {}", SDL_GetError());
+        return 0.0f;
+    }
+    return static_cast<float>(mode.refresh_rate);
+}
+
 void GameWindow::SetFullscreen(bool fullscreen) {
     m_IsFullscreen = fullscreen;
 
@@ -100,6 +100,17 @@ public:
      */
     void SetVSync(bool enabled);
 
+    /**
+     * @brief Indica si VSync está activo
+     */
+    [[nodiscard]] bool IsVSyncEnabled() const { return m_VSync; }
+
+    /**
+     * @brief Frecuencia de refresco del monitor de la ventana
+     * @return Hz (0 si SDL no la conoce)
+     */
+    [[nodiscard]] float GetRefreshRate() const;
+
     /**
      * @brief Cambia entre fullscreen y windowed
      * @param fullscreen true para fullscreen
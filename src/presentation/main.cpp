@@ -10,9 +10,13 @@
 #include "../core/components/Transform.hpp"
 #include "../core/components/Velocity.hpp"
 #include "../core/components/Renderable.hpp"
+#include "../core/components/Camera.hpp"
+#include "../infrastructure/rendering/capture/FrameSink.hpp"
 #include "../infrastructure/rendering/opengl/OpenGLRenderer.hpp"
 #include <spdlog/spdlog.h>
+#include <cstdlib>
 #include <memory>
+#include <string>
 
 using namespace MultiNinjaEspacial;
 
@@ -38,10 +42,15 @@ void SetupLogging() {
 /**
  * @brief Crea entidades de prueba para el MVP
  * @param registry ECS Registry
+ * @param renderer Renderer (para resolver las texturas una sola vez)
  */
-void CreateTestEntities(Core::ECS::Registry& registry) {
+void CreateTestEntities(Core::ECS::Registry& registry, Infrastructure::Rendering::IRenderer& renderer) {
     spdlog::info("Creando entidades de prueba...");
 
+    // Los IDs string se resuelven aquí; Renderable solo guarda el handle
+    auto playerTexture = renderer.LoadTexture("player_sprite", "assets/sprites/player.png");
+    auto enemyTexture = renderer.LoadTexture("enemy_sprite", "assets/sprites/enemy.png");
+
     // Crear jugador de ejemplo
     auto player = registry.CreateEntity("player");
     registry.AddComponent<Core::Components::Transform>(
@@ -59,36 +68,43 @@ void CreateTestEntities(Core::ECS::Registry& registry) {
 
     registry.AddComponent<Core::Components::Renderable>(
         player,
-        "player_sprite",                      // ID de textura
+        playerTexture,                        // Handle de textura
         glm::vec4{0.2f, 0.8f, 1.0f, 1.0f},   // Color azul claro
         10                                    // Layer 10
     );
 
     spdlog::info("  ✓ Jugador creado en (400, 300)");
 
-    // Crear enemigo de ejemplo
-    auto enemy = registry.CreateEntity("enemy");
-    registry.AddComponent<Core::Components::Transform>(
-        enemy,
-        glm::vec2{100.0f, 100.0f},
-        0.0f,
-        glm::vec2{1.0f, 1.0f}
-    );
-
-    registry.AddComponent<Core::Components::Velocity>(
-        enemy,
-        glm::vec2{20.0f, 15.0f},
-        45.0f  // Rotar a 45 grados/seg
-    );
-
-    registry.AddComponent<Core::Components::Renderable>(
-        enemy,
-        "enemy_sprite",
-        glm::vec4{1.0f, 0.2f, 0.2f, 1.0f},  // Color rojo
-        10
-    );
-
-    spdlog::info("  ✓ Enemigo creado en (100, 100)");
+    // Oleada de enemigos: una plantilla y todas las copias de una vez
+    constexpr uint32_t ENEMY_COUNT = 5;
+    Core::ECS::Prefab enemyPrefab("enemy");
+    enemyPrefab
+        .With<Core::Components::Transform>(
+            glm::vec2{100.0f, 100.0f},
+            0.0f,
+            glm::vec2{1.0f, 1.0f}
+        )
+        .With<Core::Components::Velocity>(
+            glm::vec2{20.0f, 15.0f},
+            45.0f  // Rotar a 45 grados/seg
+        )
+        .With<Core::Components::Renderable>(
+            enemyTexture,
+            glm::vec4{1.0f, 0.2f, 0.2f, 1.0f},  // Color rojo
+            10
+        );
+
+    // Cada uno en su sitio: en fila desde (100, 100)
+    registry.Instantiate(enemyPrefab, ENEMY_COUNT, [&](entt::entity enemy, uint32_t index) {
+        registry.GetComponent<Core::Components::Transform>(enemy).position.x += index * 120.0f;
+    });
+
+    spdlog::info("  ✓ {} enemigos creados desde (100, 100)", ENEMY_COUNT);
+
+    // Cámara principal: centrada en la ventana de 800x600 (sin ella el
+    // mundo se dibuja directamente en coordenadas de la ventana)
+    auto camera = registry.CreateEntity("camera");
+    registry.AddComponent<Core::Components::Camera>(camera, glm::vec2{400.0f, 300.0f});
 
     spdlog::info("Entidades de prueba creadas: {}", registry.GetEntityCount());
 }
@@ -97,9 +113,27 @@ void CreateTestEntities(Core::ECS::Registry& registry) {
  * @brief Punto de entrada principal
  */
 int main(int argc, char* argv[]) {
-    // Evitar warning de parámetros no usados
-    (void)argc;
-    (void)argv;
+    // --render-thread: simular y enviar a la GPU en hilos distintos
+    // --dynamic-resolution: bajar la resolución del mundo si la GPU se pasa
+    // --tick-rate <hz>: frecuencia de la simulación (el render interpola)
+    // --capture <archivo> | --capture "|<comando>": grabar los frames
+    //   (RGBA8 crudo; con '|' se envían a un encoder, p. ej.
+    //   "|ffmpeg -y -f rawvideo -pix_fmt rgba -s {width}x{height} -r 60 -i - out.mp4")
+    bool useRenderThread = false;
+    bool useDynamicResolution = false;
+    std::string captureTarget;
+    int tickRate = 60;
+    for (int i = 1; i < argc; ++i) {
+        if (std::string(argv[i]) == "--render-thread") {
+            useRenderThread = true;
+        } else if (std::string(argv[i]) == "--dynamic-resolution") {
+            useDynamicResolution = true;
+        } else if (std::string(argv[i]) == "--capture" && i + 1 < argc) {
+            captureTarget = argv[++i];
+        } else if (std::string(argv[i]) == "--tick-rate" && i + 1 < argc) {
+            tickRate = std::atoi(argv[++i]);
+        }
+    }
 
     // ━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━
     // 1. CONFIGURAR LOGGING
@@ -127,6 +161,16 @@ int main(int argc, char* argv[]) {
 
         spdlog::info("Renderer: {}", renderer->GetName());
 
+        if (!captureTarget.empty()) {
+            if (captureTarget.front() == '|') {
+                renderer->StartCapture(std::make_unique<Infrastructure::Rendering::PipeFrameSink>(
+                    captureTarget.substr(1)));
+            } else {
+                renderer->StartCapture(std::make_unique<Infrastructure::Rendering::RawFileFrameSink>(
+                    captureTarget));
+            }
+        }
+
         // ━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━
         // 4. CREAR REGISTRY (ECS)
         // ━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━
@@ -135,7 +179,15 @@ int main(int argc, char* argv[]) {
         // ━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━
         // 5. CREAR ENTIDADES DE PRUEBA (MVP)
         // ━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━
-        CreateTestEntities(registry);
+        CreateTestEntities(registry, *renderer);
+
+        // Agrupar las texturas sueltas en páginas de atlas: los handles no
+        // cambian y sprites con texturas distintas comparten batch.
+        // Al arrancar se puede esperar a la carga; durante el juego las
+        // texturas llegan por streaming con placeholder.
+        // (En release: atlas pre-empaquetado con LoadTextureAtlas)
+        renderer->WaitForTextureLoads();
+        renderer->BuildTextureAtlas();
 
         // ━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━
         // 6. CREAR Y EJECUTAR GAME LOOP
@@ -148,6 +200,11 @@ int main(int argc, char* argv[]) {
 
         // Configurar 60 FPS
         loop.SetTargetFPS(60);
+        loop.SetSimulationRate(tickRate);
+        loop.SetRenderThreadEnabled(useRenderThread);
+        if (useDynamicResolution) {
+            loop.SetDynamicResolution(true);
+        }
 
         // Ejecutar loop (bloqueante hasta que se cierre la ventana)
         loop.Run();
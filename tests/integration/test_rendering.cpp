@@ -1,12 +1,816 @@
 // ============================================================================
-// Integration Test: Rendering (STUB)
+// Integration Test: Rendering
 // ============================================================================
-// TODO: Implementar en Fase 1.1
+// Tests de la parte del rendering que no necesita contexto OpenGL
+// (empaquetado de atlas, manifest y path de render sobre NullRenderer)
 // ============================================================================
 
 #include <catch2/catch_test_macros.hpp>
+#include "../../src/core/ecs/Registry.hpp"
+#include "../../src/core/components/Transform.hpp"
+#include "../../src/core/components/Renderable.hpp"
+#include "../../src/core/components/Static.hpp"
+#include "../../src/core/systems/RenderSystem.hpp"
+#include "../../src/infrastructure/rendering/DynamicResolution.hpp"
+#include "../../src/infrastructure/rendering/FramePacer.hpp"
+#include "../../src/infrastructure/rendering/RenderThread.hpp"
+#include "../../src/infrastructure/rendering/TextureAtlas.hpp"
+#include "../../src/infrastructure/rendering/capture/FrameSink.hpp"
+#include "../../src/infrastructure/rendering/null/NullRenderer.hpp"
+#include "../../src/infrastructure/rendering/text/TextRenderer.hpp"
+#include <atomic>
+#include <filesystem>
+#include <fstream>
+#include <thread>
 
-TEST_CASE("Rendering integration (STUB)", "[integration][rendering]") {
-    // TODO: Implementar tests de integración de rendering
-    REQUIRE(true); // Placeholder
+using namespace MultiNinjaEspacial::Infrastructure::Rendering;
+namespace Core = MultiNinjaEspacial::Core;
+
+namespace {
+
+bool Overlaps(const AtlasRegion& a, const AtlasRegion& b) {
+    return a.page == b.page &&
+           a.x < b.x + b.width && b.x < a.x + a.width &&
+           a.y < b.y + b.height && b.y < a.y + a.height;
+}
+
+/**
+ * @brief Atlas sintético: espacio + dígitos de 6x8 px (sin fuente en disco)
+ */
+GlyphAtlas MakeDigitAtlas() {
+    GlyphAtlas atlas;
+    atlas.width = 64;
+    atlas.height = 16;
+    atlas.pixels.assign(size_t{atlas.width} * atlas.height * 4, 255);
+    atlas.ascent = 8.0f;
+    atlas.lineHeight = 10.0f;
+
+    atlas.glyphs.push_back(GlyphInfo{' ', 0, 0, 0, 0, 0.0f, 0.0f, 4.0f});
+    for (uint32_t digit = 0; digit < 10; ++digit) {
+        atlas.glyphs.push_back(GlyphInfo{'0' + digit, digit * 6, 0, 6, 8, 0.0f, -8.0f, 7.0f});
+    }
+    return atlas;
+}
+
+} // namespace
+
+TEST_CASE("AtlasPacker coloca regiones sin solaparse", "[integration][rendering][atlas]") {
+    AtlasPacker packer(256, 1);
+    for (uint32_t i = 0; i < 40; ++i) {
+        packer.Add("sprite_" + std::to_string(i), 16 + (i % 5) * 8, 16 + (i % 3) * 12);
+    }
+
+    AtlasManifest manifest;
+    REQUIRE(packer.Pack(manifest));
+    REQUIRE(manifest.regions.size() == 40);
+
+    for (size_t i = 0; i < manifest.regions.size(); ++i) {
+        const auto& region = manifest.regions[i];
+
+        // Mismo orden que Add()
+        REQUIRE(region.id == "sprite_" + std::to_string(i));
+
+        // Dentro de la página
+        REQUIRE(region.x + region.width <= manifest.pageWidth);
+        REQUIRE(region.y + region.height <= manifest.pageHeight);
+
+        for (size_t j = i + 1; j < manifest.regions.size(); ++j) {
+            REQUIRE_FALSE(Overlaps(region, manifest.regions[j]));
+        }
+    }
+}
+
+TEST_CASE("AtlasPacker abre páginas nuevas y rechaza texturas gigantes", "[integration][rendering][atlas]") {
+    SECTION("Más texturas de las que caben en una página") {
+        AtlasPacker packer(128, 0);
+        for (int i = 0; i < 5; ++i) {
+            packer.Add("tile_" + std::to_string(i), 64, 64);
+        }
+
+        AtlasManifest manifest;
+        REQUIRE(packer.Pack(manifest));
+        REQUIRE(manifest.GetPageCount() == 2);
+    }
+
+    SECTION("Textura más grande que la página") {
+        AtlasPacker packer(64, 1);
+        packer.Add("huge", 128, 16);
+
+        AtlasManifest manifest;
+        REQUIRE_FALSE(packer.Pack(manifest));
+    }
+}
+
+TEST_CASE("AtlasManifest calcula UVs y se guarda/carga", "[integration][rendering][atlas]") {
+    AtlasManifest manifest;
+    manifest.pageWidth = 256;
+    manifest.pageHeight = 128;
+    manifest.pageImages = {"sprites_0.png"};
+    manifest.regions.push_back(AtlasRegion{"player", 0, 64, 32, 32, 64});
+
+    const glm::vec4 uv = manifest.GetUVRect(manifest.regions[0]);
+    REQUIRE(uv.x == 0.25f);
+    REQUIRE(uv.y == 0.25f);
+    REQUIRE(uv.z == 0.375f);
+    REQUIRE(uv.w == 0.75f);
+
+    const auto path = (std::filesystem::temp_directory_path() / "test_atlas.atlas").string();
+    REQUIRE(manifest.Save(path));
+
+    AtlasManifest loaded;
+    REQUIRE(AtlasManifest::Load(path, loaded));
+    REQUIRE(loaded.pageWidth == 256);
+    REQUIRE(loaded.pageHeight == 128);
+    REQUIRE(loaded.pageImages == manifest.pageImages);
+    REQUIRE(loaded.regions.size() == 1);
+    REQUIRE(loaded.regions[0].id == "player");
+    REQUIRE(loaded.regions[0].x == 64);
+    REQUIRE(loaded.regions[0].height == 64);
+
+    std::filesystem::remove(path);
+}
+
+TEST_CASE("NullRenderer agrupa sprites como SpriteBatch", "[integration][rendering][null]") {
+    NullRenderer renderer;
+    REQUIRE(renderer.Initialize(800, 600));
+
+    // 10 texturas en ciclo, sin ordenar: cada batch admite 8 distintas
+    // → [0..7] [8, 9, 0..5] [6..9]
+    std::vector<TextureHandle> textures;
+    for (int i = 0; i < 10; ++i) {
+        textures.push_back(renderer.LoadTexture("tex" + std::to_string(i), "no/existe.png"));
+    }
+
+    renderer.Clear({0.0f, 0.0f, 0.0f, 1.0f});
+    for (int i = 0; i < 20; ++i) {
+        renderer.DrawSprite(textures[i % 10], {float(i), 0.0f}, {16.0f, 16.0f}, 0.0f, glm::vec4{1.0f});
+    }
+    renderer.Present();
+
+    // Las estadísticas del frame sobreviven al Present
+    const auto stats = renderer.GetStats();
+    REQUIRE(stats.sprites == 20);
+    REQUIRE(stats.batches == 3);
+    REQUIRE(stats.drawCalls == 3);
+    REQUIRE(stats.vertices == 120);
+
+    const auto& counters = renderer.GetCounters();
+    REQUIRE(counters.frames == 1);
+    REQUIRE(counters.stateChanges == 20);
+    REQUIRE(counters.bytesUploaded == 20 * NullRenderer::SPRITE_INSTANCE_BYTES);
+
+    // Clear + 20 sprites, en orden de envío
+    const auto& commands = renderer.GetLastFrameCommands().GetCommands();
+    REQUIRE(commands.size() == 21);
+    REQUIRE(commands[0].type == RenderCommand::Type::Clear);
+    REQUIRE(commands[1].texture == textures[0]);
+    REQUIRE(commands[20].position.x == 19.0f);
+}
+
+TEST_CASE("NullRenderer agrupa batches en pasadas multi-draw", "[integration][rendering][null][multidraw]") {
+    NullRenderer renderer;
+    REQUIRE(renderer.Initialize(800, 600));
+
+    std::vector<TextureHandle> textures;
+    for (int i = 0; i < 20; ++i) {
+        textures.push_back(renderer.LoadTexture("tex" + std::to_string(i), ""));
+    }
+    const auto drawCycle = [&](int textureCount, int spriteCount) {
+        renderer.Clear({0.0f, 0.0f, 0.0f, 1.0f});
+        for (int i = 0; i < spriteCount; ++i) {
+            renderer.DrawSprite(textures[i % textureCount], {float(i), 0.0f}, {16.0f, 16.0f}, 0.0f, glm::vec4{1.0f});
+        }
+        renderer.Present();
+    };
+
+    renderer.SetMultiDrawEnabled(true);
+    REQUIRE(renderer.IsMultiDrawEnabled());
+
+    SECTION("Batches que caben en 16 unidades: un solo draw") {
+        // Mismos batches que el path 3.3: [0..7] [8, 9, 0..5] [6..9]
+        drawCycle(10, 20);
+        REQUIRE(renderer.GetStats().batches == 3);
+        REQUIRE(renderer.GetStats().drawCalls == 1);
+        REQUIRE(renderer.GetStats().sprites == 20);
+        // Cada textura se enlaza una vez por pasada
+        REQUIRE(renderer.GetCounters().stateChanges == 10);
+    }
+
+    SECTION("Más de 16 texturas: la pasada se parte entre batches") {
+        // [0..7] [8..15] → pasada 1; [16..19] no cabe → pasada 2
+        drawCycle(20, 20);
+        REQUIRE(renderer.GetStats().batches == 3);
+        REQUIRE(renderer.GetStats().drawCalls == 2);
+        REQUIRE(renderer.GetCounters().stateChanges == 20);
+    }
+
+    SECTION("Desactivarlo vuelve al draw por batch") {
+        renderer.SetMultiDrawEnabled(false);
+        drawCycle(10, 20);
+        REQUIRE(renderer.GetStats().batches == 3);
+        REQUIRE(renderer.GetStats().drawCalls == 3);
+        REQUIRE(renderer.GetCounters().stateChanges == 20);
+    }
+}
+
+TEST_CASE("RenderSystem sobre NullRenderer minimiza cambios de textura", "[integration][rendering][null]") {
+    Core::ECS::Registry registry;
+    Core::Systems::RenderSystem renderSystem;
+    NullRenderer renderer;
+    renderer.Initialize(800, 600);
+
+    // 12 texturas intercaladas: sin ordenar romperían el batch constantemente
+    std::vector<TextureHandle> textures;
+    for (int i = 0; i < 12; ++i) {
+        textures.push_back(renderer.LoadTexture("tex" + std::to_string(i), ""));
+    }
+    for (int i = 0; i < 1200; ++i) {
+        auto entity = registry.CreateEntity();
+        registry.AddComponent<Core::Components::Transform>(entity, glm::vec2{float(i % 700), 100.0f});
+        registry.AddComponent<Core::Components::Renderable>(entity, textures[i % 12], glm::vec4{1.0f}, 0);
+    }
+
+    renderSystem.Render(registry.GetNative(), renderer, {{0.0f, 0.0f}, {800.0f, 600.0f}});
+    renderer.Present();
+
+    // Agrupados por textura: 12 texturas → 2 batches, un bind por textura
+    REQUIRE(renderer.GetStats().sprites == 1200);
+    REQUIRE(renderer.GetStats().batches == 2);
+    REQUIRE(renderer.GetCounters().stateChanges == 12);
+
+    const auto& commands = renderer.GetLastFrameCommands().GetCommands();
+    REQUIRE(commands.size() == 1200);
+    for (size_t i = 1; i < commands.size(); ++i) {
+        REQUIRE(commands[i - 1].texture.index <= commands[i].texture.index);
+    }
+}
+
+TEST_CASE("RenderSystem dibuja cada layer estático con un draw call", "[integration][rendering][null][static]") {
+    Core::ECS::Registry registry;
+    Core::Systems::RenderSystem renderSystem;
+    NullRenderer renderer;
+    renderer.Initialize(800, 600);
+
+    // Fondo de 2000 tiles en dos layers, 4 texturas por layer
+    std::vector<TextureHandle> textures;
+    for (int i = 0; i < 8; ++i) {
+        textures.push_back(renderer.LoadTexture("tile" + std::to_string(i), ""));
+    }
+    entt::entity first = entt::null;
+    for (int i = 0; i < 2000; ++i) {
+        auto entity = registry.CreateEntity();
+        registry.AddComponent<Core::Components::Transform>(entity, glm::vec2{float(i % 780), float(i / 4)});
+        registry.AddComponent<Core::Components::Renderable>(entity, textures[i % 8], glm::vec4{1.0f}, i % 2);
+        registry.AddComponent<Core::Components::Static>(entity);
+        if (first == entt::null) {
+            first = entity;
+        }
+    }
+
+    const Core::Systems::RenderSystem::ViewBounds screen{{0.0f, 0.0f}, {800.0f, 600.0f}};
+    renderSystem.Render(registry.GetNative(), renderer, screen);
+    renderer.Present();
+
+    // Horneado: se sube una vez
+    REQUIRE(renderSystem.GetStats().staticRebuilt == 2);
+    REQUIRE(renderer.GetStats().uploadBytes == 2000 * NullRenderer::SPRITE_INSTANCE_BYTES);
+
+    // Frames siguientes: 2 draws, ningún byte subido, ningún sprite recorrido
+    renderer.Clear(glm::vec4{0.0f});
+    renderSystem.Render(registry.GetNative(), renderer, screen);
+    renderer.Present();
+
+    auto stats = renderer.GetStats();
+    REQUIRE(stats.drawCalls == 2);
+    REQUIRE(stats.sprites == 2000);
+    REQUIRE(stats.staticSprites == 2000);
+    REQUIRE(stats.uploadBytes == 0);
+    REQUIRE(renderSystem.GetStats().visited == 0);
+
+    const auto& commands = renderer.GetLastFrameCommands().GetCommands();
+    REQUIRE(commands.size() == 3);  // Clear + 2 DrawStaticBatch
+    REQUIRE(commands[1].type == RenderCommand::Type::DrawStaticBatch);
+
+    // Mover un tile rehace solo su layer
+    registry.PatchComponent<Core::Components::Transform>(first, [](auto& t) { t.position.y += 8.0f; });
+    renderSystem.Render(registry.GetNative(), renderer, screen);
+    renderer.Present();
+
+    REQUIRE(renderSystem.GetStats().staticRebuilt == 1);
+    REQUIRE(renderer.GetStats().uploadBytes == 1000 * NullRenderer::SPRITE_INSTANCE_BYTES);
+}
+
+TEST_CASE("UnloadTexture vacía los batches estáticos que la usan", "[integration][rendering][null][static]") {
+    NullRenderer renderer;
+    renderer.Initialize(800, 600);
+
+    const TextureHandle rock = renderer.LoadTexture("rock", "");
+    const TextureHandle grass = renderer.LoadTexture("grass", "");
+
+    const auto fill = [&](IRenderer::StaticBatchId batch, TextureHandle texture, size_t count) {
+        std::vector<IRenderer::StaticSprite> sprites(count);
+        for (auto& sprite : sprites) {
+            sprite.texture = texture;
+        }
+        REQUIRE(renderer.UpdateStaticBatch(batch, sprites.data(), sprites.size()));
+    };
+    const auto rocks = renderer.CreateStaticBatch();
+    const auto meadow = renderer.CreateStaticBatch();
+    fill(rocks, rock, 10);
+    fill(meadow, grass, 20);
+
+    // El slot de 'rock' pasa a otra textura: su batch no debe dibujarla
+    renderer.UnloadTexture(rock);
+    const TextureHandle lava = renderer.LoadTexture("lava", "");
+    REQUIRE(lava.index == rock.index);
+
+    renderer.Clear(glm::vec4{0.0f});
+    renderer.DrawStaticBatch(rocks);
+    renderer.DrawStaticBatch(meadow);
+    renderer.Present();
+    REQUIRE(renderer.GetStats().staticSprites == 20);
+
+    // Rellenado de nuevo, vuelve a dibujar
+    fill(rocks, lava, 10);
+    renderer.Clear(glm::vec4{0.0f});
+    renderer.DrawStaticBatch(rocks);
+    renderer.Present();
+    REQUIRE(renderer.GetStats().staticSprites == 10);
+}
+
+TEST_CASE("NullRenderer corta el batch en cada cambio de vista", "[integration][rendering][null][camera]") {
+    NullRenderer renderer;
+    REQUIRE(renderer.Initialize(800, 600));
+    auto texture = renderer.LoadTexture("tex", "");
+
+    const glm::mat4 viewProjection{2.0f};
+    renderer.Clear({0.0f, 0.0f, 0.0f, 1.0f});
+    renderer.SetView(viewProjection, {0, 0, 400, 600});
+    renderer.DrawSprite(texture, {0.0f, 0.0f}, {16.0f, 16.0f}, 0.0f, glm::vec4{1.0f});
+    renderer.SetView(viewProjection, {400, 0, 400, 600});
+    renderer.DrawSprite(texture, {0.0f, 0.0f}, {16.0f, 16.0f}, 0.0f, glm::vec4{1.0f});
+    renderer.BeginOverlay();    // Vuelve solo a la vista de pantalla
+    renderer.DrawSprite(texture, {0.0f, 0.0f}, {16.0f, 16.0f}, 0.0f, glm::vec4{1.0f});
+    renderer.Present();
+
+    // Misma textura, pero un draw por vista
+    REQUIRE(renderer.GetStats().drawCalls == 3);
+
+    // La lista grabada conserva los parámetros de cada vista para reproducirla
+    const auto& commands = renderer.GetLastFrameCommands();
+    REQUIRE(commands.GetViews().size() == 2);
+    REQUIRE(commands.GetViews()[1].viewport == glm::ivec4{400, 0, 400, 600});
+    REQUIRE(commands.GetViews()[1].viewProjection == viewProjection);
+    REQUIRE(commands.GetCommands()[3].type == RenderCommand::Type::SetView);
+    REQUIRE(commands.GetCommands()[3].texture.index == 1);
+
+    NullRenderer replay;
+    REQUIRE(replay.Initialize(800, 600));
+    commands.Replay(replay);
+    replay.Present();
+    REQUIRE(replay.GetStats().drawCalls == 3);
+}
+
+TEST_CASE("NullRenderer comparte batch entre regiones de atlas", "[integration][rendering][null][atlas]") {
+    AtlasManifest manifest;
+    manifest.pageWidth = 256;
+    manifest.pageHeight = 256;
+    manifest.pageImages = {"sprites_0.png"};
+    for (uint32_t i = 0; i < 16; ++i) {
+        manifest.regions.push_back(AtlasRegion{"region" + std::to_string(i), 0, i * 16, 0, 16, 16});
+    }
+
+    const auto path = (std::filesystem::temp_directory_path() / "test_null_atlas.atlas").string();
+    REQUIRE(manifest.Save(path));
+
+    NullRenderer renderer;
+    renderer.Initialize(800, 600);
+    REQUIRE(renderer.LoadTextureAtlas(path));
+    std::filesystem::remove(path);
+
+    // 16 texturas de la misma página → un solo batch y un solo bind
+    for (uint32_t i = 0; i < 16; ++i) {
+        TextureHandle region = renderer.FindTexture("region" + std::to_string(i));
+        REQUIRE(region.IsValid());
+        renderer.DrawSprite(region, {0.0f, 0.0f}, {16.0f, 16.0f}, 0.0f, glm::vec4{1.0f});
+    }
+    renderer.Present();
+
+    REQUIRE(renderer.GetStats().batches == 1);
+    REQUIRE(renderer.GetCounters().stateChanges == 1);
+}
+
+TEST_CASE("NullRenderer confirma cargas asíncronas en Present", "[integration][rendering][null]") {
+    NullRenderer renderer;
+    renderer.Initialize(800, 600);
+
+    bool loaded = false;
+    TextureHandle handle = renderer.LoadTextureAsync("player", "assets/sprites/player.png",
+        [&](TextureHandle texture, bool success) {
+            loaded = success && texture.IsValid();
+        });
+
+    REQUIRE(handle.IsValid());
+    REQUIRE_FALSE(loaded);
+
+    renderer.Present();
+    REQUIRE(loaded);
+    REQUIRE(renderer.FindTexture("player") == handle);
+
+    renderer.UnloadTexture(handle);
+    REQUIRE_FALSE(renderer.IsTextureResident(handle));
+    REQUIRE_FALSE(renderer.FindTexture("player").IsValid());
+}
+
+TEST_CASE("RenderThread reproduce los frames grabados en orden", "[integration][rendering][thread]") {
+    NullRenderer renderer;
+    renderer.Initialize(800, 600);
+
+    std::atomic<int> swaps{0};
+    std::atomic<int> contextChanges{0};
+    RenderThread::Hooks hooks;
+    hooks.makeCurrent = [&] { contextChanges++; };
+    hooks.releaseCurrent = [&] { contextChanges++; };
+    hooks.swapBuffers = [&] { swaps++; };
+
+    RenderThread renderThread;
+    REQUIRE(renderThread.Start(renderer, hooks));
+
+    IRenderer& recorder = renderThread.GetRecorder();
+
+    // Las cargas se ejecutan (bloqueando) en el hilo de render
+    TextureHandle texture = recorder.LoadTexture("player", "assets/sprites/player.png");
+    REQUIRE(texture.IsValid());
+    REQUIRE(recorder.FindTexture("player") == texture);
+
+    constexpr int FRAMES = 50;
+    for (int frame = 0; frame < FRAMES; ++frame) {
+        recorder.Clear({0.0f, 0.0f, 0.0f, 1.0f});
+        for (int i = 0; i <= frame % 5; ++i) {
+            recorder.DrawSprite(texture, {float(frame), float(i)}, {8.0f, 8.0f}, 0.0f, glm::vec4{1.0f});
+        }
+        recorder.Present();
+    }
+
+    renderThread.Stop();
+    REQUIRE_FALSE(renderThread.IsRunning());
+
+    REQUIRE(renderer.GetCounters().frames == FRAMES);
+    REQUIRE(swaps == FRAMES);
+    REQUIRE(contextChanges == 2);
+
+    // El último frame (49 → 5 sprites) llegó entero y en orden
+    REQUIRE(recorder.GetStats().sprites == 5);
+    const auto& commands = renderer.GetLastFrameCommands().GetCommands();
+    REQUIRE(commands.size() == 6);
+    REQUIRE(commands[0].type == RenderCommand::Type::Clear);
+    REQUIRE(commands[5].position == glm::vec2{49.0f, 4.0f});
+}
+
+TEST_CASE("RenderThread presenta el frame en vuelo antes de las tareas", "[integration][rendering][thread]") {
+    NullRenderer renderer;
+    renderer.Initialize(800, 600);
+
+    // Sprites estáticos que dibujó cada frame (solo lo toca el hilo de render)
+    std::vector<uint32_t> drawn;
+    RenderThread::Hooks hooks;
+    hooks.swapBuffers = [&] { drawn.push_back(renderer.GetStats().staticSprites); };
+
+    RenderThread renderThread;
+    REQUIRE(renderThread.Start(renderer, hooks));
+
+    IRenderer& recorder = renderThread.GetRecorder();
+    TextureHandle texture = recorder.LoadTexture("tiles", "assets/sprites/tiles.png");
+    const auto batch = recorder.CreateStaticBatch();
+    REQUIRE(batch != IRenderer::INVALID_STATIC_BATCH);
+
+    constexpr int FRAMES = 20;
+    std::vector<IRenderer::StaticSprite> sprites(FRAMES + 1);
+    for (auto& sprite : sprites) {
+        sprite.texture = texture;
+        sprite.sprite.size = {8.0f, 8.0f};
+    }
+
+    // Frame N dibuja i+1 sprites; el Update grabado justo después de
+    // Present (ya para el N+1) no debe colarse en él
+    REQUIRE(recorder.UpdateStaticBatch(batch, sprites.data(), 1));
+    for (int frame = 0; frame < FRAMES; ++frame) {
+        recorder.Clear({0.0f, 0.0f, 0.0f, 1.0f});
+        recorder.DrawStaticBatch(batch);
+        recorder.Present();
+        REQUIRE(recorder.UpdateStaticBatch(batch, sprites.data(), static_cast<size_t>(frame) + 2));
+    }
+
+    renderThread.Stop();
+
+    REQUIRE(drawn.size() == FRAMES);
+    for (int frame = 0; frame < FRAMES; ++frame) {
+        REQUIRE(drawn[frame] == static_cast<uint32_t>(frame) + 1);
+    }
+}
+
+TEST_CASE("TextRenderer agrupa cientos de números en un draw", "[integration][rendering][text]") {
+    NullRenderer renderer;
+    renderer.Initialize(800, 600);
+    renderer.SetRecordCommands(false);
+
+    TextRenderer text;
+    const auto font = text.AddFont(renderer, "digits", MakeDigitAtlas());
+    REQUIRE(font != TextRenderer::INVALID_FONT);
+    REQUIRE(text.GetStats().atlasBytes == 64 * 16 * 4);
+
+    // El atlas se sube una vez y queda contabilizado como memoria de textura
+    renderer.Present();
+    REQUIRE(renderer.GetStats().uploadBytes == 64 * 16 * 4);
+    REQUIRE(renderer.GetStats().textureMemory == 64 * 16 * 4);
+
+    // 300 números de daño con 30 valores distintos
+    for (int i = 0; i < 300; ++i) {
+        text.DrawString(renderer, font, std::to_string(100 + i % 30),
+                        {static_cast<float>(i % 20) * 40.0f, static_cast<float>(i / 20) * 20.0f},
+                        {1.0f, 0.2f, 0.2f, 1.0f});
+    }
+    renderer.Present();
+
+    REQUIRE(renderer.GetStats().sprites == 900);
+    REQUIRE(renderer.GetStats().drawCalls == 1);
+    REQUIRE(renderer.GetStats().uploadBytes == 900 * NullRenderer::SPRITE_INSTANCE_BYTES);
+    REQUIRE(text.GetStats().runMisses == 30);
+    REQUIRE(text.GetStats().runHits == 270);
+    REQUIRE(text.GetCachedRunCount() == 30);
+}
+
+TEST_CASE("TextRenderer maqueta líneas y caracteres fuera del atlas", "[integration][rendering][text]") {
+    NullRenderer renderer;
+    renderer.Initialize(800, 600);
+
+    TextRenderer text;
+    const auto font = text.AddFont(renderer, "digits", MakeDigitAtlas());
+
+    // Espacio: avanza 4 px sin sprite. Ancho = 7 + 7 + 4 + 7; alto = 2 * lineHeight
+    const glm::vec2 size = text.MeasureString(font, "12 3\n45");
+    REQUIRE(size.x == 25.0f);
+    REQUIRE(size.y == 20.0f);
+
+    text.DrawString(renderer, font, "12 3\n45", {100.0f, 50.0f}, glm::vec4{1.0f});
+    renderer.Present();
+    REQUIRE(renderer.GetStats().sprites == 5);
+
+    // Glyph en la primera línea: su parte superior en y = position.y
+    const auto& commands = renderer.GetLastFrameCommands().GetCommands();
+    REQUIRE(commands.front().position == glm::vec2{100.0f, 50.0f});
+    REQUIRE(commands.back().position == glm::vec2{107.0f, 60.0f});
+
+    // Ni 'x' ni '?' están en el atlas: se ignora
+    text.DrawString(renderer, font, "1x1", {0.0f, 0.0f}, glm::vec4{1.0f});
+    renderer.Present();
+    REQUIRE(renderer.GetStats().sprites == 2);
+}
+
+TEST_CASE("GlyphAtlas rechaza fuentes vacías o truncadas", "[integration][rendering][text]") {
+    const auto path = (std::filesystem::temp_directory_path() / "test_font.ttf").string();
+    GlyphAtlas atlas;
+
+    // Vacía: data() es nullptr
+    { std::ofstream file(path, std::ios::binary); }
+    REQUIRE_FALSE(GlyphAtlas::LoadFile(path, 16.0f, atlas));
+
+    // Más corta que la cabecera sfnt
+    {
+        std::ofstream file(path, std::ios::binary);
+        file.write("\0\1\0\0", 4);
+    }
+    REQUIRE_FALSE(GlyphAtlas::LoadFile(path, 16.0f, atlas));
+    REQUIRE(atlas.glyphs.empty());
+
+    std::filesystem::remove(path);
+}
+
+TEST_CASE("NullRenderer escala el mundo y dibuja la interfaz a nativa", "[integration][rendering][null][resolution]") {
+    NullRenderer renderer;
+    renderer.Initialize(800, 600);
+
+    // Por debajo del mínimo se recorta
+    renderer.SetResolutionScale(0.1f);
+    renderer.Clear(glm::vec4{0.0f});
+    renderer.DrawSprite({}, {0.0f, 0.0f}, {16.0f, 16.0f}, 0.0f, glm::vec4{1.0f});
+    renderer.Present();
+    REQUIRE(renderer.GetStats().resolutionScale == IRenderer::MIN_RESOLUTION_SCALE);
+
+    // Mundo (1 batch) + escalado (1 draw) + interfaz (1 batch)
+    renderer.SetResolutionScale(0.75f);
+    renderer.Clear(glm::vec4{0.0f});
+    renderer.DrawSprite({}, {0.0f, 0.0f}, {16.0f, 16.0f}, 0.0f, glm::vec4{1.0f});
+    renderer.BeginOverlay();
+    renderer.DrawSprite({}, {0.0f, 0.0f}, {16.0f, 16.0f}, 0.0f, glm::vec4{1.0f});
+    renderer.Present();
+
+    auto stats = renderer.GetStats();
+    REQUIRE(stats.resolutionScale == 0.75f);
+    REQUIRE(stats.drawCalls == 3);
+    REQUIRE(stats.batches == 2);
+    REQUIRE(stats.sprites == 2);
+    REQUIRE(stats.textureMemory == 800 * 600 * 4);
+
+    // La escala se graba como comando (se reproduce igual en el hilo de render)
+    const auto& commands = renderer.GetLastFrameCommands().GetCommands();
+    REQUIRE(commands[0].type == RenderCommand::Type::SetResolutionScale);
+    REQUIRE(commands[3].type == RenderCommand::Type::BeginOverlay);
+
+    // A escala 1 no hay pasada extra
+    renderer.SetResolutionScale(1.0f);
+    renderer.Clear(glm::vec4{0.0f});
+    renderer.DrawSprite({}, {0.0f, 0.0f}, {16.0f, 16.0f}, 0.0f, glm::vec4{1.0f});
+    renderer.BeginOverlay();
+    renderer.Present();
+    stats = renderer.GetStats();
+    REQUIRE(stats.resolutionScale == 1.0f);
+    REQUIRE(stats.drawCalls == 1);
+    REQUIRE(stats.textureMemory == 0);
+}
+
+TEST_CASE("DynamicResolution converge al presupuesto de GPU", "[integration][rendering][resolution]") {
+    DynamicResolution controller;
+    controller.SetGpuBudget(5.0f);
+
+    // Sin medidas (driver sin timer queries) no cambia nada
+    for (int i = 0; i < 100; ++i) {
+        REQUIRE(controller.Update(0.0f) == 1.0f);
+    }
+
+    SECTION("Coste proporcional a los píxeles") {
+        // 8 ms a resolución nativa: la escala estable está en [0.7, 0.79]
+        float scale = 1.0f;
+        for (int frame = 0; frame < 300; ++frame) {
+            scale = controller.Update(8.0f * scale * scale);
+        }
+        REQUIRE(scale <= 0.8f);
+        REQUIRE(scale >= 0.7f);
+
+        // Estable: no oscila alrededor del presupuesto
+        const uint32_t changes = controller.GetStats().changes;
+        for (int frame = 0; frame < 300; ++frame) {
+            scale = controller.Update(8.0f * scale * scale);
+        }
+        REQUIRE(controller.GetStats().changes == changes);
+
+        // Carga ligera: vuelve a nativa
+        for (int frame = 0; frame < 600; ++frame) {
+            scale = controller.Update(2.0f * scale * scale);
+        }
+        REQUIRE(scale == 1.0f);
+        REQUIRE(controller.GetStats().decreases < controller.GetStats().changes);
+    }
+
+    SECTION("Nunca baja del mínimo") {
+        for (int frame = 0; frame < 300; ++frame) {
+            controller.Update(50.0f);
+        }
+        REQUIRE(controller.GetScale() == IRenderer::MIN_RESOLUTION_SCALE);
+    }
+
+    SECTION("Un pico aislado no cambia la escala") {
+        for (int frame = 0; frame < 20; ++frame) {
+            controller.Update(frame == 10 ? 20.0f : 3.0f);
+        }
+        REQUIRE(controller.GetScale() == 1.0f);
+        REQUIRE(controller.GetStats().changes == 0);
+    }
+}
+
+TEST_CASE("FramePacer alinea los deadlines al vblank sin perder ritmo", "[integration][rendering][pacing]") {
+    using namespace std::chrono_literals;
+    using Clock = FramePacer::Clock;
+
+    const Clock::duration period = std::chrono::duration_cast<Clock::duration>(
+        std::chrono::duration<double>(1.0 / 144.0));
+
+    SECTION("AlignToVBlank redondea al vblank más cercano") {
+        const FramePacer::TimePoint phase = Clock::now();
+        REQUIRE(FramePacer::AlignToVBlank(phase + period * 3 + 1ms, phase, period) == phase + period * 3);
+        REQUIRE(FramePacer::AlignToVBlank(phase - period * 2 - 1ms, phase, period) == phase - period * 2);
+    }
+
+    SECTION("60 FPS en 144 Hz: cada frame en un vblank, 2.4 vblank de media") {
+        FramePacer pacer;
+        pacer.SetTargetFPS(60);
+        pacer.SetRefreshRate(144.0f);
+
+        const FramePacer::TimePoint phase = Clock::now();
+        pacer.NotifyVBlank(phase);
+        pacer.Reset(phase);
+
+        const FramePacer::TimePoint first = pacer.GetNextDeadline();
+        for (int frame = 0; frame < 10; ++frame) {
+            const FramePacer::TimePoint deadline = pacer.GetNextDeadline();
+            REQUIRE(FramePacer::AlignToVBlank(deadline, phase, period) == deadline);
+            pacer.Wait();
+        }
+
+        // 10 frames de 60 FPS = 24 vblank (redondeando cada uno, no todo a 2)
+        REQUIRE((pacer.GetNextDeadline() - first) / period == 24);
+    }
+
+    SECTION("Un frame que llega muy tarde resincroniza el calendario") {
+        FramePacer pacer;
+        pacer.SetTargetFPS(120);
+        pacer.Reset();
+
+        std::this_thread::sleep_for(30ms);
+        const FramePacer::TimePoint wake = pacer.Wait();
+
+        REQUIRE(pacer.GetStats().missed == 1);
+        REQUIRE(pacer.GetStats().lastError > 8.0f);
+        REQUIRE(pacer.GetNextDeadline() > wake);
+    }
+
+    SECTION("Sin límite no espera") {
+        FramePacer pacer;
+        pacer.SetTargetFPS(0);
+        pacer.Wait();
+        REQUIRE(pacer.GetStats().frames == 0);
+    }
+}
+
+TEST_CASE("RawFileFrameSink escribe los frames de arriba abajo", "[integration][rendering][capture]") {
+    const auto path = (std::filesystem::temp_directory_path() / "test_capture.rgba").string();
+
+    constexpr uint32_t WIDTH = 4;
+    constexpr uint32_t HEIGHT = 3;
+
+    {
+        RawFileFrameSink sink(path);
+        REQUIRE(sink.Open(WIDTH, HEIGHT));
+
+        // Filas en orden de OpenGL (abajo arriba): la fila r vale r
+        std::vector<uint8_t> pixels(WIDTH * HEIGHT * 4);
+        for (uint32_t row = 0; row < HEIGHT; ++row) {
+            std::fill_n(pixels.begin() + row * WIDTH * 4, WIDTH * 4, static_cast<uint8_t>(row));
+        }
+
+        CapturedFrame frame;
+        frame.pixels = pixels.data();
+        frame.width = WIDTH;
+        frame.height = HEIGHT;
+        frame.stride = WIDTH * 4;
+        for (uint64_t i = 0; i < 3; ++i) {
+            frame.index = i;
+            frame.issuedAt = std::chrono::steady_clock::now();
+            // La cola puede llenarse si el escritor va lento: reintentar
+            while (!sink.SubmitFrame(frame)) {
+                std::this_thread::yield();
+            }
+        }
+
+        // Tamaño distinto al abierto: se descarta sin bloquear
+        frame.width = WIDTH * 2;
+        REQUIRE_FALSE(sink.SubmitFrame(frame));
+
+        sink.Close();
+
+        const auto stats = sink.GetStats();
+        REQUIRE(stats.frames == 3);
+        REQUIRE(stats.dropped >= 1);
+        REQUIRE(stats.averageLatency >= 0.0f);
+        REQUIRE(stats.maxLatency >= stats.lastLatency);
+    }
+
+    // 3 frames seguidos, primera fila del archivo = última de OpenGL
+    REQUIRE(std::filesystem::file_size(path) == 3 * WIDTH * HEIGHT * 4);
+    std::FILE* file = std::fopen(path.c_str(), "rb");
+    REQUIRE(file != nullptr);
+    std::vector<uint8_t> written(WIDTH * HEIGHT * 4);
+    REQUIRE(std::fread(written.data(), 1, written.size(), file) == written.size());
+    std::fclose(file);
+    std::filesystem::remove(path);
+
+    REQUIRE(written.front() == HEIGHT - 1);
+    REQUIRE(written.back() == 0);
+}
+
+#ifndef _WIN32
+TEST_CASE("PipeFrameSink sobrevive a que el encoder termine", "[integration][rendering][capture]") {
+    // 'true' sale sin leer nada: las escrituras dan EPIPE (sin SIGPIPE)
+    PipeFrameSink sink("true");
+    constexpr uint32_t SIZE = 256;   // 256 KB por frame: más que el buffer del pipe
+    REQUIRE(sink.Open(SIZE, SIZE));
+
+    std::vector<uint8_t> pixels(SIZE * SIZE * 4, 0x80);
+    CapturedFrame frame;
+    frame.pixels = pixels.data();
+    frame.width = SIZE;
+    frame.height = SIZE;
+    frame.stride = SIZE * 4;
+
+    const auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(5);
+    while (sink.GetStats().dropped == 0 && std::chrono::steady_clock::now() < deadline) {
+        frame.issuedAt = std::chrono::steady_clock::now();
+        sink.SubmitFrame(frame);
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+
+    sink.Close();
+    REQUIRE(sink.GetStats().dropped > 0);
+    REQUIRE(sink.GetStats().frames == 0);
 }
+#endif
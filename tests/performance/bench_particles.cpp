@@ -0,0 +1,73 @@
+// ============================================================================
+// Performance Test: Particle System
+// ============================================================================
+// Simulación y envío de 100k partículas vivas (objetivo: < 1 ms de CPU por
+// update). Ejecutar con: ./performance_tests "[particles]"
+// ============================================================================
+
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/benchmark/catch_benchmark.hpp>
+#include "../../src/core/ecs/Registry.hpp"
+#include "../../src/core/systems/ParticleSystem.hpp"
+#include "../../src/infrastructure/rendering/null/NullRenderer.hpp"
+
+using namespace MultiNinjaEspacial::Core;
+using namespace MultiNinjaEspacial::Infrastructure::Rendering;
+
+namespace {
+
+constexpr uint32_t PARTICLES_PER_EMITTER = 25'000;
+constexpr uint32_t EMITTER_COUNT = 4;
+
+/**
+ * @brief 4 emisores x 25k partículas con vida larga (no mueren durante el test)
+ */
+void CreateParticles(Systems::ParticleSystem& particles) {
+    for (uint32_t e = 0; e < EMITTER_COUNT; ++e) {
+        Systems::ParticleEmitterDef def;
+        def.name = "bench" + std::to_string(e);
+        def.maxParticles = PARTICLES_PER_EMITTER;
+        def.lifetimeMin = 1000.0f;
+        def.lifetimeMax = 2000.0f;
+        def.speedMin = 50.0f;
+        def.speedMax = 200.0f;
+        def.gravity = {0.0f, 490.0f};
+        def.angularMin = -90.0f;
+        def.angularMax = 90.0f;
+
+        const uint32_t index = particles.AddDefinition(def);
+        particles.Burst(index, {960.0f, 540.0f}, PARTICLES_PER_EMITTER);
+    }
+}
+
+} // namespace
+
+TEST_CASE("Partículas: 100k vivas", "[performance][particles][benchmark]") {
+    ECS::Registry registry;
+    NullRenderer renderer;
+    renderer.Initialize(1920, 1080);
+    renderer.SetRecordCommands(false);
+
+    Systems::ParticleSystem particles;
+    CreateParticles(particles);
+
+    particles.Update(registry.GetNative(), 1.0f / 60.0f);
+    REQUIRE(particles.GetStats().alive == PARTICLES_PER_EMITTER * EMITTER_COUNT);
+
+    // Regresión: un envío por emisor, sin texturas repartidas en varios batches
+    particles.Render(renderer);
+    renderer.Present();
+    REQUIRE(particles.GetStats().drawCalls == EMITTER_COUNT);
+    REQUIRE(renderer.GetStats().sprites == PARTICLES_PER_EMITTER * EMITTER_COUNT);
+
+    BENCHMARK("ParticleSystem::Update (100k partículas)") {
+        particles.Update(registry.GetNative(), 1.0f / 60.0f);
+        return particles.GetStats().alive;
+    };
+
+    BENCHMARK("ParticleSystem::Render + NullRenderer (100k partículas)") {
+        particles.Render(renderer);
+        renderer.Present();
+        return renderer.GetStats().sprites;
+    };
+}
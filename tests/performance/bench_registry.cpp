@@ -0,0 +1,87 @@
+// ============================================================================
+// Performance Test: Registry
+// ============================================================================
+// Ráfaga de 10k entidades con Transform + Velocity: wrapper entidad a
+// entidad, EnTT directo, AddComponents en bloque e Instantiate de un
+// Prefab. En Release el wrapper tiene que quedar a la par que EnTT.
+// Ejecutar con: ./performance_tests "[registry]"
+// ============================================================================
+
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/benchmark/catch_benchmark.hpp>
+#include "../../src/core/ecs/Registry.hpp"
+#include "../../src/core/components/Transform.hpp"
+#include "../../src/core/components/Velocity.hpp"
+#include <vector>
+
+using namespace MultiNinjaEspacial::Core;
+
+namespace {
+
+constexpr size_t BURST_SIZE = 10'000;
+
+} // namespace
+
+TEST_CASE("Registry: ráfaga de 10k entidades", "[performance][registry][benchmark]") {
+    const Components::Transform transform{glm::vec2{100.0f, 100.0f}};
+    const Components::Velocity velocity{glm::vec2{0.0f, -400.0f}};
+
+    SECTION("AddComponents equivale a AddComponent entidad a entidad") {
+        ECS::Registry registry;
+        std::vector<entt::entity> entities(BURST_SIZE);
+        registry.GetNative().create(entities.begin(), entities.end());
+
+        std::vector<Components::Velocity> velocities(BURST_SIZE, velocity);
+        velocities.back().linear.x = 5.0f;
+
+        registry.AddComponents<Components::Transform>(entities.begin(), entities.end(), transform);
+        registry.AddComponents<Components::Velocity>(entities.begin(), entities.end(), velocities.begin());
+
+        REQUIRE(registry.GetComponent<Components::Transform>(entities.front()).position.x == 100.0f);
+        REQUIRE(registry.GetComponent<Components::Velocity>(entities.back()).linear.x == 5.0f);
+    }
+
+    BENCHMARK_ADVANCED("Registry::AddComponent (10k entidades)")(Catch::Benchmark::Chronometer meter) {
+        ECS::Registry registry;
+        meter.measure([&] {
+            for (size_t i = 0; i < BURST_SIZE; ++i) {
+                auto entity = registry.CreateEntity();
+                registry.AddComponent<Components::Transform>(entity, transform);
+                registry.AddComponent<Components::Velocity>(entity, velocity);
+            }
+            return registry.GetEntityCount();
+        });
+    };
+
+    BENCHMARK_ADVANCED("entt::registry::emplace (10k entidades)")(Catch::Benchmark::Chronometer meter) {
+        entt::registry registry;
+        meter.measure([&] {
+            for (size_t i = 0; i < BURST_SIZE; ++i) {
+                auto entity = registry.create();
+                registry.emplace<Components::Transform>(entity, transform);
+                registry.emplace<Components::Velocity>(entity, velocity);
+            }
+            return registry.size();
+        });
+    };
+
+    BENCHMARK_ADVANCED("Registry::AddComponents (10k entidades)")(Catch::Benchmark::Chronometer meter) {
+        ECS::Registry registry;
+        std::vector<entt::entity> entities(BURST_SIZE);
+        meter.measure([&] {
+            registry.GetNative().create(entities.begin(), entities.end());
+            registry.AddComponents<Components::Transform>(entities.begin(), entities.end(), transform);
+            registry.AddComponents<Components::Velocity>(entities.begin(), entities.end(), velocity);
+            return registry.GetEntityCount();
+        });
+    };
+
+    BENCHMARK_ADVANCED("Registry::Instantiate (10k entidades)")(Catch::Benchmark::Chronometer meter) {
+        ECS::Registry registry;
+        ECS::Prefab prefab("bullet");
+        prefab.With<Components::Transform>(transform).With<Components::Velocity>(velocity);
+        meter.measure([&] {
+            return registry.Instantiate(prefab, BURST_SIZE).size();
+        });
+    };
+}
@@ -0,0 +1,211 @@
+// ============================================================================
+// Performance Test: Render Path
+// ============================================================================
+// Throughput de ordenación, culling y batching sobre NullRenderer (no
+// necesita GPU). Ejecutar con: ./performance_tests "[benchmark]"
+// Con ENABLE_OFFSCREEN_GL también se mide el envío real a OpenGL (path 3.3
+// frente a multi-draw indirect)
+// ============================================================================
+
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/benchmark/catch_benchmark.hpp>
+#include "../../src/core/ecs/Registry.hpp"
+#include "../../src/core/components/Transform.hpp"
+#include "../../src/core/components/Renderable.hpp"
+#include "../../src/core/components/Static.hpp"
+#include "../../src/core/systems/RenderSystem.hpp"
+#include "../../src/infrastructure/rendering/null/NullRenderer.hpp"
+#include <random>
+
+#ifdef OFFSCREEN_GL_ENABLED
+#include "../../src/infrastructure/rendering/opengl/OffscreenContext.hpp"
+#include "../../src/infrastructure/rendering/opengl/OpenGLRenderer.hpp"
+#endif
+
+using namespace MultiNinjaEspacial::Core;
+using namespace MultiNinjaEspacial::Infrastructure::Rendering;
+
+namespace {
+
+const Systems::RenderSystem::ViewBounds SCREEN{{0.0f, 0.0f}, {1920.0f, 1080.0f}};
+
+/**
+ * @brief Escena de sprites aleatorios
+ * @param worldScale Tamaño del mundo relativo a la pantalla (1 = todo visible)
+ */
+void CreateScene(ECS::Registry& registry, NullRenderer& renderer,
+                 int spriteCount, int textureCount, float worldScale) {
+    std::vector<TextureHandle> textures;
+    for (int i = 0; i < textureCount; ++i) {
+        textures.push_back(renderer.LoadTexture("tex" + std::to_string(i), ""));
+    }
+
+    std::mt19937 rng(42);
+    std::uniform_real_distribution<float> x(0.0f, SCREEN.max.x * worldScale);
+    std::uniform_real_distribution<float> y(0.0f, SCREEN.max.y * worldScale);
+    std::uniform_int_distribution<int> texture(0, textureCount - 1);
+    std::uniform_int_distribution<int> layer(0, 3);
+
+    for (int i = 0; i < spriteCount; ++i) {
+        auto entity = registry.CreateEntity();
+        registry.AddComponent<Components::Transform>(entity, glm::vec2{x(rng), y(rng)});
+        registry.AddComponent<Components::Renderable>(entity, textures[texture(rng)], glm::vec4{1.0f}, layer(rng));
+    }
+}
+
+} // namespace
+
+TEST_CASE("Render path: sprites visibles", "[performance][rendering][benchmark]") {
+    ECS::Registry registry;
+    NullRenderer renderer;
+    renderer.Initialize(1920, 1080);
+    renderer.SetRecordCommands(false);
+
+    Systems::RenderSystem renderSystem;
+    CreateScene(registry, renderer, 50'000, 32, 1.0f);
+
+    // Regresión: el orden por textura mantiene los batches al mínimo
+    // (4 layers x 32 texturas / 8 slots)
+    renderSystem.Render(registry.GetNative(), renderer, SCREEN);
+    renderer.Present();
+    REQUIRE(renderer.GetStats().sprites == 50'000);
+    REQUIRE(renderer.GetStats().batches <= 16);
+
+    BENCHMARK("RenderSystem + NullRenderer (50k sprites, 32 texturas)") {
+        renderSystem.Render(registry.GetNative(), renderer, SCREEN);
+        renderer.Present();
+        return renderer.GetStats().drawCalls;
+    };
+}
+
+TEST_CASE("Render path: mundo grande con culling", "[performance][rendering][benchmark]") {
+    ECS::Registry registry;
+    NullRenderer renderer;
+    renderer.Initialize(1920, 1080);
+    renderer.SetRecordCommands(false);
+
+    Systems::RenderSystem renderSystem;
+    CreateScene(registry, renderer, 200'000, 64, 4.0f);
+
+    // Con un mundo 4x4 veces la pantalla, ~1/16 de los sprites es visible
+    renderSystem.Render(registry.GetNative(), renderer, SCREEN);
+    renderer.Present();
+    REQUIRE(renderSystem.GetStats().culled > 150'000);
+
+    BENCHMARK("RenderSystem + NullRenderer (200k sprites, 1/16 visibles)") {
+        renderSystem.Render(registry.GetNative(), renderer, SCREEN);
+        renderer.Present();
+        return renderer.GetStats().drawCalls;
+    };
+}
+
+TEST_CASE("Render path: escena estática horneada", "[performance][rendering][benchmark]") {
+    ECS::Registry registry;
+    NullRenderer renderer;
+    renderer.Initialize(1920, 1080);
+    renderer.SetRecordCommands(false);
+
+    Systems::RenderSystem renderSystem;
+    CreateScene(registry, renderer, 50'000, 32, 1.0f);
+    for (auto entity : registry.GetNative().view<Components::Renderable>()) {
+        registry.AddComponent<Components::Static>(entity);
+    }
+
+    // Mismo contenido que "sprites visibles", pero sin trabajo por sprite
+    renderSystem.Render(registry.GetNative(), renderer, SCREEN);
+    renderer.Present();
+    renderSystem.Render(registry.GetNative(), renderer, SCREEN);
+    renderer.Present();
+    REQUIRE(renderSystem.GetStats().visited == 0);
+    REQUIRE(renderer.GetStats().staticSprites == 50'000);
+    REQUIRE(renderer.GetStats().uploadBytes == 0);
+
+    BENCHMARK("RenderSystem + NullRenderer (50k sprites estáticos, 32 texturas)") {
+        renderSystem.Render(registry.GetNative(), renderer, SCREEN);
+        renderer.Present();
+        return renderer.GetStats().drawCalls;
+    };
+}
+
+TEST_CASE("Render path: multi-draw frente a draw por batch", "[performance][rendering][benchmark][multidraw]") {
+    ECS::Registry registry;
+    NullRenderer renderer;
+    renderer.Initialize(1920, 1080);
+    renderer.SetRecordCommands(false);
+
+    Systems::RenderSystem renderSystem;
+    CreateScene(registry, renderer, 50'000, 32, 1.0f);
+
+    // Regresión: mismos batches, pero como mucho 2 pasadas por layer
+    // (32 texturas / 16 unidades)
+    renderer.SetMultiDrawEnabled(true);
+    renderSystem.Render(registry.GetNative(), renderer, SCREEN);
+    renderer.Present();
+    REQUIRE(renderer.GetStats().batches <= 16);
+    REQUIRE(renderer.GetStats().drawCalls <= 8);
+
+    BENCHMARK("NullRenderer, draw por batch (50k sprites, 32 texturas)") {
+        renderer.SetMultiDrawEnabled(false);
+        renderSystem.Render(registry.GetNative(), renderer, SCREEN);
+        renderer.Present();
+        return renderer.GetStats().drawCalls;
+    };
+
+    BENCHMARK("NullRenderer, multi-draw (50k sprites, 32 texturas)") {
+        renderer.SetMultiDrawEnabled(true);
+        renderSystem.Render(registry.GetNative(), renderer, SCREEN);
+        renderer.Present();
+        return renderer.GetStats().drawCalls;
+    };
+}
+
+#ifdef OFFSCREEN_GL_ENABLED
+TEST_CASE("Render path: multi-draw frente a draw por batch (OpenGL)", "[performance][rendering][benchmark][multidraw][gl]") {
+    OffscreenContext context;
+    if (!context.Create(1920, 1080)) {
+        WARN("Sin contexto EGL: benchmark omitido");
+        return;
+    }
+
+    OpenGLRenderer renderer;
+    REQUIRE(renderer.Initialize(1920, 1080));
+
+    // 256 texturas de 1x1 intercaladas: muchos batches de 8 por frame
+    std::vector<TextureHandle> textures;
+    const uint8_t white[4] = {255, 255, 255, 255};
+    for (int i = 0; i < 256; ++i) {
+        textures.push_back(renderer.CreateTexture("tex" + std::to_string(i), 1, 1, white));
+    }
+
+    std::mt19937 rng(42);
+    std::uniform_real_distribution<float> x(0.0f, SCREEN.max.x);
+    std::uniform_real_distribution<float> y(0.0f, SCREEN.max.y);
+    std::vector<glm::vec2> positions(50'000);
+    for (auto& position : positions) {
+        position = {x(rng), y(rng)};
+    }
+
+    const auto drawFrame = [&] {
+        renderer.Clear({0.0f, 0.0f, 0.0f, 1.0f});
+        for (size_t i = 0; i < positions.size(); ++i) {
+            renderer.DrawSprite(textures[(i / 64) % textures.size()], positions[i], {8.0f, 8.0f}, 0.0f, glm::vec4{1.0f});
+        }
+        renderer.Present();
+        glFinish();     // Incluir el trabajo del driver y la GPU
+        return renderer.GetStats().drawCalls;
+    };
+
+    renderer.SetMultiDrawEnabled(false);
+    BENCHMARK("OpenGL, draw por batch (50k sprites, 256 texturas)") {
+        return drawFrame();
+    };
+
+    if (!renderer.SetMultiDrawEnabled(true)) {
+        WARN("El driver no soporta GL 4.3 + ARB_shader_draw_parameters: solo path 3.3");
+        return;
+    }
+    BENCHMARK("OpenGL, multi-draw (50k sprites, 256 texturas)") {
+        return drawFrame();
+    };
+}
+#endif
@@ -0,0 +1,111 @@
+// ============================================================================
+// Test: CameraSystem
+// ============================================================================
+// Zona visible, ajuste a píxeles, orden de cámaras y conversión de
+// coordenadas
+// ============================================================================
+
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/catch_approx.hpp>
+#include "../../src/core/ecs/Registry.hpp"
+#include "../../src/core/components/Camera.hpp"
+#include "../../src/core/systems/CameraSystem.hpp"
+
+using namespace MultiNinjaEspacial::Core;
+
+TEST_CASE("CameraSystem calcula la zona visible", "[systems][camera]") {
+    ECS::Registry registry;
+    Systems::CameraSystem cameras;
+
+    auto entity = registry.CreateEntity();
+    registry.AddComponent<Components::Camera>(entity, glm::vec2{1000.0f, 500.0f}, 2.0f);
+
+    cameras.Update(registry.GetNative(), {800.0f, 600.0f});
+
+    // Zoom 2: 800x600 píxeles cubren 400x300 del mundo
+    REQUIRE(cameras.GetViews().size() == 1);
+    const auto& view = cameras.GetViews()[0];
+    REQUIRE(view.visibleMin.x == Catch::Approx(800.0f));
+    REQUIRE(view.visibleMin.y == Catch::Approx(350.0f));
+    REQUIRE(view.visibleMax.x == Catch::Approx(1200.0f));
+    REQUIRE(view.visibleMax.y == Catch::Approx(650.0f));
+    REQUIRE(view.viewport == glm::ivec4{0, 0, 800, 600});
+
+    // El componente también queda actualizado
+    const auto& camera = registry.GetComponent<Components::Camera>(entity);
+    REQUIRE(camera.visibleMin.x == Catch::Approx(800.0f));
+
+    SECTION("IsVisible consulta el rectángulo") {
+        REQUIRE(cameras.IsVisible({1100.0f, 600.0f}, {1300.0f, 700.0f}));
+        REQUIRE_FALSE(cameras.IsVisible({0.0f, 0.0f}, {799.0f, 349.0f}));
+    }
+
+    SECTION("Pantalla → mundo y vuelta") {
+        const glm::vec2 world = Systems::CameraSystem::ScreenToWorld(view, {400.0f, 300.0f});
+        REQUIRE(world.x == Catch::Approx(1000.0f));
+        REQUIRE(world.y == Catch::Approx(500.0f));
+
+        const glm::vec2 screen = Systems::CameraSystem::WorldToScreen(view, world);
+        REQUIRE(screen.x == Catch::Approx(400.0f));
+        REQUIRE(screen.y == Catch::Approx(300.0f));
+    }
+}
+
+TEST_CASE("CameraSystem ajusta la vista a la rejilla de píxeles", "[systems][camera]") {
+    ECS::Registry registry;
+    Systems::CameraSystem cameras;
+
+    auto entity = registry.CreateEntity();
+    auto& camera = registry.AddComponent<Components::Camera>(entity, glm::vec2{100.3f, 50.6f});
+
+    SECTION("Con pixelSnap la esquina cae en un píxel entero") {
+        cameras.Update(registry.GetNative(), {801.0f, 600.0f});
+        const auto& view = cameras.GetViews()[0];
+        REQUIRE(view.visibleMin.x == Catch::Approx(-300.0f));     // 100.3 - 400.5
+        REQUIRE(view.visibleMin.y == Catch::Approx(-249.0f));     // 50.6 - 300
+        REQUIRE(view.visibleMax.x - view.visibleMin.x == Catch::Approx(801.0f));
+    }
+
+    SECTION("Sin pixelSnap se respeta la posición") {
+        camera.pixelSnap = false;
+        cameras.Update(registry.GetNative(), {800.0f, 600.0f});
+        REQUIRE(cameras.GetViews()[0].visibleMin.x == Catch::Approx(-299.7f));
+    }
+
+    SECTION("Con zoom, la rejilla es la de la pantalla") {
+        camera.zoom = 4.0f;
+        cameras.Update(registry.GetNative(), {800.0f, 600.0f});
+        // 100.3 - 100 = 0.3 → 0.25 (múltiplo de 1/4)
+        REQUIRE(cameras.GetViews()[0].visibleMin.x == Catch::Approx(0.25f));
+    }
+}
+
+TEST_CASE("CameraSystem ordena las cámaras y descarta las inactivas", "[systems][camera]") {
+    ECS::Registry registry;
+    Systems::CameraSystem cameras;
+
+    auto minimap = registry.CreateEntity();
+    auto& minimapCamera = registry.AddComponent<Components::Camera>(
+        minimap, glm::vec2{0.0f}, 0.25f, glm::vec4{0.75f, 0.0f, 0.25f, 0.25f});
+    minimapCamera.order = 10;
+
+    auto main = registry.CreateEntity();
+    registry.AddComponent<Components::Camera>(main, glm::vec2{0.0f});
+
+    auto disabled = registry.CreateEntity();
+    registry.AddComponent<Components::Camera>(disabled, glm::vec2{0.0f}).active = false;
+
+    cameras.Update(registry.GetNative(), {800.0f, 600.0f});
+
+    const auto& views = cameras.GetViews();
+    REQUIRE(views.size() == 2);
+    REQUIRE(views[0].entity == main);
+    REQUIRE(views[1].entity == minimap);
+    REQUIRE(views[1].viewport == glm::ivec4{600, 0, 200, 150});
+
+    glm::vec2 min;
+    glm::vec2 max;
+    REQUIRE(cameras.GetVisibleUnion(min, max));
+    REQUIRE(min.x == Catch::Approx(-400.0f));   // Minimapa: 200 px a zoom 1/4 = 800
+    REQUIRE(max.x == Catch::Approx(400.0f));
+}
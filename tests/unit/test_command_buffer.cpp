@@ -0,0 +1,181 @@
+// ============================================================================
+// Test: CommandBuffer
+// ============================================================================
+// Creación y destrucción diferidas, orden de aplicación, componentes con
+// destructor y grabación desde varios hilos
+// ============================================================================
+
+#include <catch2/catch_test_macros.hpp>
+#include "../../src/core/ecs/Registry.hpp"
+#include "../../src/core/ecs/CommandBuffer.hpp"
+#include "../../src/core/jobs/JobSystem.hpp"
+#include "../../src/core/components/Transform.hpp"
+#include "../../src/core/components/Velocity.hpp"
+#include "../../src/core/components/Health.hpp"
+#include <algorithm>
+#include <atomic>
+#include <memory>
+#include <thread>
+#include <vector>
+
+using namespace MultiNinjaEspacial::Core;
+
+namespace {
+
+/**
+ * @brief Componente con destructor: cuenta las copias vivas
+ */
+struct Tracked {
+    std::shared_ptr<int> owner;
+};
+
+} // namespace
+
+TEST_CASE("CommandBuffer difiere los cambios hasta Playback", "[ecs][commands]") {
+    ECS::Registry registry;
+    auto& native = registry.GetNative();
+
+    auto alive = registry.CreateEntity();
+    registry.AddComponent<Components::Health>(alive, 100);
+    auto dead = registry.CreateEntity();
+    registry.AddComponent<Components::Health>(dead, 0);
+
+    // Dentro del bucle: solo se graba
+    ECS::CommandBuffer commands;
+    for (auto entity : native.view<Components::Health>()) {
+        if (native.get<Components::Health>(entity).IsDead()) {
+            commands.Destroy(entity);
+            auto spawned = commands.Create();
+            commands.Emplace<Components::Transform>(spawned, glm::vec2{5.0f, 6.0f});
+            commands.Emplace<Components::Velocity>(spawned, glm::vec2{1.0f, 0.0f});
+        }
+    }
+    commands.Remove<Components::Health>(alive);
+
+    REQUIRE(commands.GetCommandCount() == 5);
+    REQUIRE(registry.IsValid(dead));
+    REQUIRE(registry.GetEntityCount() == 2);
+
+    const auto& created = commands.Playback(native);
+    REQUIRE(commands.IsEmpty());
+    REQUIRE(created.size() == 1);
+
+    REQUIRE_FALSE(registry.IsValid(dead));
+    REQUIRE_FALSE(registry.HasComponent<Components::Health>(alive));
+    REQUIRE(registry.GetComponent<Components::Transform>(created[0]).position.x == 5.0f);
+    REQUIRE(registry.HasComponent<Components::Velocity>(created[0]));
+
+    SECTION("Emplace y Remove del mismo tipo conservan su orden") {
+        commands.Emplace<Components::Health>(alive, 10);
+        commands.Remove<Components::Health>(alive);
+        commands.Emplace<Components::Velocity>(alive, glm::vec2{2.0f, 0.0f});
+        commands.Emplace<Components::Health>(alive, 20);
+        commands.Playback(native);
+
+        REQUIRE(registry.GetComponent<Components::Health>(alive).current == 20);
+        REQUIRE(registry.HasComponent<Components::Velocity>(alive));
+    }
+
+    SECTION("Lo grabado para una entidad destruida se descarta") {
+        commands.Destroy(alive);
+        commands.Emplace<Components::Velocity>(alive, glm::vec2{2.0f, 0.0f});
+        commands.Destroy(alive);
+        commands.Playback(native);
+
+        REQUIRE_FALSE(registry.IsValid(alive));
+
+        commands.Emplace<Components::Velocity>(alive, glm::vec2{2.0f, 0.0f});
+        commands.Playback(native);
+        REQUIRE(registry.GetEntityCount() == 1);
+    }
+}
+
+TEST_CASE("CommandBuffer destruye los componentes del arena", "[ecs][commands]") {
+    ECS::Registry registry;
+    auto& native = registry.GetNative();
+    auto entity = registry.CreateEntity();
+
+    auto owner = std::make_shared<int>(7);
+    ECS::CommandBuffer commands;
+
+    // Aplicado: la copia vive en el registry, la del arena se destruye
+    commands.Emplace<Tracked>(entity, Tracked{owner});
+    REQUIRE(owner.use_count() == 2);
+    commands.Playback(native);
+    REQUIRE(owner.use_count() == 2);
+    REQUIRE(*registry.GetComponent<Tracked>(entity).owner == 7);
+
+    // Descartado
+    commands.Emplace<Tracked>(entity, Tracked{owner});
+    REQUIRE(owner.use_count() == 3);
+    commands.Clear();
+    REQUIRE(owner.use_count() == 2);
+
+    // Muchos comandos: varios bloques, reutilizados en la siguiente tanda
+    for (int round = 0; round < 2; ++round) {
+        std::vector<ECS::CommandBuffer::PendingEntity> pending;
+        for (int i = 0; i < 10000; ++i) {
+            pending.push_back(commands.Create());
+            commands.Emplace<Components::Transform>(pending.back(), glm::vec2{static_cast<float>(i), 0.0f});
+        }
+        const auto& created = commands.Playback(native);
+        REQUIRE(created.size() == 10000);
+        REQUIRE(registry.GetComponent<Components::Transform>(created[9999]).position.x == 9999.0f);
+    }
+    REQUIRE(registry.GetEntityCount() == 20001);
+}
+
+TEST_CASE("CommandBuffers da un buffer a cada hilo", "[ecs][commands][jobs]") {
+    Jobs::JobSystem jobs(3);
+    ECS::CommandBuffers commands(jobs);
+    ECS::Registry registry;
+
+    jobs.ParallelFor(4000, 100, [&](uint32_t begin, uint32_t end) {
+        auto& local = commands.Local();
+        for (uint32_t i = begin; i < end; ++i) {
+            auto spawned = local.Create();
+            local.Emplace<Components::Health>(spawned, static_cast<int>(i));
+        }
+    });
+
+    REQUIRE(commands.GetCommandCount() == 8000);
+    REQUIRE(registry.GetEntityCount() == 0);
+
+    commands.Playback(registry.GetNative());
+    REQUIRE(commands.GetCommandCount() == 0);
+    REQUIRE(registry.GetEntityCount() == 4000);
+
+    // Cada valor una vez
+    std::vector<int> seen(4000, 0);
+    for (auto entity : registry.GetNative().view<Components::Health>()) {
+        seen[registry.GetComponent<Components::Health>(entity).current]++;
+    }
+    REQUIRE(std::count(seen.begin(), seen.end(), 1) == 4000);
+}
+
+TEST_CASE("CommandBuffers solo da buffer a sus hilos", "[ecs][commands][jobs]") {
+    Jobs::JobSystem jobs(2);
+    Jobs::JobSystem other(1);
+    ECS::CommandBuffers commands(jobs);
+
+    REQUIRE(commands.IsRecordingThread());
+
+    // Workers propios: sí; workers de otro JobSystem: no (tendrían el 0)
+    std::atomic<int> rejected{0};
+    std::atomic<int> accepted{0};
+    jobs.ParallelFor(64, 1, [&](uint32_t, uint32_t) {
+        rejected += commands.IsRecordingThread() ? 0 : 1;
+    });
+    other.ParallelFor(64, 1, [&](uint32_t, uint32_t) {
+        if (other.GetCurrentThreadIndex() != 0) {
+            accepted += commands.IsRecordingThread() ? 1 : 0;
+        }
+    });
+    REQUIRE(rejected == 0);
+    REQUIRE(accepted == 0);
+
+    // Hilo externo
+    bool external = true;
+    std::thread([&] { external = commands.IsRecordingThread(); }).join();
+    REQUIRE_FALSE(external);
+}
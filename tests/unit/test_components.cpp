@@ -52,9 +52,16 @@ TEST_CASE("Health component funciona", "[components][health]") {
 }
 
 TEST_CASE("Renderable component funciona", "[components][renderable]") {
+    SECTION("Constructor con handle de textura") {
+        Renderable r(TextureHandle(3), glm::vec4{1.0f}, 10);
+        REQUIRE(r.texture.IsValid());
+        REQUIRE(r.texture.index == 3);
+        REQUIRE(r.layer == 10);
+    }
+
     SECTION("Constructor por defecto") {
         Renderable r;
-        REQUIRE(r.textureId.empty());
+        REQUIRE_FALSE(r.texture.IsValid());
         REQUIRE(r.visible);
         REQUIRE(r.color.a == 1.0f);
     }
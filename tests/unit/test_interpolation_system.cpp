@@ -0,0 +1,74 @@
+// ============================================================================
+// Test: InterpolationSystem
+// ============================================================================
+// Snapshot del paso anterior, teletransporte e interpolación de Transform
+// ============================================================================
+
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/catch_approx.hpp>
+#include "../../src/core/ecs/Registry.hpp"
+#include "../../src/core/components/Transform.hpp"
+#include "../../src/core/components/PreviousTransform.hpp"
+#include "../../src/core/components/Velocity.hpp"
+#include "../../src/core/systems/InterpolationSystem.hpp"
+#include "../../src/core/systems/MovementSystem.hpp"
+
+using namespace MultiNinjaEspacial::Core;
+
+TEST_CASE("InterpolationSystem guarda el paso anterior", "[systems][interpolation]") {
+    ECS::Registry registry;
+
+    auto ship = registry.CreateEntity();
+    registry.AddComponent<Components::Transform>(ship, glm::vec2{100.0f, 100.0f});
+    registry.AddComponent<Components::Velocity>(ship, glm::vec2{60.0f, 0.0f});
+
+    auto rock = registry.CreateEntity();
+    registry.AddComponent<Components::Transform>(rock, glm::vec2{0.0f, 0.0f});
+
+    auto& native = registry.GetNative();
+
+    // Primer paso: solo lo que se mueve recibe PreviousTransform
+    Systems::InterpolationSystem::Snapshot(native);
+    REQUIRE(registry.HasComponent<Components::PreviousTransform>(ship));
+    REQUIRE_FALSE(registry.HasComponent<Components::PreviousTransform>(rock));
+    REQUIRE(registry.GetComponent<Components::PreviousTransform>(ship).position.x == 100.0f);
+
+    Systems::MovementSystem::Update(native, 0.5f);
+    Systems::InterpolationSystem::Snapshot(native);
+    Systems::MovementSystem::Update(native, 0.5f);
+
+    const auto& previous = registry.GetComponent<Components::PreviousTransform>(ship);
+    const auto& current = registry.GetComponent<Components::Transform>(ship);
+    REQUIRE(previous.position.x == Catch::Approx(130.0f));
+    REQUIRE(current.position.x == Catch::Approx(160.0f));
+
+    SECTION("Teleport descarta el recorrido") {
+        registry.GetComponent<Components::Transform>(ship).position = {900.0f, 900.0f};
+        Systems::InterpolationSystem::Teleport(native, ship);
+
+        const auto drawn = Systems::InterpolationSystem::Interpolate(
+            registry.GetComponent<Components::PreviousTransform>(ship),
+            registry.GetComponent<Components::Transform>(ship), 0.25f);
+        REQUIRE(drawn.position.x == Catch::Approx(900.0f));
+    }
+}
+
+TEST_CASE("InterpolationSystem interpola entre dos pasos", "[systems][interpolation]") {
+    Components::PreviousTransform previous{Components::Transform{{0.0f, 10.0f}, 350.0f, {1.0f, 1.0f}}};
+    Components::Transform current{{10.0f, 20.0f}, 10.0f, {3.0f, 1.0f}};
+
+    SECTION("Extremos") {
+        REQUIRE(Systems::InterpolationSystem::Interpolate(previous, current, 0.0f).position.x == 0.0f);
+        REQUIRE(Systems::InterpolationSystem::Interpolate(previous, current, 1.0f).position.x == Catch::Approx(10.0f));
+    }
+
+    SECTION("Punto medio") {
+        const auto half = Systems::InterpolationSystem::Interpolate(previous, current, 0.5f);
+        REQUIRE(half.position.x == Catch::Approx(5.0f));
+        REQUIRE(half.position.y == Catch::Approx(15.0f));
+        REQUIRE(half.scale.x == Catch::Approx(2.0f));
+
+        // 350° → 10° pasa por 0° (20° de giro), no por 180°
+        REQUIRE(half.rotation == Catch::Approx(360.0f));
+    }
+}
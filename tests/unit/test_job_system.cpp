@@ -0,0 +1,158 @@
+// ============================================================================
+// Test: JobSystem
+// ============================================================================
+// ParallelFor, tareas con contador, ejecución sin workers y ParallelEach
+// sobre views
+// ============================================================================
+
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/catch_approx.hpp>
+#include "../../src/core/ecs/Registry.hpp"
+#include "../../src/core/jobs/JobSystem.hpp"
+#include "../../src/core/jobs/ParallelEach.hpp"
+#include "../../src/core/components/Transform.hpp"
+#include "../../src/core/components/Velocity.hpp"
+#include "../../src/core/systems/MovementSystem.hpp"
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <thread>
+#include <vector>
+
+using namespace MultiNinjaEspacial::Core;
+
+TEST_CASE("JobSystem reparte ParallelFor sin repetir ni saltarse índices", "[jobs]") {
+    Jobs::JobSystem jobs(3);
+    REQUIRE(jobs.GetWorkerCount() == 3);
+    REQUIRE(jobs.GetCurrentThreadIndex() == 0);
+
+    // Cada trozo escribe solo su rango: sin atomics
+    std::vector<int> hits(100000, 0);
+    std::vector<uint32_t> threads(100000, 0);
+    std::atomic<bool> chunksOk{true};
+    jobs.ParallelFor(static_cast<uint32_t>(hits.size()), 1000, [&](uint32_t begin, uint32_t end) {
+        if (end - begin > 1000) {
+            chunksOk = false;
+        }
+        for (uint32_t i = begin; i < end; ++i) {
+            hits[i]++;
+            threads[i] = jobs.GetCurrentThreadIndex();
+        }
+    });
+
+    REQUIRE(chunksOk);
+    REQUIRE(std::all_of(hits.begin(), hits.end(), [](int count) { return count == 1; }));
+    REQUIRE(std::all_of(threads.begin(), threads.end(), [](uint32_t thread) { return thread <= 3; }));
+
+    SECTION("Un solo trozo se ejecuta en el hilo que llama") {
+        const std::thread::id caller = std::this_thread::get_id();
+        std::thread::id ranOn;
+        jobs.ParallelFor(10, 1000, [&](uint32_t begin, uint32_t end) {
+            REQUIRE(begin == 0);
+            REQUIRE(end == 10);
+            ranOn = std::this_thread::get_id();
+        });
+        REQUIRE(ranOn == caller);
+    }
+}
+
+TEST_CASE("JobSystem espera a las tareas de un contador", "[jobs]") {
+    Jobs::JobSystem jobs(1);
+
+    // Dos tareas que se esperan entre sí: solo terminan si Wait pone al
+    // hilo principal a trabajar junto al worker
+    std::atomic<int> started{0};
+    std::atomic<bool> overlapped{true};
+    auto rendezvous = [&] {
+        started++;
+        const auto limit = std::chrono::steady_clock::now() + std::chrono::seconds(1);
+        while (started.load() < 2) {
+            if (std::chrono::steady_clock::now() > limit) {
+                overlapped = false;
+                return;
+            }
+            std::this_thread::yield();
+        }
+    };
+
+    Jobs::JobCounter counter;
+    jobs.Submit(rendezvous, counter);
+    jobs.Submit(rendezvous, counter);
+    jobs.Wait(counter);
+
+    REQUIRE(counter.IsDone());
+    REQUIRE(overlapped);
+
+    SECTION("Tareas con ParallelFor anidado") {
+        std::atomic<uint32_t> total{0};
+        auto task = [&] {
+            jobs.ParallelFor(10000, 100, [&](uint32_t begin, uint32_t end) { total += end - begin; });
+        };
+
+        Jobs::JobCounter nested;
+        for (int i = 0; i < 4; ++i) {
+            jobs.Submit(task, nested);
+        }
+        jobs.Wait(nested);
+        REQUIRE(total == 40000);
+    }
+}
+
+TEST_CASE("JobSystem sin workers ejecuta todo en el hilo que llama", "[jobs]") {
+    Jobs::JobSystem jobs(0);
+    const std::thread::id caller = std::this_thread::get_id();
+
+    bool allOnCaller = true;
+    jobs.ParallelFor(5000, 100, [&](uint32_t, uint32_t) {
+        allOnCaller = allOnCaller && std::this_thread::get_id() == caller;
+    });
+    REQUIRE(allOnCaller);
+
+    // Las tareas sueltas quedan en cola hasta Wait
+    int runs = 0;
+    auto task = [&] { runs++; };
+    Jobs::JobCounter counter;
+    jobs.Submit(task, counter);
+    REQUIRE(counter.GetPending() == 1);
+    jobs.Wait(counter);
+    REQUIRE(runs == 1);
+}
+
+TEST_CASE("ParallelEach recorre las entidades de la view una vez", "[jobs][ecs]") {
+    Jobs::JobSystem jobs(3);
+    ECS::Registry registry;
+
+    // Las que no tienen Velocity quedan fuera de la view
+    std::vector<entt::entity> moving;
+    for (int i = 0; i < 5000; ++i) {
+        auto entity = registry.CreateEntity();
+        registry.AddComponent<Components::Transform>(entity, glm::vec2{static_cast<float>(i), 0.0f});
+        if (i % 4 != 0) {
+            registry.AddComponent<Components::Velocity>(entity, glm::vec2{10.0f, 20.0f}, 90.0f);
+            moving.push_back(entity);
+        }
+    }
+
+    auto& native = registry.GetNative();
+    auto view = native.view<Components::Transform, Components::Velocity>();
+    std::atomic<int> visited{0};
+    Jobs::ParallelEach(jobs, view, [&](entt::entity, Components::Transform&, Components::Velocity&) {
+        visited++;
+    }, 256);
+    REQUIRE(visited == static_cast<int>(moving.size()));
+
+    Systems::MovementSystem::Update(native, 0.5f, jobs);
+
+    for (int i = 0; i < 5000; ++i) {
+        const auto entity = static_cast<entt::entity>(i);
+        const auto& transform = registry.GetComponent<Components::Transform>(entity);
+        if (i % 4 != 0) {
+            REQUIRE(transform.position.x == Catch::Approx(i + 5.0f));
+            REQUIRE(transform.position.y == Catch::Approx(10.0f));
+            REQUIRE(transform.rotation == Catch::Approx(45.0f));
+        } else {
+            REQUIRE(transform.position.x == Catch::Approx(static_cast<float>(i)));
+            REQUIRE(transform.rotation == 0.0f);
+        }
+    }
+}
@@ -0,0 +1,228 @@
+// ============================================================================
+// Test: ParticleSystem
+// ============================================================================
+// Tests de carga de definiciones, emisión, simulación y envío al renderer
+// ============================================================================
+
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/catch_approx.hpp>
+#include "../../src/core/ecs/Registry.hpp"
+#include "../../src/core/components/Transform.hpp"
+#include "../../src/core/components/ParticleEmitter.hpp"
+#include "../../src/core/systems/ParticleSystem.hpp"
+#include <sstream>
+
+using namespace MultiNinjaEspacial::Core;
+using MultiNinjaEspacial::Infrastructure::Rendering::IRenderer;
+using MultiNinjaEspacial::Infrastructure::Rendering::TextureHandle;
+using Catch::Approx;
+
+namespace {
+
+/**
+ * @brief Renderer falso que registra las llamadas a DrawSprites
+ */
+class MockRenderer : public IRenderer {
+public:
+    struct Submit {
+        TextureHandle texture;
+        std::vector<SpriteDraw> sprites;
+    };
+
+    std::vector<Submit> submits;
+
+    bool Initialize(int, int) override { return true; }
+    void Shutdown() override {}
+    void Clear(const glm::vec4&) override {}
+    void Present() override {}
+    void SetViewport(int, int, int, int) override {}
+    void SetView(const glm::mat4&, const glm::ivec4&) override {}
+    void ResetView() override {}
+    void SetResolutionScale(float) override {}
+    void BeginOverlay() override {}
+    void DrawSprite(TextureHandle, const glm::vec2&, const glm::vec2&, float, const glm::vec4&) override {}
+
+    void DrawSprites(TextureHandle texture, const SpriteDraw* sprites, size_t count) override {
+        submits.push_back({texture, std::vector<SpriteDraw>(sprites, sprites + count)});
+    }
+
+    TextureHandle LoadTexture(const std::string&, const std::string&) override { return {}; }
+    TextureHandle LoadTextureAsync(const std::string&, const std::string&, TextureLoadCallback) override { return {}; }
+    [[nodiscard]] bool IsTextureResident(TextureHandle) const override { return true; }
+    bool LoadTextureAtlas(const std::string&) override { return true; }
+    TextureHandle CreateTexture(const std::string&, uint32_t, uint32_t, const uint8_t*) override { return {}; }
+    TextureHandle CreateTextureRegion(const std::string&, TextureHandle, uint32_t, uint32_t, uint32_t, uint32_t) override { return {}; }
+    [[nodiscard]] TextureHandle FindTexture(const std::string& id) const override {
+        return id == "spark" ? TextureHandle(7) : TextureHandle{};
+    }
+    void UnloadTexture(TextureHandle) override {}
+    StaticBatchId CreateStaticBatch() override { return INVALID_STATIC_BATCH; }
+    bool UpdateStaticBatch(StaticBatchId, const StaticSprite*, size_t) override { return false; }
+    void DrawStaticBatch(StaticBatchId) override {}
+    void DestroyStaticBatch(StaticBatchId) override {}
+    [[nodiscard]] std::string GetName() const override { return "Mock"; }
+    [[nodiscard]] RenderStats GetStats() const override { return {}; }
+    void ResetStats() override {}
+};
+
+/**
+ * @brief Definición determinista: sin dispersión ni aleatoriedad
+ */
+Systems::ParticleEmitterDef MakeLinearDef(const std::string& name, uint32_t maxParticles) {
+    Systems::ParticleEmitterDef def;
+    def.name = name;
+    def.maxParticles = maxParticles;
+    def.lifetimeMin = def.lifetimeMax = 1.0f;
+    def.speedMin = def.speedMax = 100.0f;
+    def.direction = 0.0f;
+    def.spread = 0.0f;
+    def.sizeMin = def.sizeMax = 10.0f;
+    def.sizeEnd = 0.0f;
+    def.colorStart = {1.0f, 1.0f, 1.0f, 1.0f};
+    def.colorEnd = {0.0f, 0.0f, 0.0f, 0.0f};
+    return def;
+}
+
+} // namespace
+
+TEST_CASE("ParticleSystem carga definiciones de emisores", "[systems][particles]") {
+    Systems::ParticleSystem particles;
+
+    SECTION("Fichero válido") {
+        std::istringstream data(
+            "# comentario\n"
+            "emitter hit\n"
+            "    texture spark\n"
+            "    max 256\n"
+            "    burst 20\n"
+            "    lifetime 0.5 0.75\n"
+            "    gravity 0 490\n"
+            "    color_end 1 0 0 0\n"
+            "end\n"
+            "emitter fire\n"
+            "    rate 30\n"
+            "end\n");
+
+        REQUIRE(particles.LoadDefinitions(data, "test"));
+        REQUIRE(particles.GetDefinitionCount() == 2);
+
+        const uint32_t hit = particles.FindDefinition("hit");
+        REQUIRE(hit != Systems::ParticleSystem::INVALID_DEFINITION);
+        const auto& def = particles.GetDefinition(hit);
+        REQUIRE(def.maxParticles == 256);
+        REQUIRE(def.burst == 20);
+        REQUIRE(def.lifetimeMax == Approx(0.75f));
+        REQUIRE(def.gravity.y == Approx(490.0f));
+        REQUIRE(def.colorEnd.r == Approx(1.0f));
+
+        MockRenderer renderer;
+        particles.ResolveTextures(renderer);
+        REQUIRE(particles.GetDefinition(hit).textureHandle == TextureHandle(7));
+        REQUIRE(particles.FindDefinition("missing") == Systems::ParticleSystem::INVALID_DEFINITION);
+    }
+
+    SECTION("Propiedad desconocida") {
+        std::istringstream data("emitter hit\n    colour 1 1 1 1\nend\n");
+        REQUIRE_FALSE(particles.LoadDefinitions(data, "test"));
+    }
+
+    SECTION("Emisor sin end") {
+        std::istringstream data("emitter hit\n    max 16\n");
+        REQUIRE_FALSE(particles.LoadDefinitions(data, "test"));
+    }
+
+    SECTION("Un emisor inválido descarta el fichero entero") {
+        particles.AddDefinition(MakeLinearDef("spark", 64));
+
+        // 'hit' y el nuevo 'spark' son válidos; 'smoke' no
+        std::istringstream data(
+            "emitter hit\n    max 16\nend\n"
+            "emitter spark\n    max 8\nend\n"
+            "emitter smoke\n    max 0\nend\n");
+        REQUIRE_FALSE(particles.LoadDefinitions(data, "test"));
+
+        REQUIRE(particles.GetDefinitionCount() == 1);
+        REQUIRE(particles.FindDefinition("hit") == Systems::ParticleSystem::INVALID_DEFINITION);
+        REQUIRE(particles.GetDefinition(particles.FindDefinition("spark")).maxParticles == 64);
+    }
+}
+
+TEST_CASE("ParticleSystem integra posición, tamaño y color", "[systems][particles]") {
+    Systems::ParticleSystem particles;
+    const uint32_t def = particles.AddDefinition(MakeLinearDef("linear", 64));
+
+    REQUIRE(particles.Burst(def, {0.0f, 0.0f}, 10) == 10);
+    particles.Simulate(0.5f);
+
+    MockRenderer renderer;
+    particles.Render(renderer);
+
+    REQUIRE(renderer.submits.size() == 1);
+    REQUIRE(renderer.submits[0].sprites.size() == 10);
+
+    // A mitad de vida: x = 50, tamaño 5 (centrado), color a mitad
+    const auto& sprite = renderer.submits[0].sprites[0];
+    REQUIRE(sprite.size.x == Approx(5.0f));
+    REQUIRE(sprite.position.x + 0.5f * sprite.size.x == Approx(50.0f));
+    REQUIRE(sprite.position.y + 0.5f * sprite.size.y == Approx(0.0f).margin(1e-4));
+    REQUIRE(sprite.color.a == Approx(0.5f));
+}
+
+TEST_CASE("ParticleSystem elimina las partículas al acabar su vida", "[systems][particles]") {
+    Systems::ParticleSystem particles;
+    auto shortDef = MakeLinearDef("short", 64);
+    shortDef.lifetimeMin = shortDef.lifetimeMax = 0.25f;
+    const uint32_t shortLived = particles.AddDefinition(shortDef);
+    const uint32_t longLived = particles.AddDefinition(MakeLinearDef("long", 64));
+
+    // 7 y 5: no múltiplos de 4, ejercita la cola del bucle SIMD
+    particles.Burst(shortLived, {0.0f, 0.0f}, 7);
+    particles.Burst(longLived, {0.0f, 0.0f}, 5);
+    particles.Simulate(0.3f);
+
+    REQUIRE(particles.GetAliveCount(shortLived) == 0);
+    REQUIRE(particles.GetAliveCount(longLived) == 5);
+    REQUIRE(particles.GetStats().alive == 5);
+
+    MockRenderer renderer;
+    particles.Render(renderer);
+    REQUIRE(renderer.submits.size() == 1);
+    REQUIRE(particles.GetStats().drawCalls == 1);
+}
+
+TEST_CASE("ParticleSystem descarta lo que no cabe en el pool", "[systems][particles]") {
+    Systems::ParticleSystem particles;
+    const uint32_t def = particles.AddDefinition(MakeLinearDef("small", 10));
+
+    REQUIRE(particles.Burst(def, {0.0f, 0.0f}, 8) == 8);
+    REQUIRE(particles.Burst(def, {0.0f, 0.0f}, 8) == 2);
+    REQUIRE(particles.GetAliveCount(def) == 10);
+    REQUIRE(particles.GetStats().dropped == 6);
+}
+
+TEST_CASE("ParticleSystem emite desde ParticleEmitter", "[systems][particles]") {
+    ECS::Registry registry;
+    Systems::ParticleSystem particles;
+
+    auto def = MakeLinearDef("stream", 1024);
+    def.rate = 100.0f;
+    def.lifetimeMin = def.lifetimeMax = 10.0f;
+    const uint32_t stream = particles.AddDefinition(def);
+
+    auto entity = registry.CreateEntity();
+    registry.AddComponent<Components::Transform>(entity, glm::vec2{100.0f, 100.0f});
+    registry.AddComponent<Components::ParticleEmitter>(entity, stream);
+
+    // 100 partículas/s durante 1 s en pasos de 1/60
+    for (int i = 0; i < 60; ++i) {
+        particles.Update(registry.GetNative(), 1.0f / 60.0f);
+    }
+    REQUIRE(particles.GetAliveCount(stream) >= 99);
+    REQUIRE(particles.GetAliveCount(stream) <= 100);
+
+    // Pausado: no emite más
+    registry.GetComponent<Components::ParticleEmitter>(entity).emitting = false;
+    const uint32_t alive = particles.GetAliveCount(stream);
+    particles.Update(registry.GetNative(), 1.0f);
+    REQUIRE(particles.GetAliveCount(stream) == alive);
+}
@@ -0,0 +1,70 @@
+// ============================================================================
+// Test: Prefab
+// ============================================================================
+// Plantillas de entidad e instanciación en bloque con Registry::Instantiate
+// ============================================================================
+
+#include <catch2/catch_test_macros.hpp>
+#include "../../src/core/ecs/Registry.hpp"
+#include "../../src/core/ecs/Prefab.hpp"
+#include "../../src/core/components/Transform.hpp"
+#include "../../src/core/components/Velocity.hpp"
+#include "../../src/core/components/Health.hpp"
+#include "../../src/core/components/Static.hpp"
+#include <vector>
+
+using namespace MultiNinjaEspacial::Core;
+
+TEST_CASE("Prefab guarda componentes y valores por defecto", "[ecs][prefab]") {
+    ECS::Prefab prefab("asteroid");
+    prefab.With<Components::Transform>(glm::vec2{10.0f, 20.0f})
+          .With<Components::Health>(50);
+
+    REQUIRE(prefab.GetName() == "asteroid");
+    REQUIRE(prefab.GetComponentCount() == 2);
+    REQUIRE(prefab.Has<Components::Transform>());
+    REQUIRE_FALSE(prefab.Has<Components::Velocity>());
+    REQUIRE(prefab.Get<Components::Velocity>() == nullptr);
+
+    // Repetir un tipo reemplaza su valor
+    prefab.With<Components::Health>(80);
+    REQUIRE(prefab.GetComponentCount() == 2);
+    REQUIRE(prefab.Get<Components::Health>()->current == 80);
+
+    prefab.Get<Components::Transform>()->rotation = 90.0f;
+    REQUIRE(prefab.Get<Components::Transform>()->rotation == 90.0f);
+}
+
+TEST_CASE("Registry::Instantiate crea N copias de una plantilla", "[ecs][prefab]") {
+    ECS::Registry registry;
+    auto existing = registry.CreateEntity();
+
+    ECS::Prefab prefab("enemy");
+    prefab.With<Components::Transform>(glm::vec2{100.0f, 100.0f})
+          .With<Components::Velocity>(glm::vec2{20.0f, 15.0f}, 45.0f)
+          .With<Components::Static>();
+
+    const auto instances = registry.Instantiate(prefab, 1000, [&](entt::entity entity, uint32_t index) {
+        registry.GetComponent<Components::Transform>(entity).position.x += static_cast<float>(index);
+    });
+
+    REQUIRE(instances.size() == 1000);
+    REQUIRE(registry.GetEntityCount() == 1001);
+    REQUIRE(registry.GetNative().view<Components::Transform, Components::Velocity, Components::Static>().size() == 1000);
+
+    for (uint32_t i = 0; i < instances.size(); ++i) {
+        REQUIRE(instances[i] != existing);
+        REQUIRE(registry.GetComponent<Components::Transform>(instances[i]).position.x == 100.0f + i);
+        REQUIRE(registry.GetComponent<Components::Velocity>(instances[i]).angular == 45.0f);
+    }
+
+    // La plantilla no cambia con lo que se haga a sus copias
+    REQUIRE(prefab.Get<Components::Transform>()->position.x == 100.0f);
+
+    SECTION("Sin componentes o sin copias") {
+        ECS::Prefab empty;
+        REQUIRE(registry.Instantiate(empty, 3).size() == 3);
+        REQUIRE(registry.Instantiate(prefab, 0).empty());
+        REQUIRE(registry.GetEntityCount() == 1004);
+    }
+}
@@ -0,0 +1,354 @@
+// ============================================================================
+// Test: RenderSystem
+// ============================================================================
+// Tests de ordenación (radix sort + claves), culling, cámaras, interpolación
+// y geometría estática del RenderSystem
+// ============================================================================
+
+#include <catch2/catch_test_macros.hpp>
+#include "../../src/core/ecs/Registry.hpp"
+#include "../../src/core/components/Transform.hpp"
+#include "../../src/core/components/Renderable.hpp"
+#include "../../src/core/components/Static.hpp"
+#include "../../src/core/components/Camera.hpp"
+#include "../../src/core/components/PreviousTransform.hpp"
+#include "../../src/core/systems/CameraSystem.hpp"
+#include "../../src/core/systems/RenderSystem.hpp"
+#include "../../src/core/utils/RadixSort.hpp"
+#include <algorithm>
+#include <random>
+
+using namespace MultiNinjaEspacial::Core;
+using MultiNinjaEspacial::Infrastructure::Rendering::IRenderer;
+using MultiNinjaEspacial::Infrastructure::Rendering::TextureHandle;
+
+namespace {
+
+/**
+ * @brief Renderer falso que registra el orden de los DrawSprite
+ *
+ * Los DrawStaticBatch se registran en la misma lista (con staticBatch
+ * distinto de INVALID_STATIC_BATCH) para poder comprobar el intercalado.
+ * Cada draw guarda la vista activa (índice en views, -1 = pantalla).
+ */
+class MockRenderer : public IRenderer {
+public:
+    struct Draw {
+        TextureHandle texture;
+        glm::vec2 position;
+        StaticBatchId staticBatch{INVALID_STATIC_BATCH};
+        int view{-1};
+    };
+
+    std::vector<Draw> draws;
+    std::vector<glm::ivec4> views;      // Viewports de cada SetView
+    int activeView{-1};
+    std::vector<size_t> staticSizes;    // StaticBatchId → sprites horneados
+    uint32_t staticUpdates{0};
+    uint32_t staticDestroyed{0};
+
+    bool Initialize(int, int) override { return true; }
+    void Shutdown() override {}
+    void Clear(const glm::vec4&) override {}
+    void Present() override {}
+    void SetViewport(int, int, int, int) override {}
+    void SetView(const glm::mat4&, const glm::ivec4& viewport) override {
+        views.push_back(viewport);
+        activeView = static_cast<int>(views.size()) - 1;
+    }
+    void ResetView() override { activeView = -1; }
+    void SetResolutionScale(float) override {}
+    void BeginOverlay() override {}
+
+    void DrawSprite(TextureHandle texture, const glm::vec2& position,
+                    const glm::vec2&, float, const glm::vec4&) override {
+        draws.push_back({texture, position, INVALID_STATIC_BATCH, activeView});
+    }
+
+    TextureHandle LoadTexture(const std::string&, const std::string&) override { return {}; }
+    TextureHandle LoadTextureAsync(const std::string&, const std::string&, TextureLoadCallback) override { return {}; }
+    [[nodiscard]] bool IsTextureResident(TextureHandle) const override { return true; }
+    bool LoadTextureAtlas(const std::string&) override { return true; }
+    TextureHandle CreateTexture(const std::string&, uint32_t, uint32_t, const uint8_t*) override { return {}; }
+    TextureHandle CreateTextureRegion(const std::string&, TextureHandle, uint32_t, uint32_t, uint32_t, uint32_t) override { return {}; }
+    [[nodiscard]] TextureHandle FindTexture(const std::string&) const override { return {}; }
+    void UnloadTexture(TextureHandle) override {}
+    StaticBatchId CreateStaticBatch() override {
+        staticSizes.push_back(0);
+        return static_cast<StaticBatchId>(staticSizes.size() - 1);
+    }
+    bool UpdateStaticBatch(StaticBatchId batch, const StaticSprite*, size_t count) override {
+        staticSizes[batch] = count;
+        staticUpdates++;
+        return true;
+    }
+    void DrawStaticBatch(StaticBatchId batch) override {
+        draws.push_back({TextureHandle{}, glm::vec2{0.0f}, batch, activeView});
+    }
+    void DestroyStaticBatch(StaticBatchId) override { staticDestroyed++; }
+    [[nodiscard]] std::string GetName() const override { return "Mock"; }
+    [[nodiscard]] RenderStats GetStats() const override { return {}; }
+    void ResetStats() override {}
+};
+
+entt::entity CreateSprite(ECS::Registry& registry, glm::vec2 position,
+                          uint32_t texture, int layer) {
+    auto entity = registry.CreateEntity();
+    registry.AddComponent<Components::Transform>(entity, position);
+    registry.AddComponent<Components::Renderable>(entity, TextureHandle(texture), glm::vec4{1.0f}, layer);
+    return entity;
+}
+
+entt::entity CreateStaticSprite(ECS::Registry& registry, glm::vec2 position,
+                                uint32_t texture, int layer) {
+    auto entity = CreateSprite(registry, position, texture, layer);
+    registry.AddComponent<Components::Static>(entity);
+    return entity;
+}
+
+const Systems::RenderSystem::ViewBounds SCREEN{{0.0f, 0.0f}, {800.0f, 600.0f}};
+
+} // namespace
+
+TEST_CASE("RadixSort64 ordena igual que std::sort", "[utils][radixsort]") {
+    std::mt19937_64 rng(1234);
+    std::vector<uint64_t> keys(5000);
+    for (auto& key : keys) {
+        key = rng();
+    }
+
+    auto expected = keys;
+    std::sort(expected.begin(), expected.end());
+
+    std::vector<uint64_t> scratch;
+    Utils::RadixSort64(keys, scratch);
+    REQUIRE(keys == expected);
+}
+
+TEST_CASE("RenderSystem construye claves ordenables", "[systems][render]") {
+    using Systems::RenderSystem;
+
+    SECTION("Layer domina sobre textura") {
+        REQUIRE(RenderSystem::MakeSortKey(1, 999, 0) < RenderSystem::MakeSortKey(2, 0, 0));
+    }
+
+    SECTION("Layers negativos van antes que positivos") {
+        REQUIRE(RenderSystem::MakeSortKey(-5, 0, 0) < RenderSystem::MakeSortKey(0, 0, 0));
+    }
+
+    SECTION("Textura domina sobre índice") {
+        REQUIRE(RenderSystem::MakeSortKey(0, 1, 1000) < RenderSystem::MakeSortKey(0, 2, 0));
+    }
+}
+
+TEST_CASE("RenderSystem ordena por layer y textura", "[systems][render]") {
+    ECS::Registry registry;
+    MockRenderer renderer;
+    Systems::RenderSystem renderSystem;
+
+    CreateSprite(registry, {10.0f, 10.0f}, 2, 20);
+    CreateSprite(registry, {20.0f, 10.0f}, 1, 10);
+    CreateSprite(registry, {30.0f, 10.0f}, 2, 10);
+    CreateSprite(registry, {40.0f, 10.0f}, 1, 10);
+
+    renderSystem.Render(registry.GetNative(), renderer, SCREEN);
+
+    REQUIRE(renderer.draws.size() == 4);
+
+    // Layer 10 primero, agrupado por textura (menor handle antes)
+    REQUIRE(renderer.draws[0].texture == TextureHandle(1));
+    REQUIRE(renderer.draws[1].texture == TextureHandle(1));
+    REQUIRE(renderer.draws[2].texture == TextureHandle(2));
+
+    // Orden de envío conservado dentro de la misma textura
+    REQUIRE(renderer.draws[0].position.x == 20.0f);
+    REQUIRE(renderer.draws[1].position.x == 40.0f);
+
+    // Layer 20 al final
+    REQUIRE(renderer.draws[3].position.x == 10.0f);
+}
+
+TEST_CASE("RenderSystem descarta invisibles y fuera de pantalla", "[systems][render]") {
+    ECS::Registry registry;
+    MockRenderer renderer;
+    Systems::RenderSystem renderSystem;
+
+    CreateSprite(registry, {100.0f, 100.0f}, 0, 0);
+    CreateSprite(registry, {5000.0f, 100.0f}, 0, 0);   // Lejos de la pantalla
+    CreateSprite(registry, {-10.0f, -10.0f}, 0, 0);    // Asoma por la esquina
+
+    auto hidden = CreateSprite(registry, {200.0f, 200.0f}, 0, 0);
+    registry.GetComponent<Components::Renderable>(hidden).Hide();
+
+    renderSystem.Render(registry.GetNative(), renderer, SCREEN);
+
+    const auto& stats = renderSystem.GetStats();
+    REQUIRE(stats.visited == 4);
+    REQUIRE(stats.hidden == 1);
+    REQUIRE(stats.culled == 1);
+    REQUIRE(stats.submitted == 2);
+    REQUIRE(renderer.draws.size() == 2);
+}
+
+TEST_CASE("RenderSystem interpola entre el paso anterior y el actual", "[systems][render][interpolation]") {
+    ECS::Registry registry;
+    MockRenderer renderer;
+    Systems::RenderSystem renderSystem;
+
+    auto moving = CreateSprite(registry, {200.0f, 100.0f}, 1, 0);
+    registry.AddComponent<Components::PreviousTransform>(
+        moving, Components::Transform{glm::vec2{100.0f, 100.0f}});
+    CreateSprite(registry, {300.0f, 100.0f}, 1, 0);     // Sin snapshot: tal cual
+
+    SECTION("Por defecto se dibuja el estado actual") {
+        renderSystem.Render(registry.GetNative(), renderer, SCREEN);
+        REQUIRE(renderer.draws.size() == 2);
+        REQUIRE(renderer.draws[0].position.x == 200.0f);
+        REQUIRE(renderer.draws[1].position.x == 300.0f);
+    }
+
+    SECTION("A mitad de paso, a mitad de camino") {
+        renderSystem.SetInterpolationAlpha(0.5f);
+        renderSystem.Render(registry.GetNative(), renderer, SCREEN);
+        REQUIRE(renderSystem.GetStats().visited == 2);
+        REQUIRE(renderer.draws.size() == 2);
+        REQUIRE(renderer.draws[0].position.x == 150.0f);
+        REQUIRE(renderer.draws[1].position.x == 300.0f);
+    }
+}
+
+TEST_CASE("RenderSystem dibuja cada cámara con lo que ve", "[systems][render][camera]") {
+    ECS::Registry registry;
+    MockRenderer renderer;
+    Systems::RenderSystem renderSystem;
+    Systems::CameraSystem cameras;
+
+    // Pantalla partida: mitad izquierda mira a x ∈ [0, 400], la derecha a [5000, 5400]
+    auto left = registry.CreateEntity();
+    registry.AddComponent<Components::Camera>(left, glm::vec2{200.0f, 300.0f}, 1.0f,
+                                              glm::vec4{0.0f, 0.0f, 0.5f, 1.0f});
+    auto right = registry.CreateEntity();
+    registry.AddComponent<Components::Camera>(right, glm::vec2{5200.0f, 300.0f}, 1.0f,
+                                              glm::vec4{0.5f, 0.0f, 0.5f, 1.0f});
+
+    CreateSprite(registry, {100.0f, 100.0f}, 0, 0);       // Solo la izquierda
+    CreateSprite(registry, {5100.0f, 100.0f}, 0, 0);      // Solo la derecha
+    CreateSprite(registry, {2000.0f, 100.0f}, 0, 0);      // Entre las dos: ninguna
+    CreateStaticSprite(registry, {5050.0f, 200.0f}, 1, 0);
+
+    cameras.Update(registry.GetNative(), {800.0f, 600.0f});
+    renderSystem.Render(registry.GetNative(), renderer, cameras);
+
+    const auto& stats = renderSystem.GetStats();
+    REQUIRE(stats.views == 2);
+    REQUIRE(stats.culled == 1);
+    REQUIRE(stats.submitted == 2);
+    REQUIRE(stats.staticLayers == 1);
+
+    REQUIRE(renderer.views.size() == 2);
+    REQUIRE(renderer.views[0] == glm::ivec4{0, 0, 400, 600});
+    REQUIRE(renderer.views[1] == glm::ivec4{400, 0, 400, 600});
+
+    // Cada cámara solo recibe lo suyo; el layer estático, antes que lo dinámico
+    REQUIRE(renderer.draws.size() == 3);
+    REQUIRE(renderer.draws[0].view == 0);
+    REQUIRE(renderer.draws[0].position.x == 100.0f);
+    REQUIRE(renderer.draws[1].view == 1);
+    REQUIRE(renderer.draws[1].staticBatch != IRenderer::INVALID_STATIC_BATCH);
+    REQUIRE(renderer.draws[2].view == 1);
+    REQUIRE(renderer.draws[2].position.x == 5100.0f);
+
+    // Al terminar, el renderer vuelve a la vista de pantalla
+    REQUIRE(renderer.activeView == -1);
+}
+
+TEST_CASE("RenderSystem hornea las entidades estáticas por layer", "[systems][render][static]") {
+    ECS::Registry registry;
+    MockRenderer renderer;
+    Systems::RenderSystem renderSystem;
+
+    auto rock = CreateStaticSprite(registry, {100.0f, 100.0f}, 1, 0);
+    CreateStaticSprite(registry, {200.0f, 100.0f}, 2, 0);
+    auto tree = CreateStaticSprite(registry, {300.0f, 100.0f}, 1, 5);
+    CreateSprite(registry, {400.0f, 100.0f}, 3, 0);
+
+    renderSystem.Render(registry.GetNative(), renderer, SCREEN);
+
+    const auto& stats = renderSystem.GetStats();
+    REQUIRE(renderSystem.GetStaticLayerCount() == 2);
+    REQUIRE(stats.staticRebuilt == 2);
+    REQUIRE(stats.staticLayers == 2);
+    REQUIRE(stats.staticSprites == 3);
+    REQUIRE(stats.visited == 1);    // Solo la dinámica se recorre
+    REQUIRE(renderer.staticUpdates == 2);
+
+    SECTION("Sin cambios no se rehace nada") {
+        renderer.draws.clear();
+        renderSystem.Render(registry.GetNative(), renderer, SCREEN);
+
+        REQUIRE(renderSystem.GetStats().staticRebuilt == 0);
+        REQUIRE(renderSystem.GetStats().staticLayers == 2);
+        REQUIRE(renderer.staticUpdates == 2);
+        REQUIRE(renderer.draws.size() == 3);
+    }
+
+    SECTION("Un patch rehace solo el layer afectado") {
+        registry.PatchComponent<Components::Transform>(rock, [](auto& t) { t.position.x += 32.0f; });
+        renderSystem.Render(registry.GetNative(), renderer, SCREEN);
+
+        REQUIRE(renderSystem.GetStats().staticRebuilt == 1);
+        REQUIRE(renderer.staticUpdates == 3);
+    }
+
+    SECTION("Cambiar de layer mueve la entidad de batch") {
+        registry.PatchComponent<Components::Renderable>(rock, [](auto& r) { r.layer = 5; });
+        renderSystem.Render(registry.GetNative(), renderer, SCREEN);
+
+        REQUIRE(renderSystem.GetStats().staticRebuilt == 2);
+        REQUIRE(renderSystem.GetStats().staticSprites == 3);
+        REQUIRE(renderer.staticSizes[0] == 1);   // Layer 0: solo queda la textura 2
+        REQUIRE(renderer.staticSizes[1] == 2);   // Layer 5
+    }
+
+    SECTION("Destruir la última entidad de un layer elimina su batch") {
+        registry.DestroyEntity(tree);
+        renderSystem.Render(registry.GetNative(), renderer, SCREEN);
+
+        REQUIRE(renderSystem.GetStaticLayerCount() == 1);
+        REQUIRE(renderer.staticDestroyed == 1);
+    }
+
+    SECTION("Ocultar una entidad la saca del batch y mostrarla la devuelve") {
+        registry.PatchComponent<Components::Renderable>(rock, [](auto& r) { r.Hide(); });
+        renderSystem.Render(registry.GetNative(), renderer, SCREEN);
+        REQUIRE(renderSystem.GetStats().staticSprites == 2);
+
+        registry.PatchComponent<Components::Renderable>(rock, [](auto& r) { r.Show(); });
+        renderSystem.Render(registry.GetNative(), renderer, SCREEN);
+        REQUIRE(renderSystem.GetStats().staticSprites == 3);
+    }
+}
+
+TEST_CASE("RenderSystem dibuja lo estático debajo de lo dinámico de su layer", "[systems][render][static]") {
+    ECS::Registry registry;
+    MockRenderer renderer;
+    Systems::RenderSystem renderSystem;
+
+    CreateSprite(registry, {10.0f, 10.0f}, 1, 0);
+    CreateSprite(registry, {20.0f, 10.0f}, 1, 10);
+    CreateStaticSprite(registry, {30.0f, 10.0f}, 2, 0);
+    CreateStaticSprite(registry, {40.0f, 10.0f}, 2, 5);
+    CreateStaticSprite(registry, {50.0f, 10.0f}, 2, 20);
+    CreateStaticSprite(registry, {5000.0f, 10.0f}, 2, 30);   // Layer entero fuera de pantalla
+
+    renderSystem.Render(registry.GetNative(), renderer, SCREEN);
+
+    // Estático 0, dinámico 0, estático 5, dinámico 10, estático 20
+    REQUIRE(renderer.draws.size() == 5);
+    REQUIRE(renderer.draws[0].staticBatch != IRenderer::INVALID_STATIC_BATCH);
+    REQUIRE(renderer.draws[1].position.x == 10.0f);
+    REQUIRE(renderer.draws[2].staticBatch != IRenderer::INVALID_STATIC_BATCH);
+    REQUIRE(renderer.draws[3].position.x == 20.0f);
+    REQUIRE(renderer.draws[4].staticBatch != IRenderer::INVALID_STATIC_BATCH);
+    REQUIRE(renderSystem.GetStats().staticLayers == 3);
+}
@@ -0,0 +1,195 @@
+// ============================================================================
+// Test: SystemScheduler
+// ============================================================================
+// Dependencias por componentes, ejecución en paralelo sobre el JobSystem,
+// hilo principal y sistemas desactivados
+// ============================================================================
+
+#include <catch2/catch_test_macros.hpp>
+#include "../../src/core/ecs/Registry.hpp"
+#include "../../src/core/ecs/SystemScheduler.hpp"
+#include "../../src/core/jobs/JobSystem.hpp"
+#include "../../src/core/components/Transform.hpp"
+#include "../../src/core/components/Velocity.hpp"
+#include "../../src/core/components/Health.hpp"
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+using namespace MultiNinjaEspacial::Core;
+
+namespace {
+
+/**
+ * @brief Espera (con límite) a que un contador llegue a un valor
+ * @return false si no llegó en un segundo
+ */
+bool WaitFor(const std::atomic<int>& counter, int value) {
+    const auto limit = std::chrono::steady_clock::now() + std::chrono::seconds(1);
+    while (counter.load() < value) {
+        if (std::chrono::steady_clock::now() > limit) {
+            return false;
+        }
+        std::this_thread::yield();
+    }
+    return true;
+}
+
+} // namespace
+
+TEST_CASE("SystemScheduler ordena los sistemas que chocan", "[ecs][scheduler]") {
+    Jobs::JobSystem jobs(2);
+    ECS::SystemScheduler scheduler(jobs);
+
+    std::mutex mutex;
+    std::vector<std::string> order;
+    auto record = [&](std::string name) {
+        return [&, name](entt::registry&, float) {
+            std::this_thread::sleep_for(std::chrono::milliseconds(2));
+            std::lock_guard lock(mutex);
+            order.push_back(name);
+        };
+    };
+
+    scheduler.AddSystem("AI", record("AI")).Reads<Components::Transform>().Writes<Components::Velocity>();
+    scheduler.AddSystem("Movement", record("Movement")).Reads<Components::Velocity>().Writes<Components::Transform>();
+    scheduler.AddSystem("Damage", record("Damage")).Writes<Components::Health>();
+    scheduler.AddSystem("Camera", record("Camera")).Reads<Components::Transform>();
+
+    REQUIRE(scheduler.GetDependencies("AI").empty());
+    REQUIRE(scheduler.GetDependencies("Movement") == std::vector<std::string_view>{"AI"});
+    REQUIRE(scheduler.GetDependencies("Damage").empty());
+    REQUIRE(scheduler.GetDependencies("Camera") == std::vector<std::string_view>{"Movement"});
+
+    ECS::Registry registry;
+    scheduler.Run(registry.GetNative(), 1.0f / 60.0f);
+
+    // Todos ejecutados; AI → Movement → Camera en ese orden
+    REQUIRE(order.size() == 4);
+    auto position = [&](const std::string& name) {
+        return std::find(order.begin(), order.end(), name) - order.begin();
+    };
+    REQUIRE(position("AI") < position("Movement"));
+    REQUIRE(position("Movement") < position("Camera"));
+
+    for (const auto& timing : scheduler.GetTimings()) {
+        REQUIRE(timing.ran);
+        REQUIRE(timing.milliseconds > 0.0f);
+    }
+
+    SECTION("Structural se ejecuta solo") {
+        scheduler.AddSystem("Spawner", record("Spawner")).Structural();
+        REQUIRE(scheduler.GetDependencies("Spawner").size() == 4);
+    }
+}
+
+TEST_CASE("SystemScheduler ejecuta a la vez los sistemas independientes", "[ecs][scheduler]") {
+    Jobs::JobSystem jobs(1);
+    ECS::SystemScheduler scheduler(jobs);
+    ECS::Registry registry;
+
+    // Cada uno espera a que el otro haya empezado: solo termina bien si
+    // corren en paralelo (worker + hilo principal)
+    std::atomic<int> started{0};
+    std::atomic<bool> overlapped{true};
+    auto rendezvous = [&](entt::registry&, float) {
+        started++;
+        if (!WaitFor(started, 2)) {
+            overlapped = false;
+        }
+    };
+
+    scheduler.AddSystem("Read A", rendezvous).Reads<Components::Transform>();
+    scheduler.AddSystem("Read B", rendezvous).Reads<Components::Transform>();
+    scheduler.Run(registry.GetNative(), 0.0f);
+
+    REQUIRE(overlapped);
+    const auto& timings = scheduler.GetTimings();
+    REQUIRE(timings[0].thread != timings[1].thread);
+}
+
+TEST_CASE("SystemScheduler crea los pools antes de repartir", "[ecs][scheduler]") {
+    Jobs::JobSystem jobs(2);
+    ECS::SystemScheduler scheduler(jobs);
+
+    // Registry sin pools: las dos primeras views de Health y Velocity van
+    // en paralelo (solo comparten lecturas de Transform)
+    ECS::Registry registry;
+    auto entity = registry.CreateEntity();
+    registry.AddComponent<Components::Transform>(entity, glm::vec2{0.0f, 0.0f});
+
+    // Los dos empiezan a la vez (sin el orden que daría la cola de jobs)
+    std::atomic<int> started{0};
+    std::atomic<int> visited{0};
+    scheduler.AddSystem("Damage", [&](entt::registry& native, float) {
+        started++;
+        WaitFor(started, 2);
+        for (auto target : native.view<Components::Transform, Components::Health>()) {
+            static_cast<void>(target);
+            visited++;
+        }
+    }).Reads<Components::Transform>().Writes<Components::Health>();
+    scheduler.AddSystem("Movement", [&](entt::registry& native, float) {
+        started++;
+        WaitFor(started, 2);
+        for (auto target : native.view<Components::Transform, Components::Velocity>()) {
+            static_cast<void>(target);
+            visited++;
+        }
+    }).Reads<Components::Transform>().Writes<Components::Velocity>();
+
+    REQUIRE(scheduler.GetDependencies("Movement").empty());
+    scheduler.Run(registry.GetNative(), 0.0f);
+    REQUIRE(visited == 0);
+
+    // Con los pools ya creados los sistemas ven lo que se añade después
+    registry.AddComponent<Components::Health>(entity, 10);
+    registry.AddComponent<Components::Velocity>(entity, glm::vec2{1.0f, 0.0f});
+    scheduler.Run(registry.GetNative(), 0.0f);
+    REQUIRE(visited == 2);
+}
+
+TEST_CASE("SystemScheduler respeta MainThread y SetEnabled", "[ecs][scheduler]") {
+    Jobs::JobSystem jobs(2);
+    ECS::SystemScheduler scheduler(jobs);
+    ECS::Registry registry;
+
+    const std::thread::id mainThread = std::this_thread::get_id();
+    std::atomic<int> calls{0};
+    std::thread::id ranOn;
+
+    scheduler.AddSystem("Audio", [&](entt::registry&, float) {
+        ranOn = std::this_thread::get_id();
+        calls++;
+    }).MainThread();
+    scheduler.AddSystem("Movement", [&](entt::registry&, float) { calls++; })
+        .Reads<Components::Velocity>()
+        .Writes<Components::Transform>();
+
+    for (int frame = 0; frame < 20; ++frame) {
+        scheduler.Run(registry.GetNative(), 0.0f);
+        REQUIRE(ranOn == mainThread);
+    }
+    REQUIRE(calls == 40);
+
+    REQUIRE(scheduler.SetEnabled("Movement", false));
+    REQUIRE_FALSE(scheduler.SetEnabled("Nope", false));
+    scheduler.Run(registry.GetNative(), 0.0f);
+    REQUIRE(calls == 41);
+    REQUIRE_FALSE(scheduler.GetTimings()[1].ran);
+
+    SECTION("Sin workers todo va en serie en el hilo principal") {
+        Jobs::JobSystem noWorkers(0);
+        ECS::SystemScheduler serial(noWorkers);
+        std::vector<int> order;
+        serial.AddSystem("A", [&](entt::registry&, float) { order.push_back(1); });
+        serial.AddSystem("B", [&](entt::registry&, float) { order.push_back(2); });
+        serial.Run(registry.GetNative(), 0.0f);
+        REQUIRE(order == std::vector<int>{1, 2});
+        REQUIRE(serial.GetTimings()[1].thread == 0);
+    }
+}
@@ -0,0 +1,134 @@
+// ============================================================================
+// atlas_packer - Empaquetador offline de texture atlas
+// ============================================================================
+// Empaqueta un conjunto de imágenes en páginas PNG + manifest, con el mismo
+// AtlasPacker que usa el renderer en runtime. El juego carga el resultado
+// con IRenderer::LoadTextureAtlas() sin empaquetar nada al arrancar.
+//
+// Uso:
+//   atlas_packer <salida.atlas> [--page-size N] [--padding N] <imagen>...
+//
+// El ID de cada textura es el nombre del archivo sin extensión
+// (assets/sprites/player.png → "player").
+// ============================================================================
+
+#define STB_IMAGE_WRITE_IMPLEMENTATION
+#include <stb_image_write.h>
+
+#include "../../src/infrastructure/rendering/ImageDecoder.hpp"
+#include "../../src/infrastructure/rendering/TextureAtlas.hpp"
+#include <spdlog/spdlog.h>
+#include <cstring>
+#include <filesystem>
+#include <string>
+#include <vector>
+
+using namespace MultiNinjaEspacial::Infrastructure::Rendering;
+
+namespace {
+
+/**
+ * @brief Imagen de entrada con su ID
+ */
+struct Image {
+    std::string id;
+    DecodedImage data;
+};
+
+void PrintUsage() {
+    spdlog::info("Uso: atlas_packer <salida.atlas> [--page-size N] [--padding N] <imagen>...");
+}
+
+bool LoadImage(const std::string& path, Image& out) {
+    std::string error;
+    if (!DecodeImageFile(path, out.data, error)) {
+        spdlog::error("No se pudo leer {}: {}", path, error);
+        return false;
+    }
+
+    out.id = std::filesystem::path(path).stem().string();
+    return true;
+}
+
+} // namespace
+
+int main(int argc, char* argv[]) {
+    spdlog::set_pattern("[%^%l%$] %v");
+
+    if (argc < 3) {
+        PrintUsage();
+        return 1;
+    }
+
+    const std::filesystem::path manifestPath = argv[1];
+    uint32_t pageSize = 2048;
+    uint32_t padding = 1;
+    std::vector<std::string> inputs;
+
+    for (int i = 2; i < argc; ++i) {
+        if (std::strcmp(argv[i], "--page-size") == 0 && i + 1 < argc) {
+            pageSize = static_cast<uint32_t>(std::stoul(argv[++i]));
+        } else if (std::strcmp(argv[i], "--padding") == 0 && i + 1 < argc) {
+            padding = static_cast<uint32_t>(std::stoul(argv[++i]));
+        } else {
+            inputs.emplace_back(argv[i]);
+        }
+    }
+
+    // 1. Decodificar imágenes
+    std::vector<Image> images(inputs.size());
+    AtlasPacker packer(pageSize, padding);
+    for (size_t i = 0; i < inputs.size(); ++i) {
+        if (!LoadImage(inputs[i], images[i])) {
+            return 1;
+        }
+        packer.Add(images[i].id, images[i].data.width, images[i].data.height);
+    }
+
+    // 2. Empaquetar
+    AtlasManifest manifest;
+    if (!packer.Pack(manifest)) {
+        return 1;
+    }
+
+    // 3. Componer páginas (regiones en el mismo orden que las imágenes)
+    const size_t pageBytes = size_t{pageSize} * pageSize * 4;
+    std::vector<std::vector<unsigned char>> pages(manifest.GetPageCount(),
+                                                  std::vector<unsigned char>(pageBytes, 0));
+
+    for (size_t i = 0; i < images.size(); ++i) {
+        const DecodedImage& image = images[i].data;
+        const AtlasRegion& region = manifest.regions[i];
+        auto& page = pages[region.page];
+
+        const size_t rowBytes = size_t{image.width} * 4;
+        for (uint32_t row = 0; row < image.height; ++row) {
+            std::memcpy(page.data() + ((size_t{region.y} + row) * pageSize + region.x) * 4,
+                        image.pixels.data() + row * rowBytes,
+                        rowBytes);
+        }
+    }
+
+    // 4. Escribir páginas PNG junto al manifest
+    const std::string stem = manifestPath.stem().string();
+    const std::filesystem::path outDir = manifestPath.parent_path();
+    for (size_t p = 0; p < pages.size(); ++p) {
+        const std::string imageName = stem + "_" + std::to_string(p) + ".png";
+        const std::string imagePath = (outDir / imageName).string();
+
+        if (!stbi_write_png(imagePath.c_str(), static_cast<int>(pageSize), static_cast<int>(pageSize),
+                            4, pages[p].data(), static_cast<int>(pageSize * 4))) {
+            spdlog::error("No se pudo escribir {}", imagePath);
+            return 1;
+        }
+        manifest.pageImages.push_back(imageName);
+    }
+
+    if (!manifest.Save(manifestPath.string())) {
+        return 1;
+    }
+
+    spdlog::info("Atlas generado: {} ({} texturas, {} página(s) de {}px)",
+                 manifestPath.string(), images.size(), pages.size(), pageSize);
+    return 0;
+}